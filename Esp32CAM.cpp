@@ -7,7 +7,24 @@
 #include <BallBoxBC_inferencing.h>
 #include "edge-impulse-sdk/dsp/image/image.hpp"
 #include "esp_camera.h"
+#include "esp_jpg_decode.h"
 #include "soc/rtc_cntl_reg.h"  // Disable brownout
+#include "frame_pool.h"
+#include "frame_pipeline.h"
+#include "frame_scheduler.h"
+#include "detection_snapshot.h"
+#include "shared_jpeg.h"
+#include "telemetry.h"
+#include "actuator_queue.h"
+#include "keyframe_tracker.h"
+#include "presence_cascade.h"
+#include "model_store.h"
+#include "multi_impulse.h"
+#include "band_resize.h"
+#include <atomic>
+#include <memory>
+#include <new>
+#include <mutex>
 
 // WiFi credentials
 const char* ssid = "Huster 37";
@@ -40,6 +57,38 @@ const char* password = "khongnhomatkhau";
 #define EI_CAMERA_RAW_FRAME_BUFFER_COLS           320
 #define EI_CAMERA_RAW_FRAME_BUFFER_ROWS           240
 #define EI_CAMERA_FRAME_BYTE_SIZE                 3
+#define EI_CAMERA_FRAME_BUFFER_BYTES              (EI_CAMERA_RAW_FRAME_BUFFER_COLS * EI_CAMERA_RAW_FRAME_BUFFER_ROWS * EI_CAMERA_FRAME_BYTE_SIZE)
+#define FRAME_POOL_SLOTS                          3   // capturing + queued + classifying
+// 1: pool slots hold the camera JPEG and the classify task decodes it straight
+// to the model input size, in tensor arena the model does not use yet while
+// the DSP reads the frame. 0: capture decodes full RGB888 frames into the slots.
+#define EI_CAMERA_DECODE_IN_ARENA                 1
+#define EI_INFERENCE_REGION_BYTES                 (48 * 1024)   // SDK allocations of one run; /data "region" has the peak
+// The built-in model is tier-planned (host/tier_plan), so its arenas come
+// from ei_arena_calloc() and the region only carries what a run allocates
+// besides them: ~4 KB, ~40 KB with a hot-swapped model (/model), whose frame
+// and features have no free arena to sit in. A model without a tier plan
+// puts its ~155 KB arena here too: raise this to 192 KB for one, or its arena
+// spills to the heap (counted as region overflows). Where the region lives:
+// 0: PSRAM, 1: internal RAM.
+#define EI_INFERENCE_REGION_INTERNAL              0
+#define EI_CAMERA_JPEG_SLOT_BYTES                 (32 * 1024)   // length + JPEG; QVGA at quality 12 is ~5-15 KB
+#if EI_CAMERA_DECODE_IN_ARENA
+#define FRAME_POOL_SLOT_BYTES                     EI_CAMERA_JPEG_SLOT_BYTES
+#else
+#define FRAME_POOL_SLOT_BYTES                     EI_CAMERA_FRAME_BUFFER_BYTES
+#endif
+
+// Second impulse (defect check, anomaly score) on every frame the sorter
+// classified: name its ei_impulse_handle_t, e.g. -DEI_EXTRA_IMPULSE=ei_default_impulse
+// (the built-in model once more, as the host simulator's check does). It runs
+// after the servo decision on the same decoded frame (multi_impulse.h); /data
+// "extra" has its result and timing. Unset: the sorter's model only.
+// #define EI_EXTRA_IMPULSE                       ei_default_impulse
+
+// Live view
+#define STREAM_MAX_CLIENTS                        2
+#define STREAM_BOUNDARY                           "frame"
 
 // Pins
 #define SERVO_PIN 12
@@ -73,30 +122,74 @@ static camera_config_t camera_config = {
     .pixel_format   = PIXFORMAT_JPEG,
     .frame_size     = FRAMESIZE_QVGA,
     .jpeg_quality   = 12,
-    .fb_count       = 2,
+    .fb_count       = 2 + STREAM_MAX_CLIENTS,  // stream clients may hold a frame each
     .fb_location    = CAMERA_FB_IN_PSRAM,
     .grab_mode      = CAMERA_GRAB_LATEST,
 };
 
 // Globals
 AsyncWebServer server(80);
+AsyncEventSource events("/events");     // pushes status records to every open page
 Servo myservo;
 LiquidCrystal_I2C lcd(0x27, 16, 2);
 
 static bool debug_nn = false;
 static bool is_initialised = false;
-uint8_t *snapshot_buf = nullptr;
+
+static void return_camera_fb(void *fb) { esp_camera_fb_return((camera_fb_t *)fb); }
+static SharedJpeg shared_jpeg(return_camera_fb);    // camera JPEG shared by classifier and /stream
+static Telemetry telemetry;             // per-frame stage timings, served on /telemetry
+static FramePool frame_pool;            // JPEG or RGB888 frame buffers, allocated once in setup()
+static FramePipeline pipeline;          // capture task (core 0) -> classify task (core 1)
+static FrameScheduler scheduler;        // paces capture from measured stage times
+static ActuatorQueue actuator;          // servo + LCD, written by a low-priority task
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+static KeyframeTracker keyframes;       // tracks objects between full FOMO runs
+#endif
+static PresenceCascade cascade;         // cheap empty-belt test in front of FOMO
+static ModelStore models;               // models uploaded on /model, swapped in between frames
+static MultiImpulseRunner extra_impulses;   // after the sorter's model, see EI_EXTRA_IMPULSE
+
+// Latest result of an extra impulse, for /data
+struct ExtraResult {
+    uint32_t frame_id;
+    const char *label;      // best box, "none" without one
+    float score;
+    uint32_t boxes;
+    float anomaly;
+};
+static SeqLock<ExtraResult> extra_results[MULTI_IMPULSE_MAX];
+static uint32_t extra_frame_id = 0;     // frame the extra impulses are running on
+static uint8_t *inference_region = nullptr;     // bump region for ei_malloc() during a run, allocated in setup()
+static std::atomic<uint32_t> region_peak{0};    // largest high-water mark so far
+static std::atomic<uint32_t> region_overflows{0};   // allocations that did not fit and went to the heap
+static std::atomic<uint32_t> region_unfreed{0};     // allocations still live when their run ended
+uint8_t *snapshot_buf = nullptr;        // model-size BGR888 frame currently being classified
+#if EI_CAMERA_DECODE_IN_ARENA
+static const uint8_t *snapshot_jpeg = nullptr;  // its JPEG slot, decoded on first read
+static uint8_t *decode_scratch = nullptr;       // decode target when no arena is free, allocated in setup()
+static uint32_t snapshot_decode_us = 0;
+static bool snapshot_in_arena = false;          // decoded during the DSP step, so counted in dsp_us
+#endif
 
 bool detection_running = true;
-String current_detection = "No Object";
-float current_confidence = 0.0f;
-int current_servo_angle = 90;
+static SeqLock<DetectionState> detection;   // written by the classify task, read by web handlers
 
 // Customizable settings
 int servo_ball_angle = 45;
 int servo_box_angle = 0;
 float confidence_threshold = 0.5f;
-int detection_delay = 1000;
+int detection_delay = 1000;            // target frame period (ms), 0 = as fast as possible
+int servo_deadline = 0;                 // max frame age at servo write (ms), 0 = no deadline
+int keyframe_interval = 1;              // run FOMO every N frames, track in between; 1 = every frame
+int presence_threshold = 0;             // luma change that wakes FOMO up, 0 = always run it
+
+// delay / deadline as the setup form allows them (0..5000 ms), so the
+// scheduler's ms -> us conversion cannot wrap
+static int setup_ms(const String &v) {
+    int ms = v.toInt();
+    return ms < 0 ? 0 : ms > 5000 ? 5000 : ms;
+}
 
 // HTML GUI - Đẹp hơn, đóng khung, chữ tiếng Việt rõ ràng, nút servo cập nhật theo setting, form input cập nhật giá trị hiện tại
 // ... (toàn bộ phần trước giống code cũ)
@@ -129,11 +222,14 @@ const char index_html[] PROGMEM = R"rawliteral(
     input[type=number] { width: 100%; padding: 10px; border: 1px solid #ccc; border-radius: 5px; font-size: 1em; }
     .btn-submit { background: #00796b; color: white; padding: 15px; font-size: 1.2em; border-radius: 8px; }
     .btn-submit:hover { background: #004d40; }
+    .live { position: relative; max-width: 320px; margin: 0 auto; display: none; }
+    .live img, .live canvas { width: 100%; display: block; }
+    .live canvas { position: absolute; left: 0; top: 0; }
+    .btn-live { background: #1976d2; color: white; }
     footer { text-align: center; padding: 15px; background: #00796b; color: white; font-size: 0.9em; }
   </style>
   <script>
-    function updateStatus() {
-      fetch('/data').then(r => r.json()).then(data => {
+    function showStatus(data) {
         document.getElementById('detected').innerText = data.detection;
         document.getElementById('confidence').innerText = (data.confidence).toFixed(2) + '%';
         document.getElementById('servo').innerText = data.servo + '°';
@@ -144,11 +240,39 @@ const char index_html[] PROGMEM = R"rawliteral(
         document.getElementById('btn-ball').innerText = 'Ball → ' + data.ball_angle + '°';
         document.getElementById('btn-box').setAttribute('onclick', 'setServo(' + data.box_angle + ')');
         document.getElementById('btn-ball').setAttribute('onclick', 'setServo(' + data.ball_angle + ')');
+    }
+
+    function updateStatus() {
+      fetch('/data').then(r => r.json()).then(showStatus);
+    }
+
+    // ESP32 đẩy trạng thái qua /events khi có thay đổi; trình duyệt cũ thì hỏi mỗi giây
+    // Khung FOMO gửi riêng qua /events, vẽ đè lên ảnh trực tiếp ở trình duyệt
+    function drawBoxes(boxes) {
+      const c = document.getElementById('overlay');
+      const ctx = c.getContext('2d');
+      ctx.clearRect(0, 0, c.width, c.height);
+      ctx.strokeStyle = '#ff1744'; ctx.fillStyle = '#ff1744'; ctx.lineWidth = 2; ctx.font = '12px sans-serif';
+      boxes.forEach(b => {
+        ctx.strokeRect(b.x, b.y, b.w, b.h);
+        ctx.fillText(b.l + ' ' + Math.round(b.v * 100) + '%', b.x, b.y > 12 ? b.y - 3 : b.y + 12);
       });
     }
-    
-    // Chỉ cập nhật status mỗi giây, KHÔNG cập nhật input
-    setInterval(updateStatus, 1000);
+
+    function toggleLive() {
+      const live = document.getElementById('live');
+      const img = document.getElementById('stream');
+      if (live.style.display === 'block') { img.src = ''; live.style.display = 'none'; }
+      else { img.src = '/stream'; live.style.display = 'block'; }
+    }
+
+    if (window.EventSource) {
+      const es = new EventSource('/events');
+      es.addEventListener('status', e => showStatus(JSON.parse(e.data)));
+      es.addEventListener('boxes', e => drawBoxes(JSON.parse(e.data)));
+    } else {
+      setInterval(updateStatus, 1000);
+    }
     
     // Khi trang load lần đầu, lấy giá trị hiện tại để điền vào form (chỉ chạy 1 lần)
     window.onload = function() {
@@ -157,6 +281,9 @@ const char index_html[] PROGMEM = R"rawliteral(
         document.getElementById('input-box').value = data.box_angle;
         document.getElementById('input-threshold').value = data.threshold;
         document.getElementById('input-delay').value = data.delay;
+        document.getElementById('input-deadline').value = data.deadline;
+        document.getElementById('input-keyframe').value = data.keyframe;
+        document.getElementById('input-gate').value = data.gate;
         updateStatus(); // Cập nhật status và nút lần đầu
       });
     };
@@ -177,6 +304,11 @@ const char index_html[] PROGMEM = R"rawliteral(
       <strong>Góc Servo:</strong> <span id="servo">90°</span><br>
       <strong>Trạng thái:</strong> <span id="status">Đang chạy</span>
     </div>
+
+    <div class="live" id="live">
+      <img id="stream" alt="">
+      <canvas id="overlay" width="320" height="240"></canvas>
+    </div>
     
     <div class="controls">
       <div class="btn-group">
@@ -186,6 +318,7 @@ const char index_html[] PROGMEM = R"rawliteral(
       </div>
       <div style="text-align:center;">
         <button class="btn-toggle" onclick="toggleDetect()">Bật / Tắt Phát Hiện</button>
+        <button class="btn-live" onclick="toggleLive()">Xem Trực Tiếp</button>
       </div>
     </div>
     
@@ -202,7 +335,16 @@ const char index_html[] PROGMEM = R"rawliteral(
         <input type="number" id="input-threshold" name="threshold" step="0.01" min="0" max="1">
         
         <label>Thời gian giữa các lần phát hiện (ms):</label>
-        <input type="number" id="input-delay" name="delay" min="500" max="5000">
+        <input type="number" id="input-delay" name="delay" min="0" max="5000">
+
+        <label>Hạn chót điều khiển servo (ms, 0 = tắt):</label>
+        <input type="number" id="input-deadline" name="deadline" min="0" max="5000">
+
+        <label>Chạy mô hình mỗi N khung, bám đối tượng ở giữa (1 = mọi khung):</label>
+        <input type="number" id="input-keyframe" name="keyframe" min="1" max="30">
+
+        <label>Ngưỡng phát hiện có vật (độ sáng, 0 = luôn chạy mô hình):</label>
+        <input type="number" id="input-gate" name="gate" min="0" max="255">
         
         <button type="submit" class="btn-submit">Áp Dụng Cài Đặt</button>
       </form>
@@ -235,25 +377,137 @@ bool ei_camera_init(void) {
     return true;
 }
 
-bool ei_camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf) {
-    if (!is_initialised) return false;
+#if EI_CAMERA_DECODE_IN_ARENA
+// Copies the latest camera JPEG into `slot` (uint32_t length, then the data);
+// ei_camera_frame() decodes it on the classify task. `grab_us` (optional)
+// receives the time spent waiting for the camera.
+bool ei_camera_capture(uint8_t *slot, size_t slot_bytes, uint32_t *grab_us = nullptr) {
+    if (!is_initialised || !slot) return false;
+    uint32_t t0 = micros();
+    camera_fb_t *fb = esp_camera_fb_get();
+    if (grab_us) *grab_us = micros() - t0;
+    if (!fb) return false;
+    int jpeg = shared_jpeg.wrap(fb, fb->buf, fb->len);
+    if (jpeg < 0) { esp_camera_fb_return(fb); return false; }
+    shared_jpeg.publish(jpeg);      // only while /stream has clients
+
+    bool fits = fb->len + sizeof(uint32_t) <= slot_bytes;
+    if (fits) {
+        uint32_t len = (uint32_t)fb->len;
+        memcpy(slot, &len, sizeof(len));
+        memcpy(slot + sizeof(len), fb->buf, fb->len);
+    }
+    shared_jpeg.release(jpeg);
+    return fits;
+}
+
+struct JpegDecodeJob {
+    const uint8_t *jpeg;
+    size_t len;
+    BandResizer resizer;
+};
+
+static size_t jpeg_read(void *arg, size_t index, uint8_t *buf, size_t len) {
+    const JpegDecodeJob *job = (const JpegDecodeJob *)arg;
+    if (index >= job->len) return 0;
+    if (len > job->len - index) len = job->len - index;
+    if (buf) memcpy(buf, job->jpeg + index, len);
+    return len;
+}
+
+static bool jpeg_write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+    JpegDecodeJob *job = (JpegDecodeJob *)arg;
+    if (!data) {    // start (0, 0, width, height) and end markers
+        return x != 0 || y != 0 || (w == EI_CAMERA_RAW_FRAME_BUFFER_COLS && h == EI_CAMERA_RAW_FRAME_BUFFER_ROWS);
+    }
+    return job->resizer.block(x, y, w, h, data);
+}
+
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+// First fit; the chosen region shrinks by `bytes`
+static uint8_t *take_region(ei_arena_region_t *regions, size_t n, size_t bytes) {
+    for (size_t i = 0; i < n; i++) {
+        if (regions[i].bytes >= bytes) {
+            uint8_t *p = regions[i].ptr;
+            regions[i].ptr += bytes;
+            regions[i].bytes -= bytes;
+            return p;
+        }
+    }
+    return nullptr;
+}
+#endif
+
+// Model-size BGR888 frame for the current slot, decoded on first use. While
+// run_classifier() fills the input tensor the frame and the decoder's row ring
+// go into tensor arena the first layer has not touched yet, so nothing
+// outlives the DSP step; before that (tracking, the presence gate) or for a
+// model without free regions they go into decode_scratch.
+static bool ei_camera_frame() {
+    if (snapshot_buf) return true;
+    if (!snapshot_jpeg) return false;
+    const size_t frame_bytes = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT * EI_CAMERA_FRAME_BYTE_SIZE;
+    const size_t ring_bytes = BandResizer::scratch_bytes(EI_CAMERA_RAW_FRAME_BUFFER_COLS, EI_CAMERA_RAW_FRAME_BUFFER_ROWS,
+                                                         EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+    uint32_t t0 = micros();
+    uint8_t *frame = nullptr, *ring = nullptr;
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    ei_arena_region_t regions[4];
+    size_t n = ei_arena_free_regions(regions, 4);
+    frame = take_region(regions, n, frame_bytes);
+    ring = take_region(regions, n, ring_bytes);
+#endif
+    snapshot_in_arena = frame && ring;
+    if (!snapshot_in_arena) {
+        frame = decode_scratch;
+        ring = decode_scratch + frame_bytes;
+    }
+
+    JpegDecodeJob job;
+    uint32_t len;
+    memcpy(&len, snapshot_jpeg, sizeof(len));
+    job.jpeg = snapshot_jpeg + sizeof(len);
+    job.len = len;
+    if (!job.resizer.begin(EI_CAMERA_RAW_FRAME_BUFFER_COLS, EI_CAMERA_RAW_FRAME_BUFFER_ROWS,
+                           EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, frame, ring)) return false;
+    if (esp_jpg_decode(job.len, JPG_SCALE_NONE, jpeg_read, jpeg_write, &job) != ESP_OK || !job.resizer.done()) {
+        return false;
+    }
+    snapshot_buf = frame;
+    snapshot_decode_us = micros() - t0;
+    return true;
+}
+#else
+// Decodes the latest camera frame into `frame` (a full-size pool slot) and
+// resizes it in place to img_width x img_height. `grab_us` (optional) receives
+// the time spent waiting for the camera.
+bool ei_camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *frame, uint32_t *grab_us = nullptr) {
+    if (!is_initialised || !frame) return false;
+    uint32_t t0 = micros();
     camera_fb_t *fb = esp_camera_fb_get();
+    if (grab_us) *grab_us = micros() - t0;
     if (!fb) return false;
-    bool converted = fmt2rgb888(fb->buf, fb->len, PIXFORMAT_JPEG, snapshot_buf);
-    esp_camera_fb_return(fb);
+    int jpeg = shared_jpeg.wrap(fb, fb->buf, fb->len);
+    if (jpeg < 0) { esp_camera_fb_return(fb); return false; }
+    shared_jpeg.publish(jpeg);      // only while /stream has clients
+
+    bool converted = fmt2rgb888(fb->buf, fb->len, PIXFORMAT_JPEG, frame);
+    shared_jpeg.release(jpeg);      // fb goes back to the driver once /stream is done with it too
     if (!converted) return false;
 
     if (img_width != EI_CAMERA_RAW_FRAME_BUFFER_COLS || img_height != EI_CAMERA_RAW_FRAME_BUFFER_ROWS) {
         ei::image::processing::crop_and_interpolate_rgb888(
-            snapshot_buf, EI_CAMERA_RAW_FRAME_BUFFER_COLS, EI_CAMERA_RAW_FRAME_BUFFER_ROWS,
-            out_buf, img_width, img_height);
-    } else {
-        memcpy(out_buf, snapshot_buf, img_width * img_height * 3);
+            frame, EI_CAMERA_RAW_FRAME_BUFFER_COLS, EI_CAMERA_RAW_FRAME_BUFFER_ROWS,
+            frame, img_width, img_height);
     }
     return true;
 }
 
+static bool ei_camera_frame() { return snapshot_buf != nullptr; }
+#endif
+
 static int ei_camera_get_data(size_t offset, size_t length, float *out_ptr) {
+    if (!ei_camera_frame()) return -1;
     size_t pixel_ix = offset * 3;
     size_t out_ptr_ix = 0;
     while (length--) {
@@ -263,6 +517,316 @@ static int ei_camera_get_data(size_t offset, size_t length, float *out_ptr) {
     return 0;
 }
 
+// Status record pushed on /events. Formatted into a fixed buffer and only
+// sent when it differs from the previous one (confidence in whole percent).
+static std::mutex status_mutex;
+static char status_record[160];
+
+static int format_status(char *buf, size_t len) {
+    DetectionState st = detection.read();
+    return snprintf(buf, len,
+        "{\"detection\":\"%s\",\"confidence\":%.0f,\"servo\":%d,\"running\":%s,"
+        "\"ball_angle\":%d,\"box_angle\":%d}",
+        st.label, st.confidence * 100, st.servo_angle,
+        st.running ? "true" : "false", servo_ball_angle, servo_box_angle);
+}
+
+static void publish_status() {
+    char record[sizeof(status_record)];
+    format_status(record, sizeof(record));
+
+    std::lock_guard<std::mutex> lock(status_mutex);
+    if (strcmp(record, status_record) == 0) return;
+    memcpy(status_record, record, sizeof(record));
+    if (events.count() > 0) events.send(status_record, "status", millis());
+}
+
+// FOMO boxes for the live view overlay, in camera pixels. The model sees the
+// centred square crop of the frame, scaled to EI_CLASSIFIER_INPUT_WIDTH.
+static void publish_boxes(const ei_impulse_result_t &result) {
+    const int side = EI_CAMERA_RAW_FRAME_BUFFER_COLS < EI_CAMERA_RAW_FRAME_BUFFER_ROWS
+                   ? EI_CAMERA_RAW_FRAME_BUFFER_COLS : EI_CAMERA_RAW_FRAME_BUFFER_ROWS;
+    const int off_x = (EI_CAMERA_RAW_FRAME_BUFFER_COLS - side) / 2;
+    const int off_y = (EI_CAMERA_RAW_FRAME_BUFFER_ROWS - side) / 2;
+    const float scale = (float)side / EI_CLASSIFIER_INPUT_WIDTH;
+
+    char buf[512];
+    int n = snprintf(buf, sizeof(buf), "[");
+    for (uint32_t i = 0; i < result.bounding_boxes_count && n < (int)sizeof(buf) - 80; i++) {
+        const ei_impulse_result_bounding_box_t &bb = result.bounding_boxes[i];
+        if (bb.value == 0) continue;
+        n += snprintf(buf + n, sizeof(buf) - n, "%s{\"l\":\"%s\",\"v\":%.2f,\"x\":%d,\"y\":%d,\"w\":%d,\"h\":%d}",
+                      n > 1 ? "," : "", bb.label, bb.value,
+                      off_x + (int)(bb.x * scale), off_y + (int)(bb.y * scale),
+                      (int)(bb.width * scale), (int)(bb.height * scale));
+    }
+    snprintf(buf + n, sizeof(buf) - n, "]");
+    events.send(buf, "boxes", millis());
+}
+
+// /stream: multipart MJPEG straight out of the camera buffers (no re-encode).
+struct StreamState {
+    int slot = -1;              // frame being sent
+    uint32_t seq = 0;           // last frame started
+    size_t sent = 0;            // bytes of header + jpeg + trailer sent
+    size_t header_len = 0;
+    char header[96];
+
+    ~StreamState() {
+        if (slot >= 0) shared_jpeg.release(slot);
+        shared_jpeg.remove_viewer();
+    }
+};
+
+static size_t stream_fill(StreamState &st, uint8_t *buf, size_t max_len) {
+    if (st.slot < 0) {
+        st.slot = shared_jpeg.acquire_newer(st.seq);
+        if (st.slot < 0) return RESPONSE_TRY_AGAIN;
+        st.seq = shared_jpeg.seq(st.slot);
+        st.header_len = snprintf(st.header, sizeof(st.header),
+            "--" STREAM_BOUNDARY "\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n",
+            (unsigned)shared_jpeg.len(st.slot));
+        st.sent = 0;
+    }
+
+    const uint8_t *jpeg = shared_jpeg.data(st.slot);
+    const size_t jpeg_len = shared_jpeg.len(st.slot);
+    const size_t total = st.header_len + jpeg_len + 2;
+    size_t n = 0;
+    while (n < max_len && st.sent < total) {
+        const uint8_t *src;
+        size_t avail;
+        if (st.sent < st.header_len) {
+            src = (const uint8_t *)st.header + st.sent;
+            avail = st.header_len - st.sent;
+        } else if (st.sent < st.header_len + jpeg_len) {
+            src = jpeg + (st.sent - st.header_len);
+            avail = st.header_len + jpeg_len - st.sent;
+        } else {
+            src = (const uint8_t *)"\r\n" + (st.sent - st.header_len - jpeg_len);
+            avail = total - st.sent;
+        }
+        size_t chunk = avail < max_len - n ? avail : max_len - n;
+        memcpy(buf + n, src, chunk);
+        n += chunk;
+        st.sent += chunk;
+    }
+    if (st.sent == total) {
+        shared_jpeg.release(st.slot);
+        st.slot = -1;
+    }
+    return n;
+}
+
+#if EI_CAMERA_DECODE_IN_ARENA
+// Capture task (core 0): camera JPEG into a pool slot
+static bool capture_frame(uint8_t *frame, PipelineFrame &f, void *ctx) {
+    (void)ctx;
+    return ei_camera_capture(frame, frame_pool.slot_bytes(), &f.grab_us);
+}
+#else
+// Capture task (core 0): camera -> RGB888 -> 96x96, into a pool slot
+static bool capture_frame(uint8_t *frame, PipelineFrame &f, void *ctx) {
+    (void)ctx;
+    return ei_camera_capture(EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, frame, &f.grab_us);
+}
+#endif
+
+// Arenas of a host/tier_plan model (kTierPlanned), outside inference_region:
+// the fast one in internal RAM, or PSRAM when the internal heap has no block
+// that large (slower, still runs); the slow one in PSRAM
+void *ei_arena_calloc(ei_arena_tier_t tier, size_t bytes) {
+    uint8_t *p = tier == EI_ARENA_FAST ? hal_alloc_aligned(bytes, true) : nullptr;
+    if (!p) p = hal_alloc_aligned(bytes, false);
+    if (p) memset(p, 0, bytes);
+    return p;
+}
+
+void ei_arena_free(ei_arena_tier_t tier, void *ptr) {
+    (void)tier;
+    hal_free_aligned((uint8_t *)ptr);
+}
+
+// cascade.run() with the SDK's ei_malloc() / ei_calloc() bumping through
+// inference_region, all of it given back when the run returns
+static EI_IMPULSE_ERROR run_in_region(ei_impulse_handle_t *model, ei::signal_t *signal,
+                                      ei_impulse_result_t *result, bool *gated) {
+    ei::ei_inference_scope scope(inference_region, EI_INFERENCE_REGION_BYTES);
+    EI_IMPULSE_ERROR err = cascade.run(model, signal, result, debug_nn, gated);
+    if (scope.high_water() > region_peak.load()) region_peak.store((uint32_t)scope.high_water());
+    region_overflows.fetch_add((uint32_t)scope.overflows());
+    region_unfreed.fetch_add((uint32_t)scope.live());
+    return err;
+}
+
+// Classify task (core 1): inference + servo/LCD for the newest captured frame
+static void classify_frame(uint8_t *frame, const PipelineFrame &f, FrameTiming &t, void *ctx) {
+    (void)ctx;
+#if EI_CAMERA_DECODE_IN_ARENA
+    snapshot_jpeg = frame;
+    snapshot_buf = nullptr;
+    snapshot_decode_us = 0;
+    snapshot_in_arena = false;
+#else
+    snapshot_buf = frame;
+#endif
+
+    ei::signal_t signal;
+    signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+    signal.get_data = &ei_camera_get_data;
+
+    ei_impulse_result_t result = {};
+    bool keyframe = true;
+    bool gated = false;
+    ei_impulse_handle_t *model = models.at_frame_boundary();
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+    ei_impulse_result_bounding_box_t tracked[KEYFRAME_MAX_OBJECTS];
+    // tracking needs the frame before FOMO runs; without it the frame is
+    // first read (and, from a JPEG slot, decoded) by the DSP
+    static bool was_tracking = false;
+    bool tracking = keyframes.interval() > 1;
+    if (tracking && !was_tracking) keyframes.invalidate();
+    was_tracking = tracking;
+    if (tracking) {
+        if (!ei_camera_frame()) return;
+        keyframes.set_frame_bgr(snapshot_buf);
+        keyframe = keyframes.want_keyframe();
+    }
+#endif
+    // extra impulses read the frame after the sorter's run has reused the
+    // arena, so it is decoded up front, outside it, for both
+    bool extra = keyframe && extra_impulses.count() > 0;
+    if (extra && !ei_camera_frame()) return;
+    uint32_t t0 = micros();
+    if (keyframe) {
+        // the first full run of a model stays on the heap: buffers the SDK keeps
+        // in statics from that call must outlive the region
+        static ei_impulse_handle_t *region_model = nullptr;
+        static bool region_warm = false;
+        bool in_region = inference_region && region_warm && model == region_model;
+        EI_IMPULSE_ERROR err = in_region ? run_in_region(model, &signal, &result, &gated)
+                                         : cascade.run(model, &signal, &result, debug_nn, &gated);
+        if (err != EI_IMPULSE_OK) return;
+        if (!gated) {
+            region_warm = true;
+            region_model = model;
+        }
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+        if (tracking) keyframes.keyframe(result.bounding_boxes, result.bounding_boxes_count);
+    } else {
+        result.bounding_boxes = tracked;
+        result.bounding_boxes_count = keyframes.track(tracked, KEYFRAME_MAX_OBJECTS);
+        result.timing.classification_us = micros() - t0;
+#endif
+    }
+    uint32_t t1 = micros();
+#if EI_CAMERA_DECODE_IN_ARENA
+    if (snapshot_in_arena) snapshot_buf = nullptr;  // the arena went with the run
+    uint32_t decode_us = snapshot_decode_us;    // 0 when no stage read the frame
+#else
+    uint32_t decode_us = 0;                     // done by the capture task
+#endif
+    t.dsp_us = (uint32_t)result.timing.dsp_us;
+#if EI_CAMERA_DECODE_IN_ARENA
+    if (snapshot_in_arena) t.dsp_us = t.dsp_us > decode_us ? t.dsp_us - decode_us : 0;
+#endif
+    t.classification_us = (uint32_t)result.timing.classification_us;
+    uint32_t run_us = t1 - t0;
+    uint32_t busy_us = t.dsp_us + t.classification_us + decode_us;
+    t.post_us = run_us > busy_us ? run_us - busy_us : 0;
+
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+    float max_value = 0.0f;
+    bool detected = false;
+    ei_impulse_result_bounding_box_t best_bb;
+
+    for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+        auto bb = result.bounding_boxes[i];
+        if (bb.value > max_value && bb.value > confidence_threshold && (strcmp(bb.label, "ball")==0 || strcmp(bb.label, "box")==0)) {
+            max_value = bb.value;
+            best_bb = bb;
+            detected = true;
+        }
+    }
+
+    DetectionState st;
+    st.running = detection_running;
+    st.frame_id = f.seq;
+    st.dsp_us = t.dsp_us;
+    st.classification_us = t.classification_us;
+
+    char line1[ACTUATOR_LCD_COLS + 1] = "";
+    if (detected) {
+        st.set_label(best_bb.label);
+        st.confidence = max_value;
+        bool ball = strcmp(best_bb.label, "ball") == 0;
+        st.servo_angle = ball ? servo_ball_angle : servo_box_angle;
+        snprintf(line1, sizeof(line1), "Conf: %.1f%%", max_value * 100);
+        actuator.servo(st.servo_angle);
+        actuator.lcd(ball ? "Detected: Ball" : "Detected: Box", line1);
+    } else {
+        st.set_label("No Object");
+        st.confidence = 0.0f;
+        st.servo_angle = 90;
+        actuator.servo(90);
+        actuator.lcd("No Object", "");
+    }
+    st.latency_us = micros() - f.t_capture_us;
+    detection.write(st);
+#endif
+    t.actuate_us = micros() - t1;
+
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+    TelemetryRecord rec = {};
+    rec.frame_id = f.seq;
+    rec.t_ms = millis();
+    rec.grab_us = f.grab_us;
+    rec.decode_us = f.capture_us - f.grab_us + decode_us;
+    rec.dsp_us = t.dsp_us;
+    rec.classification_us = t.classification_us;
+    rec.post_us = t.post_us;
+    rec.actuate_us = t.actuate_us;
+    rec.latency_us = st.latency_us;
+    rec.heap_free = hal_free_heap();
+    rec.decision = !detected ? TELEMETRY_NONE
+                 : strcmp(best_bb.label, "ball") == 0 ? TELEMETRY_BALL : TELEMETRY_BOX;
+    rec.servo_angle = (uint8_t)st.servo_angle;
+    rec.confidence_pct = (uint8_t)(st.confidence * 100);
+    rec.flags = !keyframe ? TELEMETRY_FLAG_TRACKED : gated ? TELEMETRY_FLAG_GATED : 0;
+    telemetry.record(rec);
+#endif
+
+    if (extra && !gated) {
+        extra_frame_id = f.seq;
+        extra_impulses.run(snapshot_buf, EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, debug_nn);
+    }
+    publish_status();
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+    if (shared_jpeg.viewers() > 0 && events.count() > 0) publish_boxes(result);
+#endif
+}
+
+// Classify task, per extra impulse on the frame just sorted
+static void extra_result(int index, const ei_impulse_result_t &result, void *) {
+    ExtraResult r = {};
+    r.frame_id = extra_frame_id;
+    r.label = "none";
+    r.boxes = result.bounding_boxes_count;
+    r.anomaly = result.anomaly;
+    for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+        if (result.bounding_boxes[i].value > r.score) {
+            r.score = result.bounding_boxes[i].value;
+            r.label = result.bounding_boxes[i].label;
+        }
+    }
+    extra_results[index].write(r);
+}
+
+// Actuator task (core 0): the only place that talks to the servo and the LCD after setup()
+static void actuator_servo(int angle, void *) { myservo.write(angle); }
+static void actuator_lcd_cursor(uint8_t col, uint8_t row, void *) { lcd.setCursor(col, row); }
+static void actuator_lcd_write(const char *s, uint8_t n, void *) { lcd.write((const uint8_t *)s, n); }
+
 void setup() {
     Serial.begin(115200);
     WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0);
@@ -279,6 +843,35 @@ void setup() {
         while(1) delay(1000);
     }
 
+#if EI_CAMERA_DECODE_IN_ARENA
+    decode_scratch = hal_alloc_frame(EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT * EI_CAMERA_FRAME_BYTE_SIZE
+                                     + BandResizer::scratch_bytes(EI_CAMERA_RAW_FRAME_BUFFER_COLS, EI_CAMERA_RAW_FRAME_BUFFER_ROWS,
+                                                                  EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT));
+    if (!decode_scratch) {
+        lcd.clear(); lcd.print("Het bo nho!");
+        while(1) delay(1000);
+    }
+#endif
+#if EI_INFERENCE_REGION_INTERNAL
+    inference_region = hal_alloc_internal(EI_INFERENCE_REGION_BYTES);
+#else
+    inference_region = hal_alloc_frame(EI_INFERENCE_REGION_BYTES);
+#endif
+    if (!frame_pool.init(FRAME_POOL_SLOT_BYTES, FRAME_POOL_SLOTS) || !telemetry.init() || !inference_region) {
+        lcd.clear(); lcd.print("Het bo nho!");
+        while(1) delay(1000);
+    }
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+    if (!keyframes.init(EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, KeyframeTracker::Config())) {
+        lcd.clear(); lcd.print("Het bo nho!");
+        while(1) delay(1000);
+    }
+    keyframes.set_interval(keyframe_interval);
+#endif
+    cascade.init(EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, PresenceCascade::Config());
+    cascade.set_threshold(presence_threshold);
+    models.init(&ei_default_impulse);
+
     WiFi.begin(ssid, password);
     WiFi.setSleep(false);
     while (WiFi.status() != WL_CONNECTED) {
@@ -290,27 +883,120 @@ void setup() {
     // Web routes
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *req){ req->send_P(200, "text/html", index_html); });
 
-    // Trả về data JSON (đã fix lỗi +)
+    // Trả về data JSON: trạng thái + cài đặt (trang web gọi 1 lần khi mở)
     server.on("/data", HTTP_GET, [](AsyncWebServerRequest *req){
-        String json = "{";
-        json += "\"detection\":\"" + current_detection + "\",";
-        json += "\"confidence\":" + String(current_confidence * 100, 2) + ",";
-        json += "\"servo\":" + String(current_servo_angle) + ",";
-        json += "\"running\":" + String(detection_running ? "true" : "false") + ",";
-        json += "\"ball_angle\":" + String(servo_ball_angle) + ",";
-        json += "\"box_angle\":" + String(servo_box_angle) + ",";
-        json += "\"threshold\":" + String(confidence_threshold, 2) + ",";
-        json += "\"delay\":" + String(detection_delay);
-        json += "}";
+        DetectionState st = detection.read();
+        char json[1024];
+        snprintf(json, sizeof(json),
+            "{\"detection\":\"%s\",\"confidence\":%.2f,\"servo\":%d,\"running\":%s,\"frame\":%u,"
+            "\"ball_angle\":%d,\"box_angle\":%d,\"threshold\":%.2f,\"delay\":%d,\"deadline\":%d,\"keyframe\":%d,"
+            "\"gate\":%d,\"period_ms\":%.1f,\"latency_ms\":%.1f,"
+            "\"stage_ms\":{\"capture\":%.1f,\"dsp\":%.1f,\"nn\":%.1f,\"post\":%.1f,\"actuate\":%.1f},"
+            "\"cascade\":{\"frames\":%u,\"gated\":%u,\"rechecks\":%u,\"misses\":%u,\"gate_us\":%u,\"full_us\":%u},"
+            "\"region\":{\"bytes\":%u,\"peak\":%u,\"overflows\":%u,\"unfreed\":%u}}",
+            st.label, st.confidence * 100, st.servo_angle,
+            st.running ? "true" : "false", (unsigned)st.frame_id, servo_ball_angle, servo_box_angle,
+            confidence_threshold, detection_delay, servo_deadline, keyframe_interval, presence_threshold,
+            scheduler.period_us() / 1000.0f, scheduler.est_latency_us() / 1000.0f,
+            scheduler.est_capture_us() / 1000.0f, scheduler.est_dsp_us() / 1000.0f,
+            scheduler.est_classification_us() / 1000.0f, scheduler.est_post_us() / 1000.0f,
+            scheduler.est_actuate_us() / 1000.0f,
+            (unsigned)cascade.frames(), (unsigned)cascade.gated(), (unsigned)cascade.rechecks(),
+            (unsigned)cascade.misses(), (unsigned)cascade.gate_us(), (unsigned)cascade.full_us(),
+            (unsigned)EI_INFERENCE_REGION_BYTES, (unsigned)region_peak.load(), (unsigned)region_overflows.load(),
+            (unsigned)region_unfreed.load());
+        // "extra":[...] before the closing brace, one entry per extra impulse
+        size_t n = strlen(json) - 1;
+        for (int i = 0; i < extra_impulses.count() && n < sizeof(json); i++) {
+            const MultiImpulseRunner::Stats &es = extra_impulses.stats(i);
+            ExtraResult r = extra_results[i].read();
+            n += snprintf(json + n, sizeof(json) - n,
+                "%s{\"frame\":%u,\"label\":\"%s\",\"score\":%.2f,\"boxes\":%u,\"anomaly\":%.2f,"
+                "\"runs\":%u,\"errors\":%u,\"prep_us\":%u,\"dsp_us\":%u,\"nn_us\":%u}",
+                i ? "," : ",\"extra\":[", (unsigned)r.frame_id, r.label ? r.label : "none", r.score * 100,
+                (unsigned)r.boxes, r.anomaly, (unsigned)es.runs, (unsigned)es.errors, (unsigned)es.prep_us,
+                (unsigned)es.dsp_us, (unsigned)es.classification_us);
+        }
+        if (n < sizeof(json)) snprintf(json + n, sizeof(json) - n, extra_impulses.count() ? "]}" : "}");
         req->send(200, "application/json", json);
     });
 
+    // Server-sent events: gửi bản ghi hiện tại ngay khi trình duyệt kết nối
+    events.onConnect([](AsyncEventSourceClient *client){
+        std::lock_guard<std::mutex> lock(status_mutex);
+        client->send(status_record, "status", millis(), 2000);
+    });
+    server.addHandler(&events);
+
+    // Binary telemetry dump, see telemetry.h / host/telemetry_decode.cpp
+    // streamed from the ring in chunks; ends early (the decoder keeps the whole
+    // records it got) if the classify task laps a record not yet sent
+    server.on("/telemetry", HTTP_GET, [](AsyncWebServerRequest *req){
+        uint32_t first;
+        TelemetryHeader hdr = {};
+        hdr.magic = TELEMETRY_MAGIC;
+        hdr.record_size = sizeof(TelemetryRecord);
+        hdr.count = telemetry.snapshot(&first);
+        hdr.dropped = first;
+
+        AsyncWebServerResponse *res = req->beginChunkedResponse("application/octet-stream",
+            [hdr, first](uint8_t *buf, size_t max_len, size_t index) -> size_t {
+                size_t n = 0;
+                while (n < max_len) {
+                    size_t pos = index + n, len;
+                    const uint8_t *src;
+                    TelemetryRecord rec;
+                    if (pos < sizeof(hdr)) {
+                        src = (const uint8_t *)&hdr + pos;
+                        len = sizeof(hdr) - pos;
+                    } else {
+                        size_t k = (pos - sizeof(hdr)) / sizeof(rec), off = (pos - sizeof(hdr)) % sizeof(rec);
+                        if (k >= hdr.count || !telemetry.read(first + (uint32_t)k, &rec)) break;
+                        src = (const uint8_t *)&rec + off;
+                        len = sizeof(rec) - off;
+                    }
+                    if (len > max_len - n) len = max_len - n;
+                    memcpy(buf + n, src, len);
+                    n += len;
+                }
+                return n;
+            });
+        res->addHeader("Content-Disposition", "attachment; filename=telemetry.bin");
+        req->send(res);
+    });
+
+#if EIDSP_TRACK_ALLOCATIONS
+    // Allocation profile of the SDK (edge-impulse-sdk/dsp/ei_alloc_profiler.h,
+    // read by host/alloc_report.cpp); ?reset clears it after sending
+    server.on("/allocs", HTTP_GET, [](AsyncWebServerRequest *req){
+        AsyncResponseStream *res = req->beginResponseStream("application/json");
+        ei_alloc_profile_json([](const char *s, size_t len, void *ctx){
+            ((AsyncResponseStream *)ctx)->write((const uint8_t *)s, len);
+        }, res);
+        req->send(res);
+        if (req->hasParam("reset")) ei_alloc_profile_reset();
+    });
+#endif
+
+    server.on("/stream", HTTP_GET, [](AsyncWebServerRequest *req){
+        if (!shared_jpeg.add_viewer(STREAM_MAX_CLIENTS)) {
+            req->send(503, "text/plain", "Busy");
+            return;
+        }
+        auto st = std::make_shared<StreamState>();
+        AsyncWebServerResponse *res = req->beginChunkedResponse(
+            "multipart/x-mixed-replace;boundary=" STREAM_BOUNDARY,
+            [st](uint8_t *buf, size_t max_len, size_t) -> size_t { return stream_fill(*st, buf, max_len); });
+        req->send(res);
+    });
+
     server.on("/servo", HTTP_GET, [](AsyncWebServerRequest *req){
         if (req->hasParam("angle")) {
             int angle = req->getParam("angle")->value().toInt();
             if (angle >= 0 && angle <= 180) {
-                myservo.write(angle);
-                current_servo_angle = angle;
+                actuator.servo(angle);
+                detection.update([angle](DetectionState &st){ st.servo_angle = angle; });
+                publish_status();
             }
         }
         req->send(200, "text/plain", "OK");
@@ -318,12 +1004,18 @@ void setup() {
 
     server.on("/toggle", HTTP_GET, [](AsyncWebServerRequest *req){
         detection_running = !detection_running;
-        if (!detection_running) {
-            current_detection = "Stopped";
-            current_confidence = 0.0f;
-            myservo.write(90);
-            current_servo_angle = 90;
-        }
+        pipeline.set_paused(!detection_running);
+        bool running = detection_running;
+        if (!running) actuator.servo(90);
+        detection.update([running](DetectionState &st){
+            st.running = running;
+            if (!running) {
+                st.set_label("Stopped");
+                st.confidence = 0.0f;
+                st.servo_angle = 90;
+            }
+        });
+        publish_status();
         req->send(200, "text/plain", "OK");
     });
 
@@ -331,72 +1023,70 @@ void setup() {
         if (req->hasParam("ball_angle", true)) servo_ball_angle = req->getParam("ball_angle", true)->value().toInt();
         if (req->hasParam("box_angle", true)) servo_box_angle = req->getParam("box_angle", true)->value().toInt();
         if (req->hasParam("threshold", true)) confidence_threshold = req->getParam("threshold", true)->value().toFloat();
-        if (req->hasParam("delay", true)) detection_delay = req->getParam("delay", true)->value().toInt();
+        if (req->hasParam("delay", true)) detection_delay = setup_ms(req->getParam("delay", true)->value());
+        if (req->hasParam("deadline", true)) servo_deadline = setup_ms(req->getParam("deadline", true)->value());
+        if (req->hasParam("keyframe", true)) keyframe_interval = req->getParam("keyframe", true)->value().toInt();
+        if (req->hasParam("gate", true)) presence_threshold = req->getParam("gate", true)->value().toInt();
+        scheduler.configure(detection_delay, servo_deadline);
+        cascade.set_threshold(presence_threshold);
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+        keyframes.set_interval(keyframe_interval);
+#endif
+        publish_status();
         req->redirect("/");
     });
 
-    server.begin();
-    lcd.clear(); lcd.print("IP:"); lcd.setCursor(0,1); lcd.print(WiFi.localIP());
-}
-
-void loop() {
-    if (!detection_running) { delay(1000); return; }
-
-    snapshot_buf = (uint8_t*)malloc(EI_CAMERA_RAW_FRAME_BUFFER_COLS * EI_CAMERA_RAW_FRAME_BUFFER_ROWS * EI_CAMERA_FRAME_BYTE_SIZE);
-    if (!snapshot_buf) return;
+    // Model update: POST a model image (host/model_pack) as the raw body. It is
+    // validated while the current model keeps running, then swapped in between frames.
+    server.on("/model", HTTP_POST, [](AsyncWebServerRequest *req){
+        const char *err = models.error();
+        if (err) req->send(400, "text/plain", err);
+        else req->send(200, "text/plain", "OK");
+    }, nullptr, [](AsyncWebServerRequest *, uint8_t *data, size_t len, size_t index, size_t total){
+        if (index == 0 && !models.begin(total)) return;
+        if (!models.write(data, len)) return;
+        if (index + len == total) models.finish();
+    });
 
-    ei::signal_t signal;
-    signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
-    signal.get_data = &ei_camera_get_data;
+    server.on("/model", HTTP_GET, [](AsyncWebServerRequest *req){
+        char json[160];
+        const char *err = models.error();
+        snprintf(json, sizeof(json), "{\"active\":%u,\"pending\":%s,\"swaps\":%u,\"error\":\"%s\"}",
+                 (unsigned)models.active_id(), models.pending() ? "true" : "false",
+                 (unsigned)models.swaps(), err ? err : "");
+        req->send(200, "application/json", json);
+    });
 
-    if (!ei_camera_capture(EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT, snapshot_buf)) {
-        free(snapshot_buf); return;
-    }
+    // Back to the compiled-in model
+    server.on("/model/builtin", HTTP_POST, [](AsyncWebServerRequest *req){
+        models.request_builtin();
+        req->send(200, "text/plain", "OK");
+    });
 
-    ei_impulse_result_t result = {0};
-    if (run_classifier(&signal, &result, debug_nn) != EI_IMPULSE_OK) {
-        free(snapshot_buf); return;
+    String ip = WiFi.localIP().toString();
+    lcd.clear(); lcd.print("IP:"); lcd.setCursor(0,1); lcd.print(ip);
+    ActuatorDriver drv = {actuator_servo, actuator_lcd_cursor, actuator_lcd_write, nullptr};
+    if (!actuator.start(drv, ActuatorQueue::Config(), "IP:", ip.c_str())) {
+        lcd.clear(); lcd.print("Task loi!");
+        while(1) delay(1000);
     }
 
-#if EI_CLASSIFIER_OBJECT_DETECTION == 1
-    float max_value = 0.0f;
-    bool detected = false;
-    ei_impulse_result_bounding_box_t best_bb;
-
-    for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
-        auto bb = result.bounding_boxes[i];
-        if (bb.value > max_value && bb.value > confidence_threshold && (strcmp(bb.label, "ball")==0 || strcmp(bb.label, "box")==0)) {
-            max_value = bb.value;
-            best_bb = bb;
-            detected = true;
-        }
-    }
+    format_status(status_record, sizeof(status_record));
+    server.begin();
 
-    lcd.clear(); lcd.setCursor(0,0);
-    if (detected) {
-        current_detection = best_bb.label;
-        current_confidence = max_value;
-        if (strcmp(best_bb.label, "ball") == 0) {
-            myservo.write(servo_ball_angle);
-            current_servo_angle = servo_ball_angle;
-            lcd.print("Detected: Ball");
-        } else {
-            myservo.write(servo_box_angle);
-            current_servo_angle = servo_box_angle;
-            lcd.print("Detected: Box");
-        }
-        lcd.setCursor(0,1); lcd.print("Conf: "); lcd.print(max_value*100, 1); lcd.print("%");
-    } else {
-        current_detection = "No Object";
-        current_confidence = 0.0f;
-        myservo.write(90);
-        current_servo_angle = 90;
-        lcd.print("No Object");
-    }
+#ifdef EI_EXTRA_IMPULSE
+    extra_impulses.add(&EI_EXTRA_IMPULSE, extra_result, nullptr);
 #endif
+    scheduler.configure(detection_delay, servo_deadline);
+    if (!pipeline.start(&frame_pool, capture_frame, classify_frame, nullptr, &scheduler, FramePipeline::Config())) {
+        lcd.clear(); lcd.print("Task loi!");
+        while(1) delay(1000);
+    }
+}
 
-    free(snapshot_buf);
-    delay(detection_delay);
+void loop() {
+    // all work happens in the pipeline tasks started from setup()
+    delay(1000);
 }
 
 #if !defined(EI_CLASSIFIER_SENSOR) || EI_CLASSIFIER_SENSOR != EI_CLASSIFIER_SENSOR_CAMERA
@@ -4,6 +4,9 @@
 #include <random>
 #include <iomanip>
 #include <string>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 
 using namespace sc_core;
 
@@ -41,12 +44,33 @@ inline std::ostream& operator<<(std::ostream& os, const AIOut& o) {
     return os;
 }
 
+// -------------------- Benchmark: wall-clock time spent inside each module --------------------
+// Only the module's own work is timed (not the blocking fifo read/write), so the
+// remainder of the run is kernel scheduling + channel overhead.
+struct BusyClock {
+    bool enabled = false;
+    double seconds = 0.0;
+
+    struct Scope {
+        BusyClock& c;
+        std::chrono::steady_clock::time_point t0;
+        explicit Scope(BusyClock& clk) : c(clk) {
+            if (c.enabled) t0 = std::chrono::steady_clock::now();
+        }
+        ~Scope() {
+            if (c.enabled)
+                c.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        }
+    };
+};
+
 // -------------------- Stimulus: generate ground-truth samples --------------------
 SC_MODULE(Stimulus) {
     sc_fifo_out<Sample> out;
 
     int n_ball = 50;
     int n_box  = 50;
+    BusyClock busy;
 
     SC_CTOR(Stimulus) {
         SC_THREAD(gen);
@@ -55,12 +79,14 @@ SC_MODULE(Stimulus) {
     void gen() {
         int id = 0;
         for (int i = 0; i < n_ball; i++) {
-            Sample s; s.id = id++; s.gt = L_BALL;
+            Sample s;
+            { BusyClock::Scope t(busy); s.id = id++; s.gt = L_BALL; }
             out.write(s);
             wait(SC_ZERO_TIME); // no real time, just delta-cycle
         }
         for (int i = 0; i < n_box; i++) {
-            Sample s; s.id = id++; s.gt = L_BOX;
+            Sample s;
+            { BusyClock::Scope t(busy); s.id = id++; s.gt = L_BOX; }
             out.write(s);
             wait(SC_ZERO_TIME);
         }
@@ -83,13 +109,24 @@ SC_MODULE(AIModel) {
     std::uniform_real_distribution<float> uni{0.0f, 1.0f};
     std::normal_distribution<float> norm_correct;
     std::normal_distribution<float> norm_wrong;
+    BusyClock busy;
 
-    SC_CTOR(AIModel)
-        : rng(12345),
+    SC_HAS_PROCESS(AIModel);
+
+    // use_method: run as an SC_METHOD woken by fifo events instead of an SC_THREAD
+    AIModel(sc_module_name name, bool use_method = false)
+        : sc_module(name),
+          rng(12345),
           norm_correct(conf_correct_mu, conf_sigma),
           norm_wrong(conf_wrong_mu, conf_sigma)
     {
-        SC_THREAD(run);
+        if (use_method) {
+            SC_METHOD(run_method);
+            sensitive << in.data_written() << out.data_read();
+            dont_initialize();
+        } else {
+            SC_THREAD(run);
+        }
     }
 
     static float clamp01(float x) {
@@ -98,31 +135,44 @@ SC_MODULE(AIModel) {
         return x;
     }
 
+    AIOut infer(const Sample& s) {
+        BusyClock::Scope t(busy);
+
+        AIOut o;
+        o.id = s.id;
+        o.gt = s.gt;
+
+        bool correct = false;
+        if (s.gt == L_BALL) correct = (uni(rng) < p_correct_ball);
+        else if (s.gt == L_BOX) correct = (uni(rng) < p_correct_box);
+
+        if (correct) {
+            o.pred = s.gt;
+            o.conf = clamp01(norm_correct(rng));
+        } else {
+            // wrong prediction flips label
+            o.pred = (s.gt == L_BALL) ? L_BOX : L_BALL;
+            o.conf = clamp01(norm_wrong(rng));
+        }
+        return o;
+    }
+
     void run() {
         while (true) {
             Sample s = in.read();
-
-            AIOut o;
-            o.id = s.id;
-            o.gt = s.gt;
-
-            bool correct = false;
-            if (s.gt == L_BALL) correct = (uni(rng) < p_correct_ball);
-            else if (s.gt == L_BOX) correct = (uni(rng) < p_correct_box);
-
-            if (correct) {
-                o.pred = s.gt;
-                o.conf = clamp01(norm_correct(rng));
-            } else {
-                // wrong prediction flips label
-                o.pred = (s.gt == L_BALL) ? L_BOX : L_BALL;
-                o.conf = clamp01(norm_wrong(rng));
-            }
-
-            out.write(o);
+            out.write(infer(s));
             wait(SC_ZERO_TIME);
         }
     }
+
+    // Drain as much as both fifos allow, then sleep until one of them changes
+    void run_method() {
+        while (in.num_available() > 0 && out.num_free() > 0) {
+            Sample s;
+            in.nb_read(s);
+            out.nb_write(infer(s));
+        }
+    }
 };
 
 // -------------------- Decision + Servo mapping --------------------
@@ -154,37 +204,61 @@ SC_MODULE(DecisionServo) {
     int ball_angle = 45;
     int box_angle  = 0;
     int neutral_angle = 90;
+    BusyClock busy;
 
-    SC_CTOR(DecisionServo) {
-        SC_THREAD(run);
+    SC_HAS_PROCESS(DecisionServo);
+
+    DecisionServo(sc_module_name name, bool use_method = false)
+        : sc_module(name)
+    {
+        if (use_method) {
+            SC_METHOD(run_method);
+            sensitive << in.data_written() << out.data_read();
+            dont_initialize();
+        } else {
+            SC_THREAD(run);
+        }
     }
 
-    void run() {
-        while (true) {
-            AIOut o = in.read();
+    DecisionOut decide(const AIOut& o) {
+        BusyClock::Scope t(busy);
 
-            DecisionOut d;
-            d.id = o.id;
-            d.gt = o.gt;
-            d.pred = o.pred;
-            d.conf = o.conf;
-
-            // threshold gating
-            if (o.conf < threshold) {
-                d.decided = L_NONE;
-            } else {
-                d.decided = o.pred;
-            }
+        DecisionOut d;
+        d.id = o.id;
+        d.gt = o.gt;
+        d.pred = o.pred;
+        d.conf = o.conf;
 
-            // servo mapping
-            if (d.decided == L_BALL) d.servo_angle = ball_angle;
-            else if (d.decided == L_BOX) d.servo_angle = box_angle;
-            else d.servo_angle = neutral_angle;
+        // threshold gating
+        if (o.conf < threshold) {
+            d.decided = L_NONE;
+        } else {
+            d.decided = o.pred;
+        }
+
+        // servo mapping
+        if (d.decided == L_BALL) d.servo_angle = ball_angle;
+        else if (d.decided == L_BOX) d.servo_angle = box_angle;
+        else d.servo_angle = neutral_angle;
+
+        return d;
+    }
 
-            out.write(d);
+    void run() {
+        while (true) {
+            AIOut o = in.read();
+            out.write(decide(o));
             wait(SC_ZERO_TIME);
         }
     }
+
+    void run_method() {
+        while (in.num_available() > 0 && out.num_free() > 0) {
+            AIOut o;
+            in.nb_read(o);
+            out.nb_write(decide(o));
+        }
+    }
 };
 
 // -------------------- Scoreboard: accuracy + angle correctness + confusion matrix --------------------
@@ -206,15 +280,25 @@ SC_MODULE(Scoreboard) {
     int expect_ball_angle = 45;
     int expect_box_angle = 0;
 
+    int expected_total = 100;      // stop after this many samples
+    bool quiet = false;            // benchmark mode: no summary printout
+    BusyClock busy;
+
     int expected_angle_for(Label gt) {
         if (gt == L_BALL) return expect_ball_angle;
         if (gt == L_BOX)  return expect_box_angle;
         return 90;
     }
 
-    SC_CTOR(Scoreboard) {
-        csv.open("ai_servo_eval.csv");
-        csv << "id,gt,pred,conf,decided,servo_angle,decision_correct,angle_correct\n";
+    SC_HAS_PROCESS(Scoreboard);
+
+    Scoreboard(sc_module_name name, bool write_csv = true)
+        : sc_module(name)
+    {
+        if (write_csv) {
+            csv.open("ai_servo_eval.csv");
+            csv << "id,gt,pred,conf,decided,servo_angle,decision_correct,angle_correct\n";
+        }
         SC_THREAD(run);
     }
 
@@ -222,68 +306,109 @@ SC_MODULE(Scoreboard) {
         if (csv.is_open()) csv.close();
     }
 
-    void run() {
-        while (true) {
-            DecisionOut d = in.read();
-            total++;
+    void score(const DecisionOut& d) {
+        BusyClock::Scope t(busy);
+        total++;
 
-            bool decision_ok = (d.decided == d.gt);
-            bool angle_ok = (d.servo_angle == expected_angle_for(d.gt));
+        bool decision_ok = (d.decided == d.gt);
+        bool angle_ok = (d.servo_angle == expected_angle_for(d.gt));
 
-            if (d.decided == L_NONE) none_count++;
+        if (d.decided == L_NONE) none_count++;
 
-            if (decision_ok) correct_decision++;
-            if (angle_ok) correct_angle++;
+        if (decision_ok) correct_decision++;
+        if (angle_ok) correct_angle++;
 
-            // update confusion (only for gt ball/box)
-            int r = (d.gt == L_BALL) ? 0 : 1;
-            int c = (d.decided == L_BALL) ? 0 : (d.decided == L_BOX) ? 1 : 2;
-            cm[r][c]++;
+        // update confusion (only for gt ball/box)
+        int r = (d.gt == L_BALL) ? 0 : 1;
+        int c = (d.decided == L_BALL) ? 0 : (d.decided == L_BOX) ? 1 : 2;
+        cm[r][c]++;
 
+        if (csv.is_open()) {
             csv << d.id << "," << label_str(d.gt) << "," << label_str(d.pred) << ","
                 << std::fixed << std::setprecision(3) << d.conf << ","
                 << label_str(d.decided) << "," << d.servo_angle << ","
                 << (decision_ok ? 1 : 0) << "," << (angle_ok ? 1 : 0) << "\n";
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== SUMMARY ===\n";
+        std::cout << "Total samples: " << total << "\n";
+        std::cout << "Decision accuracy (decided==gt): "
+                  << (100.0 * correct_decision / total) << " %\n";
+        std::cout << "Angle correctness: "
+                  << (100.0 * correct_angle / total) << " %\n";
+        std::cout << "Decided NONE (below threshold): " << none_count << "\n\n";
+
+        std::cout << "Confusion Matrix (GT rows x DECIDED cols)\n";
+        std::cout << "          BALL    BOX    NONE\n";
+        std::cout << "GT=BALL   " << std::setw(5) << cm[0][0]
+                  << "  " << std::setw(5) << cm[0][1]
+                  << "  " << std::setw(5) << cm[0][2] << "\n";
+        std::cout << "GT=BOX    " << std::setw(5) << cm[1][0]
+                  << "  " << std::setw(5) << cm[1][1]
+                  << "  " << std::setw(5) << cm[1][2] << "\n";
+
+        if (csv.is_open()) std::cout << "\nCSV saved: ai_servo_eval.csv\n";
+    }
+
+    void run() {
+        while (true) {
+            DecisionOut d = in.read();
+            score(d);
 
             wait(SC_ZERO_TIME);
 
-            // Stop condition: when enough samples processed (example: 100)
-            if (total >= 100) {
-                std::cout << "\n=== SUMMARY ===\n";
-                std::cout << "Total samples: " << total << "\n";
-                std::cout << "Decision accuracy (decided==gt): "
-                          << (100.0 * correct_decision / total) << " %\n";
-                std::cout << "Angle correctness: "
-                          << (100.0 * correct_angle / total) << " %\n";
-                std::cout << "Decided NONE (below threshold): " << none_count << "\n\n";
-
-                std::cout << "Confusion Matrix (GT rows x DECIDED cols)\n";
-                std::cout << "          BALL    BOX    NONE\n";
-                std::cout << "GT=BALL   " << std::setw(5) << cm[0][0]
-                          << "  " << std::setw(5) << cm[0][1]
-                          << "  " << std::setw(5) << cm[0][2] << "\n";
-                std::cout << "GT=BOX    " << std::setw(5) << cm[1][0]
-                          << "  " << std::setw(5) << cm[1][1]
-                          << "  " << std::setw(5) << cm[1][2] << "\n";
-
-                std::cout << "\nCSV saved: ai_servo_eval.csv\n";
+            // Stop condition: when all generated samples are processed
+            if (total >= expected_total) {
+                if (!quiet) print_summary();
                 sc_stop();
             }
         }
     }
 };
 
+// -------------------- Command line --------------------
+// Default run reproduces the 100-sample evaluation + ai_servo_eval.csv.
+// Benchmark mode (nightly sweeps, see bench_systemc.sh):
+//   --bench            no CSV/summary, print one "BENCH ..." line with kernel stats
+//   --samples N        total samples (half ball, half box)
+//   --depth D          sc_fifo depth of q0/q1/q2 (default 16)
+//   --method           run AIModel/DecisionServo as SC_METHODs instead of SC_THREADs
+struct RunConfig {
+    bool bench = false;
+    long samples = 100;
+    int depth = 16;
+    bool use_method = false;
+};
+
+static RunConfig parse_args(int argc, char** argv) {
+    RunConfig cfg;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--bench")) cfg.bench = true;
+        else if (!std::strcmp(argv[i], "--method")) cfg.use_method = true;
+        else if (!std::strcmp(argv[i], "--samples") && i + 1 < argc) cfg.samples = std::atol(argv[++i]);
+        else if (!std::strcmp(argv[i], "--depth") && i + 1 < argc) cfg.depth = std::atoi(argv[++i]);
+        else std::cerr << "Ignoring unknown argument: " << argv[i] << "\n";
+    }
+    if (cfg.samples < 1) cfg.samples = 1;
+    if (cfg.depth < 1) cfg.depth = 1;
+    return cfg;
+}
+
 int sc_main(int argc, char** argv) {
+    RunConfig cfg = parse_args(argc, argv);
+
     // Channels
-    sc_fifo<Sample>      q0("q0", 16);
-    sc_fifo<AIOut>       q1("q1", 16);
-    sc_fifo<DecisionOut> q2("q2", 16);
+    sc_fifo<Sample>      q0("q0", cfg.depth);
+    sc_fifo<AIOut>       q1("q1", cfg.depth);
+    sc_fifo<DecisionOut> q2("q2", cfg.depth);
 
     // Modules
     Stimulus     stim("stim");
-    AIModel      ai("ai");
-    DecisionServo ds("ds");
-    Scoreboard   sb("sb");
+    AIModel      ai("ai", cfg.use_method);
+    DecisionServo ds("ds", cfg.use_method);
+    Scoreboard   sb("sb", !cfg.bench);
 
     // Connect
     stim.out(q0);
@@ -300,8 +425,36 @@ int sc_main(int argc, char** argv) {
     sb.expect_ball_angle = 45;
     sb.expect_box_angle  = 0;
 
+    stim.n_ball = (int)(cfg.samples / 2);
+    stim.n_box  = (int)(cfg.samples - cfg.samples / 2);
+    sb.expected_total = (int)cfg.samples;
+    sb.quiet = cfg.bench;
+
+    stim.busy.enabled = ai.busy.enabled = ds.busy.enabled = sb.busy.enabled = cfg.bench;
+
     // Run (no real-time)
+    auto t0 = std::chrono::steady_clock::now();
     sc_start();
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    if (cfg.bench) {
+        double modules = stim.busy.seconds + ai.busy.seconds + ds.busy.seconds + sb.busy.seconds;
+        double deltas = (double)sc_delta_count();
+        std::cout << std::fixed << std::setprecision(6)
+                  << "BENCH samples=" << cfg.samples
+                  << " depth=" << cfg.depth
+                  << " proc=" << (cfg.use_method ? "method" : "thread")
+                  << " wall_s=" << wall
+                  << " samples_per_s=" << std::setprecision(0) << (cfg.samples / wall)
+                  << " deltas=" << (long long)deltas
+                  << " deltas_per_sample=" << std::setprecision(3) << (deltas / cfg.samples)
+                  << std::setprecision(6)
+                  << " stim_s=" << stim.busy.seconds
+                  << " ai_s=" << ai.busy.seconds
+                  << " ds_s=" << ds.busy.seconds
+                  << " sb_s=" << sb.busy.seconds
+                  << " kernel_s=" << (wall - modules) << "\n";
+    }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,393 @@
+#include <systemc>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace sc_core;
+
+// Timed model of the ESP32-CAM firmware (Esp32CAM.cpp) running on the two
+// Xtensa cores: which task runs where, at what priority, and how much PSRAM
+// traffic each pipeline stage generates. Used to predict frame rate and
+// capture->servo latency for a given task mapping / web load before touching
+// the firmware.
+//
+//   ./SystemC_DualCore                         (firmware today: everything in loop() on core 1)
+//   ./SystemC_DualCore --mapping split         (capture/decode on core 0, inference on core 1)
+//   ./SystemC_DualCore --clients 4 --seconds 60 --delay-ms 0
+
+// -------------------- Cost model --------------------
+// Per-frame estimates for QVGA JPEG -> 96x96 FOMO at 240 MHz. Calibrate against
+// on-device measurements (result.timing and the stage timers in the firmware).
+struct StageCost {
+    const char* name;
+    double cpu_us;          // pure compute time on one core
+    double psram_bytes;     // PSRAM traffic issued while computing (core stalls on it)
+};
+
+struct CostModel {
+    StageCost capture  = {"capture",    300.0,      0.0};   // esp_camera_fb_get bookkeeping
+    StageCost decode   = {"decode",   45000.0, 245760.0};   // fmt2rgb888: JPEG -> 320x240x3
+    StageCost resize   = {"resize",    6000.0, 230400.0};   // crop_and_interpolate_rgb888 -> 96x96
+    StageCost dsp      = {"dsp",       1500.0,  27648.0};   // RGB -> grayscale features
+    StageCost infer    = {"infer",   110000.0, 1800000.0};  // FOMO, tensor arena in PSRAM
+    StageCost post     = {"post",       800.0,      0.0};   // FOMO blob -> bounding boxes
+    StageCost actuate  = {"actuate",   4500.0,      0.0};   // servo write + LCD over I2C (busy-wait)
+    StageCost web_req  = {"web",       1800.0,   4096.0};   // AsyncTCP /data handler + JSON
+    StageCost tcpip    = {"tcpip",      400.0,   2048.0};   // lwIP/WiFi per request
+
+    double frame_period_us   = 40000.0;   // sensor at ~25 fps (QVGA, 10 MHz XCLK)
+    double jpeg_bytes        = 15000.0;   // DMA write of one JPEG frame
+    double psram_bytes_per_us = 40.0;     // effective quad-SPI PSRAM bandwidth (~40 MB/s)
+    double psram_burst_bytes = 4096.0;    // arbitration granularity
+    double tick_us           = 1000.0;    // FreeRTOS tick: preemption granularity
+};
+
+struct Frame {
+    int id = 0;
+    sc_time t_capture;      // sensor timestamp
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Frame& f) {
+    os << "Frame{id=" << f.id << ",t=" << f.t_capture.to_seconds() << "}";
+    return os;
+}
+
+// -------------------- PSRAM: one shared bus, FIFO arbitration per burst --------------------
+struct PsramBus {
+    const CostModel& cm;
+    bool busy = false;
+    std::deque<sc_event*> waiting;
+
+    double bytes = 0.0;
+    sc_time busy_time;
+    sc_time wait_time;
+
+    explicit PsramBus(const CostModel& c) : cm(c) {}
+
+    void transfer(double n) {
+        while (n > 0.0) {
+            double burst = std::min(n, cm.psram_burst_bytes);
+            sc_time t0 = sc_time_stamp();
+            if (busy) {
+                sc_event ev;
+                waiting.push_back(&ev);
+                wait(ev);               // bus handed over by the previous owner
+            }
+            busy = true;
+            wait_time += sc_time_stamp() - t0;
+
+            sc_time d(burst / cm.psram_bytes_per_us, SC_US);
+            wait(d);
+            busy_time += d;
+            bytes += burst;
+            n -= burst;
+
+            if (waiting.empty()) {
+                busy = false;
+            } else {
+                sc_event* next = waiting.front();
+                waiting.pop_front();
+                next->notify(SC_ZERO_TIME);
+            }
+        }
+    }
+};
+
+// -------------------- CPU core: fixed-priority, time-sliced at the tick --------------------
+// Higher prio wins; equal prio round-robins each tick (FreeRTOS semantics).
+// A running task is only preempted at tick boundaries.
+struct CpuCore {
+    struct Waiter { int prio; unsigned long seq; sc_event* ev; };
+
+    int id;
+    const CostModel& cm;
+    PsramBus& psram;
+    bool busy = false;
+    std::vector<Waiter> waiting;
+    unsigned long seq = 0;
+
+    sc_time busy_time;
+
+    CpuCore(int core_id, const CostModel& c, PsramBus& bus) : id(core_id), cm(c), psram(bus) {}
+
+    void acquire(int prio) {
+        if (!busy) { busy = true; return; }
+        sc_event ev;
+        waiting.push_back({prio, seq++, &ev});
+        wait(ev);                       // core handed over in release()
+    }
+
+    void release() {
+        if (waiting.empty()) { busy = false; return; }
+        auto best = waiting.begin();
+        for (auto it = waiting.begin(); it != waiting.end(); ++it) {
+            if (it->prio > best->prio || (it->prio == best->prio && it->seq < best->seq)) best = it;
+        }
+        sc_event* ev = best->ev;
+        waiting.erase(best);
+        ev->notify(SC_ZERO_TIME);
+    }
+
+    bool should_yield(int prio) const {
+        for (const auto& w : waiting) if (w.prio >= prio) return true;
+        return false;
+    }
+
+    // Run one stage: compute in tick-sized slices, each followed by its share of
+    // PSRAM traffic. The core stays held while stalled on PSRAM.
+    void execute(int prio, const StageCost& s) {
+        double remaining = s.cpu_us;
+        double bytes_per_us = (s.cpu_us > 0.0) ? s.psram_bytes / s.cpu_us : 0.0;
+        acquire(prio);
+        while (remaining > 0.0) {
+            double slice = std::min(remaining, cm.tick_us);
+            sc_time t0 = sc_time_stamp();
+            wait(sc_time(slice, SC_US));
+            if (bytes_per_us > 0.0) psram.transfer(slice * bytes_per_us);
+            busy_time += sc_time_stamp() - t0;
+            remaining -= slice;
+            if (remaining > 0.0 && should_yield(prio)) {
+                release();
+                acquire(prio);
+            }
+        }
+        release();
+    }
+};
+
+// -------------------- Camera: DMA into fb_count PSRAM buffers, CAMERA_GRAB_LATEST --------------------
+SC_MODULE(CameraSensor) {
+    const CostModel* cm = nullptr;
+    PsramBus* psram = nullptr;
+    int fb_count = 2;
+
+    std::deque<Frame> fbs;
+    sc_event frame_ready;
+    int produced = 0;
+    int dropped = 0;
+
+    SC_CTOR(CameraSensor) {
+        SC_THREAD(run);
+    }
+
+    void run() {
+        while (true) {
+            wait(sc_time(cm->frame_period_us, SC_US));
+            Frame f;
+            f.id = produced++;
+            f.t_capture = sc_time_stamp();
+            psram->transfer(cm->jpeg_bytes);
+            if ((int)fbs.size() >= fb_count) { fbs.pop_front(); dropped++; }
+            fbs.push_back(f);
+            frame_ready.notify(SC_ZERO_TIME);
+        }
+    }
+
+    // esp_camera_fb_get(): blocks for a frame, returns the newest one
+    Frame get() {
+        while (fbs.empty()) wait(frame_ready);
+        Frame f = fbs.back();
+        dropped += (int)fbs.size() - 1;
+        fbs.clear();
+        return f;
+    }
+};
+
+// -------------------- Pipeline task: a FreeRTOS task pinned to a core --------------------
+// Runs a list of stages per frame. Source is either the camera or an upstream
+// queue; sink is either a downstream queue or the latency scoreboard.
+SC_MODULE(PipelineTask) {
+    sc_port<sc_fifo_in_if<Frame>, 1, SC_ZERO_OR_MORE_BOUND>  in;
+    sc_port<sc_fifo_out_if<Frame>, 1, SC_ZERO_OR_MORE_BOUND> out;
+
+    CameraSensor* camera = nullptr;     // set when this task captures
+    CpuCore* core = nullptr;
+    int prio = 1;
+    std::vector<const StageCost*> stages;
+    double delay_ms = 0.0;              // delay(detection_delay) at the end of the loop
+
+    std::vector<double> latency_us;     // filled when this is the last task
+    int frames = 0;
+
+    SC_CTOR(PipelineTask) {
+        SC_THREAD(run);
+    }
+
+    void run() {
+        while (true) {
+            Frame f = camera ? camera->get() : in->read();
+            for (const StageCost* s : stages) core->execute(prio, *s);
+            frames++;
+            if (out.size() > 0) {
+                out->write(f);
+            } else {
+                latency_us.push_back((sc_time_stamp() - f.t_capture).to_seconds() * 1e6);
+            }
+            if (delay_ms > 0.0) wait(sc_time(delay_ms, SC_MS));
+        }
+    }
+};
+
+// -------------------- Web load: N browser tabs polling /data at 1 Hz --------------------
+SC_MODULE(WebLoad) {
+    CpuCore* tcpip_core = nullptr;      // lwIP/WiFi task
+    CpuCore* async_core = nullptr;      // AsyncTCP task
+    const CostModel* cm = nullptr;
+    int clients = 1;
+    int tcpip_prio = 18;
+    int async_prio = 3;
+
+    sc_fifo<sc_time> requests;
+    std::vector<double> response_us;
+
+    SC_CTOR(WebLoad) : requests("requests", 64) {
+        SC_THREAD(clients_run);
+        SC_THREAD(server_run);
+    }
+
+    void clients_run() {
+        if (clients <= 0) return;
+        // clients poll at 1 Hz with evenly spread phases
+        sc_time step(1e6 / clients, SC_US);
+        while (true) {
+            for (int i = 0; i < clients; i++) {
+                wait(step);
+                requests.write(sc_time_stamp());
+            }
+        }
+    }
+
+    void server_run() {
+        while (true) {
+            sc_time t_req = requests.read();
+            tcpip_core->execute(tcpip_prio, cm->tcpip);
+            async_core->execute(async_prio, cm->web_req);
+            tcpip_core->execute(tcpip_prio, cm->tcpip);
+            response_us.push_back((sc_time_stamp() - t_req).to_seconds() * 1e6);
+        }
+    }
+};
+
+// -------------------- Command line --------------------
+//   --mapping serial|split   serial: loop() on core 1 does everything (current firmware)
+//                            split:  capture..dsp on core 0, infer..actuate on core 1
+//   --clients N              browser tabs polling /data (default 1)
+//   --web-core C             core running AsyncTCP (default 1)
+//   --delay-ms D             detection_delay after each loop iteration (default 1000)
+//   --seconds S              simulated time (default 30)
+struct RunConfig {
+    bool split = false;
+    int clients = 1;
+    int web_core = 1;
+    double delay_ms = 1000.0;
+    double seconds = 30.0;
+};
+
+static RunConfig parse_args(int argc, char** argv) {
+    RunConfig cfg;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--mapping") && i + 1 < argc) cfg.split = !std::strcmp(argv[++i], "split");
+        else if (!std::strcmp(argv[i], "--clients") && i + 1 < argc) cfg.clients = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--web-core") && i + 1 < argc) cfg.web_core = std::atoi(argv[++i]) ? 1 : 0;
+        else if (!std::strcmp(argv[i], "--delay-ms") && i + 1 < argc) cfg.delay_ms = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--seconds") && i + 1 < argc) cfg.seconds = std::atof(argv[++i]);
+        else std::cerr << "Ignoring unknown argument: " << argv[i] << "\n";
+    }
+    if (cfg.seconds <= 0.0) cfg.seconds = 1.0;
+    return cfg;
+}
+
+static double mean(const std::vector<double>& v) {
+    if (v.empty()) return 0.0;
+    double s = 0.0;
+    for (double x : v) s += x;
+    return s / v.size();
+}
+
+static double percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t ix = (size_t)(p * (v.size() - 1) + 0.5);
+    return v[ix];
+}
+
+int sc_main(int argc, char** argv) {
+    RunConfig cfg = parse_args(argc, argv);
+    CostModel cm;
+
+    PsramBus psram(cm);
+    CpuCore core0(0, cm, psram);
+    CpuCore core1(1, cm, psram);
+    CpuCore* cores[2] = {&core0, &core1};
+
+    CameraSensor cam("cam");
+    cam.cm = &cm;
+    cam.psram = &psram;
+
+    sc_fifo<Frame> q("q", 1);
+    PipelineTask front("front");
+    PipelineTask* back = nullptr;
+
+    front.camera = &cam;
+    if (cfg.split) {
+        // capture task on core 0 hands preprocessed frames to the inference task on core 1
+        front.core = &core0;
+        front.prio = 2;
+        front.stages = {&cm.capture, &cm.decode, &cm.resize, &cm.dsp};
+        front.out(q);
+
+        back = new PipelineTask("back");
+        back->in(q);
+        back->core = &core1;
+        back->prio = 1;
+        back->stages = {&cm.infer, &cm.post, &cm.actuate};
+        back->delay_ms = cfg.delay_ms;
+    } else {
+        // Arduino loopTask: core 1, priority 1, everything in sequence
+        front.core = &core1;
+        front.prio = 1;
+        front.stages = {&cm.capture, &cm.decode, &cm.resize, &cm.dsp,
+                        &cm.infer, &cm.post, &cm.actuate};
+        front.delay_ms = cfg.delay_ms;
+    }
+
+    WebLoad web("web");
+    web.cm = &cm;
+    web.clients = cfg.clients;
+    web.tcpip_core = &core0;
+    web.async_core = cores[cfg.web_core];
+
+    sc_start(sc_time(cfg.seconds, SC_SEC));
+
+    PipelineTask& sink = back ? *back : front;
+    double sim_s = sc_time_stamp().to_seconds();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== DUAL-CORE MODEL (" << (cfg.split ? "split" : "serial")
+              << ", clients=" << cfg.clients << ", web core=" << cfg.web_core
+              << ", delay=" << cfg.delay_ms << " ms) ===\n";
+    std::cout << "Simulated time:        " << sim_s << " s\n";
+    std::cout << "Frames sorted:         " << sink.frames << "  (" << (sink.frames / sim_s) << " fps)\n";
+    std::cout << "Sensor frames dropped: " << cam.dropped << " / " << cam.produced << "\n";
+    std::cout << "Latency capture->servo [ms]: mean " << mean(sink.latency_us) / 1000.0
+              << "  p50 " << percentile(sink.latency_us, 0.50) / 1000.0
+              << "  p95 " << percentile(sink.latency_us, 0.95) / 1000.0
+              << "  max " << percentile(sink.latency_us, 1.00) / 1000.0 << "\n";
+    std::cout << "Web /data response [ms]:     p50 " << percentile(web.response_us, 0.50) / 1000.0
+              << "  p95 " << percentile(web.response_us, 0.95) / 1000.0 << "\n";
+    for (CpuCore* c : cores) {
+        std::cout << "Core " << c->id << " utilisation:    "
+                  << (100.0 * c->busy_time.to_seconds() / sim_s) << " %\n";
+    }
+    std::cout << "PSRAM utilisation:     " << (100.0 * psram.busy_time.to_seconds() / sim_s) << " %"
+              << "  (" << (psram.bytes / sim_s / 1e6) << " MB/s, contention wait "
+              << (psram.wait_time.to_seconds() * 1000.0) << " ms)\n";
+
+    delete back;
+    return 0;
+}
@@ -0,0 +1,172 @@
+#ifndef ACTUATOR_QUEUE_H
+#define ACTUATOR_QUEUE_H
+
+// Servo and LCD writes moved off the inference path. Producers (classify task,
+// web handlers) only post the state they want; a low-priority task applies it:
+//
+//  - servo: latest angle wins, written only when it differs from the last one
+//  - LCD:   the wanted 16x2 text is diffed against what is on the glass and
+//           only changed characters are sent, at most every `lcd_interval_ms`
+//
+// Posting never touches I2C, so it costs a mutex and a memcpy.
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <string.h>
+#include "sorter_hal.h"
+
+#define ACTUATOR_LCD_COLS 16
+#define ACTUATOR_LCD_ROWS 2
+
+struct ActuatorDriver {
+    void (*servo_write)(int angle, void *ctx);
+    void (*lcd_set_cursor)(uint8_t col, uint8_t row, void *ctx);
+    void (*lcd_write)(const char *s, uint8_t n, void *ctx);
+    void *ctx;
+};
+
+class ActuatorQueue {
+public:
+    struct Config {
+        uint32_t lcd_interval_ms = 200;
+        int prio = 1;               // lowest application priority
+        int core = 0;               // next to capture, away from inference
+        uint32_t stack = 4 * 1024;
+    };
+
+    // `shown` is what the display holds right now (e.g. from setup()).
+    bool start(const ActuatorDriver &drv, const Config &cfg, const char *shown0 = "", const char *shown1 = "") {
+        drv_ = drv;
+        cfg_ = cfg;
+        set_text(shown_[0], shown0);
+        set_text(shown_[1], shown1);
+        memcpy(want_, shown_, sizeof(want_));
+        return hal_task_start(&ActuatorQueue::task, this, "actuator", cfg.stack, cfg.prio, cfg.core);
+    }
+
+    void servo(int angle) {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (servo_pending_) coalesced_++;
+            servo_want_ = angle;
+            servo_pending_ = true;
+            posted_++;
+        }
+        wake_.give();
+    }
+
+    // One call per screen; rows are padded/truncated to the display width.
+    void lcd(const char *row0, const char *row1) {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (lcd_pending_) coalesced_++;
+            set_text(want_[0], row0);
+            set_text(want_[1], row1);
+            lcd_pending_ = true;
+            posted_++;
+        }
+        wake_.give();
+    }
+
+    uint32_t posted() const { return posted_.load(); }
+    uint32_t coalesced() const { return coalesced_.load(); }    // replaced before they were applied
+    uint32_t servo_writes() const { return servo_writes_.load(); }
+    uint32_t lcd_chars() const { return lcd_chars_.load(); }     // characters actually sent
+    uint32_t lcd_updates() const { return lcd_updates_.load(); }
+
+private:
+    static void task(void *arg) { static_cast<ActuatorQueue *>(arg)->loop(); }
+
+    static void set_text(char *row, const char *s) {
+        size_t n = strlen(s);
+        if (n > ACTUATOR_LCD_COLS) n = ACTUATOR_LCD_COLS;
+        memcpy(row, s, n);
+        memset(row + n, ' ', ACTUATOR_LCD_COLS - n);
+    }
+
+    void loop() {
+        uint32_t last_lcd_us = hal_micros() - cfg_.lcd_interval_ms * 1000u;
+        uint32_t wait_ms = 1000;
+        for (;;) {
+            wake_.take(wait_ms);
+            wait_ms = 1000;
+
+            int angle = 0;
+            bool do_servo = false, do_lcd = false;
+            char want[ACTUATOR_LCD_ROWS][ACTUATOR_LCD_COLS];
+            uint32_t since_lcd_us = hal_micros() - last_lcd_us;
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                if (servo_pending_) {
+                    do_servo = true;
+                    angle = servo_want_;
+                    servo_pending_ = false;
+                }
+                if (lcd_pending_) {
+                    if (since_lcd_us >= cfg_.lcd_interval_ms * 1000u) {
+                        do_lcd = true;
+                        memcpy(want, want_, sizeof(want));
+                        lcd_pending_ = false;
+                    } else {
+                        wait_ms = (cfg_.lcd_interval_ms * 1000u - since_lcd_us) / 1000u + 1;
+                    }
+                }
+            }
+
+            if (do_servo && angle != servo_shown_) {
+                drv_.servo_write(angle, drv_.ctx);
+                servo_shown_ = angle;
+                servo_writes_++;
+            }
+            if (do_lcd) {
+                for (uint8_t row = 0; row < ACTUATOR_LCD_ROWS; row++) flush_row(row, want[row]);
+                last_lcd_us = hal_micros();
+                lcd_updates_++;
+            }
+        }
+    }
+
+    // Sends the changed runs of one row. Runs one unchanged character apart are
+    // merged: re-sending it costs the same as another set-cursor command.
+    void flush_row(uint8_t row, const char *want) {
+        char *shown = shown_[row];
+        uint8_t col = 0;
+        while (col < ACTUATOR_LCD_COLS) {
+            if (want[col] == shown[col]) { col++; continue; }
+            uint8_t end = col + 1;
+            while (end < ACTUATOR_LCD_COLS) {
+                if (want[end] != shown[end]) { end++; continue; }
+                if (end + 1 < ACTUATOR_LCD_COLS && want[end + 1] != shown[end + 1]) { end += 2; continue; }
+                break;
+            }
+            drv_.lcd_set_cursor(col, row, drv_.ctx);
+            drv_.lcd_write(want + col, end - col, drv_.ctx);
+            memcpy(shown + col, want + col, end - col);
+            lcd_chars_ += end - col;
+            col = end;
+        }
+    }
+
+    ActuatorDriver drv_ = {};
+    Config cfg_;
+    HalSignal wake_;
+    std::mutex mtx_;
+
+    // producer side, under mtx_
+    int servo_want_ = 90;
+    bool servo_pending_ = false;
+    char want_[ACTUATOR_LCD_ROWS][ACTUATOR_LCD_COLS];
+    bool lcd_pending_ = false;
+    std::atomic<uint32_t> posted_{0};
+    std::atomic<uint32_t> coalesced_{0};
+
+    // actuator task only
+    int servo_shown_ = -1;
+    char shown_[ACTUATOR_LCD_ROWS][ACTUATOR_LCD_COLS];
+    std::atomic<uint32_t> servo_writes_{0};
+    std::atomic<uint32_t> lcd_chars_{0};
+    std::atomic<uint32_t> lcd_updates_{0};
+};
+
+#endif // ACTUATOR_QUEUE_H
@@ -0,0 +1,127 @@
+#ifndef BAND_RESIZE_H
+#define BAND_RESIZE_H
+
+// Centre crop + bilinear resize of an RGB888 image that arrives in decoder
+// blocks (the MCUs of esp_jpg_decode(), left to right, band by band) into a
+// BGR888 frame. The result is bit-exact with fmt2rgb888() followed by
+// ei::image::processing::crop_and_interpolate_rgb888() on the whole frame,
+// but only BAND_RESIZE_ROWS rows of the crop are kept (scratch_bytes()), so
+// the full decoded frame never exists.
+//
+//   begin(320, 240, 96, 96, out, scratch) -> block(x, y, w, h, rgb) ... -> done()
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BAND_RESIZE_ROWS 32     // ring of crop rows: a decoder band (<= 16) and the rows above it
+
+class BandResizer {
+public:
+    static size_t scratch_bytes(int src_w, int src_h, int dst_w, int dst_h) {
+        int cw, ch;
+        crop_dims(src_w, src_h, dst_w, dst_h, &cw, &ch);
+        return (size_t)cw * 3 * BAND_RESIZE_ROWS;
+    }
+
+    bool begin(int src_w, int src_h, int dst_w, int dst_h, uint8_t *dst, uint8_t *scratch) {
+        crop_dims(src_w, src_h, dst_w, dst_h, &cw_, &ch_);
+        if (cw_ < 2 || ch_ < 2 || dst_w < 1 || dst_h < 1 || !dst || !scratch) return false;
+        src_w_ = src_w;
+        ox_ = (src_w - cw_) / 2;
+        oy_ = (src_h - ch_) / 2;
+        dst_ = dst;
+        dst_w_ = dst_w;
+        dst_h_ = dst_h;
+        ring_ = scratch;
+        x_step_ = (uint32_t)(cw_ * FRAC_VAL) / dst_w;
+        y_step_ = (uint32_t)(ch_ * FRAC_VAL) / dst_h;
+        rows_ = 0;
+        next_y_ = 0;
+        return true;
+    }
+
+    // Source pixels [x, x + w) x [y, y + h), R, G, B, rows packed.
+    bool block(int x, int y, int w, int h, const uint8_t *rgb) {
+        if (h >= BAND_RESIZE_ROWS) return false;
+        int c0 = x - ox_ < 0 ? 0 : x - ox_;
+        int c1 = x + w - ox_ > cw_ ? cw_ : x + w - ox_;
+        int oldest = next_y_ < dst_h_ ? (int)((next_y_ * y_step_) >> FRAC_BITS) : ch_;
+        for (int r = 0; r < h; r++) {
+            int cy = y + r - oy_;
+            if (cy < 0 || cy >= ch_) continue;
+            if (cy - BAND_RESIZE_ROWS >= oldest) return false;     // would overwrite a row still needed
+            uint8_t *d = ring_ + (size_t)(cy % BAND_RESIZE_ROWS) * cw_ * 3;
+            const uint8_t *s = rgb + ((size_t)r * w + (c0 + ox_ - x)) * 3;
+            for (int cx = c0; cx < c1; cx++, s += 3) {
+                d[cx * 3] = s[2];
+                d[cx * 3 + 1] = s[1];
+                d[cx * 3 + 2] = s[0];
+            }
+        }
+        if (x + w >= src_w_) {      // band complete
+            int rows = y + h - oy_;
+            rows_ = rows < 0 ? 0 : rows > ch_ ? ch_ : rows;
+            emit();
+        }
+        return true;
+    }
+
+    bool done() const { return next_y_ == dst_h_; }
+
+private:
+    static const int FRAC_BITS = 14;    // as resize_image()
+    static const uint32_t FRAC_VAL = 1u << FRAC_BITS;
+    static const uint32_t FRAC_MASK = FRAC_VAL - 1;
+
+    // calculate_crop_dims(): the smaller side is kept
+    static void crop_dims(int src_w, int src_h, int dst_w, int dst_h, int *cw, int *ch) {
+        if (src_w > src_h) {
+            *cw = (int)((uint32_t)(dst_w * src_h) / dst_h);
+            *ch = src_h;
+        } else {
+            *ch = (int)((uint32_t)(dst_h * src_w) / dst_w);
+            *cw = src_w;
+        }
+    }
+
+    // Output rows whose two source rows have arrived. The bottom / right
+    // neighbours are clamped to the crop, where the in-place original would
+    // read past it (not reached when downscaling 240 -> 96).
+    void emit() {
+        while (next_y_ < dst_h_) {
+            uint32_t y_accum = next_y_ * y_step_;
+            int ty = (int)(y_accum >> FRAC_BITS);
+            int ty1 = ty + 1 < ch_ ? ty + 1 : ch_ - 1;
+            if (ty1 >= rows_) return;
+            const uint32_t y_frac = y_accum & FRAC_MASK, ny_frac = FRAC_VAL - y_frac;
+            const uint8_t *s0 = ring_ + (size_t)(ty % BAND_RESIZE_ROWS) * cw_ * 3;
+            const uint8_t *s1 = ring_ + (size_t)(ty1 % BAND_RESIZE_ROWS) * cw_ * 3;
+            uint8_t *d = dst_ + (size_t)next_y_ * dst_w_ * 3;
+            uint32_t x_accum = 0;
+            for (int x = 0; x < dst_w_; x++, x_accum += x_step_) {
+                int tx = (int)(x_accum >> FRAC_BITS);
+                int tx1 = tx + 1 < cw_ ? tx + 1 : cw_ - 1;
+                const uint32_t x_frac = x_accum & FRAC_MASK, nx_frac = FRAC_VAL - x_frac;
+                for (int c = 0; c < 3; c++) {
+                    uint32_t p00 = s0[tx * 3 + c], p10 = s0[tx1 * 3 + c];
+                    uint32_t p01 = s1[tx * 3 + c], p11 = s1[tx1 * 3 + c];
+                    p00 = ((p00 * nx_frac) + (p10 * x_frac) + FRAC_VAL / 2) >> FRAC_BITS;
+                    p01 = ((p01 * nx_frac) + (p11 * x_frac) + FRAC_VAL / 2) >> FRAC_BITS;
+                    *d++ = (uint8_t)(((p00 * ny_frac) + (p01 * y_frac) + FRAC_VAL / 2) >> FRAC_BITS);
+                }
+            }
+            next_y_++;
+        }
+    }
+
+    int src_w_ = 0, ox_ = 0, oy_ = 0;
+    int cw_ = 0, ch_ = 0;               // crop
+    int dst_w_ = 0, dst_h_ = 0;
+    uint8_t *dst_ = nullptr;
+    uint8_t *ring_ = nullptr;           // crop row r at (r % BAND_RESIZE_ROWS), B, G, R
+    uint32_t x_step_ = 0, y_step_ = 0;
+    int rows_ = 0;                      // crop rows [0, rows_) have arrived
+    int next_y_ = 0;                    // next output row
+};
+
+#endif // BAND_RESIZE_H
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Nightly sweep of the SystemC model: sample count x fifo depth x process kind.
+# Usage: ./bench_systemc.sh [path/to/systemc_binary]   (results -> bench_output.txt)
+BIN=${1:-./SystemC}
+OUT=bench_output.txt
+
+: > "$OUT"
+for n in 1000 10000 100000 1000000 10000000; do
+    for depth in 1 4 16 64 256; do
+        for proc in thread method; do
+            flag=""
+            [ "$proc" = method ] && flag="--method"
+            "$BIN" --bench --samples "$n" --depth "$depth" $flag | grep '^BENCH' | tee -a "$OUT"
+        done
+    done
+done
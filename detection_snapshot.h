@@ -0,0 +1,79 @@
+#ifndef DETECTION_SNAPSHOT_H
+#define DETECTION_SNAPSHOT_H
+
+// Latest detection, shared between the classify task (writer) and the
+// AsyncTCP handlers (readers) through a sequence lock:
+//  - readers never block and retry only if a write overlapped their copy,
+//    so they never observe a half-written record;
+//  - writers never wait for readers. The rare concurrent writers (classify task
+//    vs. /servo, /toggle) are serialised by a writer-only mutex; a spin flag
+//    would let a handler that preempted the holder on the same core spin until
+//    the watchdog fires (on the ESP32 std::mutex is a FreeRTOS mutex with
+//    priority inheritance).
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <string.h>
+
+struct DetectionState {
+    char label[16] = "No Object";
+    float confidence = 0.0f;        // 0..1
+    int servo_angle = 90;
+    bool running = true;
+    uint32_t frame_id = 0;
+    uint32_t dsp_us = 0;
+    uint32_t classification_us = 0;
+    uint32_t latency_us = 0;        // capture done -> actuation queued
+
+    void set_label(const char *s) {
+        strncpy(label, s, sizeof(label) - 1);
+        label[sizeof(label) - 1] = '\0';
+    }
+};
+
+template <typename T>
+class SeqLock {
+public:
+    T read() const {
+        T out;
+        uint32_t s0, s1;
+        do {
+            s0 = seq_.load(std::memory_order_acquire);
+            memcpy(&out, &value_, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            s1 = seq_.load(std::memory_order_relaxed);
+        } while ((s0 & 1u) || s0 != s1);
+        return out;
+    }
+
+    void write(const T &v) {
+        std::lock_guard<std::mutex> lock(writer_);
+        store(v);
+    }
+
+    // Read-modify-write under the writer lock, e.g. update([](T &s){ s.running = false; })
+    template <typename F>
+    void update(F fn) {
+        std::lock_guard<std::mutex> lock(writer_);
+        T v;
+        memcpy(&v, &value_, sizeof(T));
+        fn(v);
+        store(v);
+    }
+
+private:
+    void store(const T &v) {
+        uint32_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&value_, &v, sizeof(T));
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    T value_;
+    std::atomic<uint32_t> seq_{0};
+    std::mutex writer_;
+};
+
+#endif // DETECTION_SNAPSHOT_H
@@ -37,6 +37,7 @@
 
 #include <assert.h>
 #include "../porting/ei_classifier_porting.h"
+#include "../dsp/ei_alloc_profiler.h"
 
 #ifdef __cplusplus
 namespace {
@@ -94,6 +95,12 @@ __attribute__((unused)) void * ei_aligned_calloc(size_t align, size_t size)
 		} // else NULL, could not malloc
 	} //else NULL, invalid arguments
 
+#if EIDSP_TRACK_ALLOCATIONS
+	// mostly called through a function pointer (EON model_init), so the
+	// return address tells the callers apart
+	ei_alloc_profile_alloc(__func__, __FILE__, __LINE__, __builtin_return_address(0), size, ptr);
+#endif
+
 	return ptr;
 }
 
@@ -117,6 +124,10 @@ __attribute__((unused)) void ei_aligned_free(void * ptr)
 	*/
 	void * p = (void *)((uint8_t *)ptr - offset);
 	ei_free(p);
+
+#if EIDSP_TRACK_ALLOCATIONS
+	ei_alloc_profile_free(ptr);
+#endif
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,17 @@
+#ifndef _EI_CLASSIFIER_ARENA_REGIONS_H_
+#define _EI_CLASSIFIER_ARENA_REGIONS_H_
+
+// A span of the tensor arena that holds nothing live yet: between model init
+// and the first layer everything except the graph inputs and the persistent /
+// scratch buffers is free, so the DSP can use it as working memory while it
+// fills the input tensor. See ei_arena_free_regions() in tflite_eon.h.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint8_t *ptr;
+    size_t bytes;
+} ei_arena_region_t;
+
+#endif // _EI_CLASSIFIER_ARENA_REGIONS_H_
@@ -95,6 +95,30 @@
     #define ESP_NN                                  1
 #endif
 
+// int8 SIMD kernels for x86-64 hosts (e.g. the desktop simulator), picked at runtime
+#ifndef EI_CLASSIFIER_TFLITE_ENABLE_X86_NN
+    #if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+        #define EI_CLASSIFIER_TFLITE_ENABLE_X86_NN      1
+    #else
+        #define EI_CLASSIFIER_TFLITE_ENABLE_X86_NN      0
+    #endif
+#endif
+
+// X86-NN conv threads (0: one per core) and the least work, in multiply-
+// accumulates, worth a thread of its own; smaller layers run on the caller
+#ifndef EI_CLASSIFIER_PARALLEL_THREADS
+    #define EI_CLASSIFIER_PARALLEL_THREADS          0
+#endif
+#ifndef EI_CLASSIFIER_PARALLEL_MIN_MACS
+    #define EI_CLASSIFIER_PARALLEL_MIN_MACS         (256 * 1024)
+#endif
+
+// EON: run the invoke host/eon_specialize generated
+// (tflite-model/<model>_specialized.h), with the conv shapes fixed at compile time
+#ifndef EI_CLASSIFIER_EON_SPECIALIZED
+    #define EI_CLASSIFIER_EON_SPECIALIZED           0
+#endif
+
 // no include checks in the compiler? then just include metadata and then ops_define (optional if on EON model)
 #ifndef __has_include
     #include "model-parameters/model_metadata.h"
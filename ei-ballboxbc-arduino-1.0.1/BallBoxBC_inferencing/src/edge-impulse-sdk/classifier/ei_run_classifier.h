@@ -144,6 +144,7 @@ extern "C" EI_IMPULSE_ERROR run_inference(
     ei_impulse_result_t *result,
     bool debug = false)
 {
+    EI_ALLOC_STAGE(EI_ALLOC_STAGE_NN);
     auto& impulse = handle->impulse;
     for (size_t ix = 0; ix < impulse->learning_blocks_size; ix++) {
 
@@ -277,6 +278,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
     size_t out_features_index = 0;
 
     for (size_t ix = 0; ix < handle->impulse->dsp_blocks_size; ix++) {
+        EI_ALLOC_STAGE(EI_ALLOC_STAGE_DSP);
         ei_model_dsp_t block = handle->impulse->dsp_blocks[ix];
 
         matrix_ptrs[ix] = std::unique_ptr<ei::matrix_t>(new ei::matrix_t(1, block.n_output_features));
@@ -480,6 +482,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(ei_impulse_handle_t *hand
     size_t out_features_index = 0;
 
     for (size_t ix = 0; ix < impulse->dsp_blocks_size; ix++) {
+        EI_ALLOC_STAGE(EI_ALLOC_STAGE_DSP);
         ei_model_dsp_t block = impulse->dsp_blocks[ix];
 
         if (out_features_index + block.n_output_features > impulse->nn_input_frame_size) {
@@ -673,6 +676,7 @@ extern "C" EI_IMPULSE_ERROR run_classifier_image_quantized(
     ei_impulse_result_t *result,
     bool debug = false)
 {
+    EI_ALLOC_STAGE(EI_ALLOC_STAGE_NN);
     return run_nn_inference_image_quantized(impulse, signal, 0, result, impulse->learning_blocks[0].config, debug);
 }
 
@@ -1162,7 +1162,7 @@ __attribute__((unused)) int extract_image_features(signal_t *signal, matrix_t *o
 #if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
         matrix_t input_matrix(elements_to_read, config.axes, ei_dsp_image_buffer);
 #else
-        matrix_t input_matrix(elements_to_read, config.axes);
+        EI_DSP_MATRIX(input_matrix, elements_to_read, config.axes);
 #endif
         if (!input_matrix.buffer) {
             EIDSP_ERR(EIDSP_OUT_OF_MEM);
@@ -1222,7 +1222,7 @@ __attribute__((unused)) int extract_drpai_features_quantized(signal_t *signal, m
 #if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
         matrix_t input_matrix(elements_to_read, config.axes, ei_dsp_image_buffer);
 #else
-        matrix_t input_matrix(elements_to_read, config.axes);
+        EI_DSP_MATRIX(input_matrix, elements_to_read, config.axes);
 #endif
         if (!input_matrix.buffer) {
             EIDSP_ERR(EIDSP_OUT_OF_MEM);
@@ -1291,7 +1291,7 @@ __attribute__((unused)) int extract_image_features_quantized(signal_t *signal, m
 #if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
         matrix_t input_matrix(elements_to_read, config.axes, ei_dsp_image_buffer);
 #else
-        matrix_t input_matrix(elements_to_read, config.axes);
+        EI_DSP_MATRIX(input_matrix, elements_to_read, config.axes);
 #endif
         if (!input_matrix.buffer) {
             EIDSP_ERR(EIDSP_OUT_OF_MEM);
@@ -44,6 +44,29 @@
 #include "edge-impulse-sdk/classifier/inferencing_engines/tflite_helper.h"
 #include "edge-impulse-sdk/classifier/ei_run_dsp.h"
 
+// Graph whose DSP step is filling its input tensor right now, see below
+static ei_config_tflite_eon_graph_t *ei_eon_filling_graph = nullptr;
+
+/**
+ * Free spans of the tensor arena while the running model's input tensor is
+ * being filled: run_nn_inference_image_quantized() sets the model up first and
+ * then runs the DSP straight into the input tensor, so a signal's get_data()
+ * callback may use these spans as scratch (e.g. to decode the camera frame)
+ * until it has returned its last pixel. Everywhere else, and for models that
+ * do not report regions, this returns 0.
+ *
+ * @param      regions      Filled in address order
+ * @param      max_regions  Capacity of regions
+ *
+ * @return     Number of regions written
+ */
+__attribute__((unused)) static size_t ei_arena_free_regions(ei_arena_region_t *regions, size_t max_regions) {
+    if (!ei_eon_filling_graph || !ei_eon_filling_graph->model_free_regions) {
+        return 0;
+    }
+    return ei_eon_filling_graph->model_free_regions(regions, max_regions);
+}
+
 /**
  * Setup the TFLite runtime
  *
@@ -149,6 +172,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
 
     // allocate outputs
     outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
+    ei_dsp_register_alloc(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
 
     uint64_t ctx_start_us = ei_read_timer_us();
     ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
@@ -183,6 +207,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
     if (graph_config->model_reset(ei_aligned_free) != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
+    ei_dsp_register_free(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
     ei_free(outputs);
 
     return EI_IMPULSE_OK;
@@ -215,6 +240,7 @@ EI_IMPULSE_ERROR run_nn_inference(
 
     // allocate outputs
     outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
+    ei_dsp_register_alloc(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
 
     uint64_t ctx_start_us = ei_read_timer_us();
     ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
@@ -296,6 +322,7 @@ EI_IMPULSE_ERROR run_nn_inference(
     }
 
     graph_config->model_reset(ei_aligned_free);
+    ei_dsp_register_free(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
     ei_free(outputs);
 
     if (run_res != EI_IMPULSE_OK) {
@@ -328,6 +355,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
 
     // allocate outputs
     outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
+    ei_dsp_register_alloc(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
 
     ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
 
@@ -352,8 +380,14 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, input.data.int8);
 
     // run DSP process and quantize automatically
-    int ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input.params.scale, input.params.zero_point,
-        impulse->frequency, impulse->learning_blocks[0].image_scaling);
+    ei_eon_filling_graph = graph_config;
+    int ret;
+    {
+        EI_ALLOC_STAGE(EI_ALLOC_STAGE_DSP);
+        ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input.params.scale, input.params.zero_point,
+            impulse->frequency, impulse->learning_blocks[0].image_scaling);
+    }
+    ei_eon_filling_graph = nullptr;
 
     if (ret != EIDSP_OK) {
         ei_printf("ERR: Failed to run DSP process (%d)\n", ret);
@@ -433,6 +467,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     }
 
     graph_config->model_reset(ei_aligned_free);
+    ei_dsp_register_free(block_config->output_tensors_size * sizeof(TfLiteTensor), outputs);
     ei_free(outputs);
 
     if (run_res != EI_IMPULSE_OK) {
@@ -453,6 +488,7 @@ __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix
         .model_reset = dsp_config->reset_fn,
         .model_input = dsp_config->input_fn,
         .model_output = dsp_config->output_fn,
+        .model_free_regions = NULL,
     };
 
     const uint8_t ei_output_tensor_indices[1] = { 0 };
@@ -465,7 +501,8 @@ __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix
         .output_tensors_size = ei_output_tensor_size,
         .quantized = 0,
         .compiled = 1,
-        .graph_config = &ei_config_tflite_graph_0
+        .graph_config = &ei_config_tflite_graph_0,
+        .dequantize_output = false,
     };
 
     auto x = run_nn_inference_from_dsp(&ei_learning_block_config, signal, output_matrix);
@@ -53,7 +53,29 @@ float clip(float num, float min_val = -3.4028235e+38, float max_val = 3.4028235e
     return std::fmax(min_val, std::fmin(num, max_val));
 }
 
-#if EI_CLASSIFIER_OBJECT_TRACKING_ENABLED == 1
+// EI_OBJECT_TRACKER_STANDALONE=1 (before this header) compiles the Tracker
+// classes for application code when the model export has no tracking block
+#ifndef EI_OBJECT_TRACKER_STANDALONE
+#define EI_OBJECT_TRACKER_STANDALONE 0
+#endif
+
+#if EI_CLASSIFIER_OBJECT_TRACKING_ENABLED == 1 || EI_OBJECT_TRACKER_STANDALONE == 1
+
+#if EI_CLASSIFIER_OBJECT_TRACKING_ENABLED != 1
+#include <tuple>
+
+// declared by model_metadata.h in a tracking-enabled export
+typedef struct {
+    uint32_t id;
+    uint32_t last_ground_truth_update_t;
+    const char *label;
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+    std::tuple<int, int, int, int> last_centroid_segment;
+} ei_object_tracking_trace_t;
+#endif
 
 typedef struct {
     float keep_grace;
@@ -407,6 +429,10 @@ private:
     std::vector<std::string> seen_labels;
 };
 
+#endif // EI_CLASSIFIER_OBJECT_TRACKING_ENABLED == 1 || EI_OBJECT_TRACKER_STANDALONE == 1
+
+#if EI_CLASSIFIER_OBJECT_TRACKING_ENABLED == 1
+
 EI_IMPULSE_ERROR init_object_tracking(ei_impulse_handle_t *handle, void** state, void *config)
 {
     //const ei_impulse_t *impulse = handle->impulse;
@@ -36,6 +36,7 @@
 #define EI_POSTPROCESSING_H
 
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/dsp/ei_alloc_profiler.h"
 
 #if EI_CLASSIFIER_CALIBRATION_ENABLED
 #include "edge-impulse-sdk/classifier/postprocessing/ei_performance_calibration.h"
@@ -105,6 +106,7 @@ extern "C" EI_IMPULSE_ERROR run_postprocessing(ei_impulse_handle_t *handle,
         return EI_IMPULSE_OUT_OF_MEMORY;
     }
     auto impulse = handle->impulse;
+    EI_ALLOC_STAGE(EI_ALLOC_STAGE_POST);
 
     for (size_t ix = 0; ix < impulse->postprocessing_blocks_size; ix++) {
         void* state = NULL;
@@ -0,0 +1,231 @@
+/*
+ * Allocation profiler, see ei_alloc_profiler.h. The bookkeeping uses std
+ * containers (operator new), which are not tracked, so recording an
+ * allocation never records another one.
+ */
+#include "ei_alloc_profiler.h"
+
+#if EIDSP_TRACK_ALLOCATIONS
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include "memory.hpp"
+
+// lifetime histogram: < 10 us, < 100 us, ... , >= 100 ms
+#define EI_ALLOC_LIFETIME_BUCKETS 6
+
+namespace {
+
+struct site_t {
+    const char *fn;
+    const char *file;
+    int line;
+    const void *caller;
+    uint32_t count = 0;
+    uint64_t bytes = 0;
+    size_t max_bytes = 0;
+    uint32_t live = 0;
+    size_t live_bytes = 0;
+    uint32_t in_region = 0;
+    uint32_t stages[EI_ALLOC_STAGE_COUNT] = { 0 };
+    uint32_t lifetime[EI_ALLOC_LIFETIME_BUCKETS] = { 0 };
+};
+
+struct live_t {
+    site_t *site;
+    size_t bytes;
+    uint64_t t_alloc;
+};
+
+// file, line, caller; by content, a header's __FILE__ differs per translation unit
+typedef std::tuple<std::string, int, const void *> site_key_t;
+
+std::mutex lock;
+std::map<site_key_t, site_t> sites;
+std::map<const void *, live_t> live;
+ei_alloc_stage_t stage = EI_ALLOC_STAGE_OTHER;
+uint32_t runs = 0;
+uint32_t unmatched_frees = 0;
+size_t in_use = 0, peak = 0, live_count = 0, peak_count = 0;
+size_t stage_peak[EI_ALLOC_STAGE_COUNT] = { 0 };
+
+const char *stage_names[EI_ALLOC_STAGE_COUNT] = { "other", "dsp", "nn", "post" };
+
+int lifetime_bucket(uint64_t us) {
+    int b = 0;
+    for (uint64_t limit = 10; b < EI_ALLOC_LIFETIME_BUCKETS - 1 && us >= limit; limit *= 10) {
+        b++;
+    }
+    return b;
+}
+
+struct json_out {
+    void (*write)(const char *, size_t, void *);
+    void *ctx;
+
+    void raw(const char *s) { write(s, strlen(s), ctx); }
+    void fmt(const char *f, unsigned long long v) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), f, v);
+        raw(buf);
+    }
+    void str(const char *s) {
+        raw("\"");
+        for (const char *p = s ? s : ""; *p; p++) {
+            char c[2] = { *p, 0 };
+            if (*p == '"' || *p == '\\') raw("\\");
+            raw((unsigned char)*p < 0x20 ? "?" : c);
+        }
+        raw("\"");
+    }
+    void list(const uint32_t *v, size_t n) {
+        raw("[");
+        for (size_t i = 0; i < n; i++) fmt(i ? ",%llu" : "%llu", v[i]);
+        raw("]");
+    }
+};
+
+} // namespace
+
+extern "C" void ei_alloc_profile_alloc(const char *fn, const char *file, int line, const void *caller,
+                                       size_t bytes, const void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    ei::ei_inference_scope *scope = ei::ei_inference_scope::current();
+    bool in_region = scope && scope->owns(ptr);
+    uint64_t now = ei_read_timer_us();
+
+    std::lock_guard<std::mutex> guard(lock);
+    site_t &s = sites[site_key_t(file ? file : "", line, caller)];
+    s.fn = fn;
+    s.file = file;
+    s.line = line;
+    s.caller = caller;
+    s.count++;
+    s.bytes += bytes;
+    if (bytes > s.max_bytes) s.max_bytes = bytes;
+    s.live++;
+    s.live_bytes += bytes;
+    s.in_region += in_region ? 1 : 0;
+    s.stages[stage]++;
+
+    live_t &l = live[ptr];
+    if (l.site) {
+        // a free we never saw (e.g. an untracked ei_free), drop the old record
+        l.site->live--;
+        l.site->live_bytes -= l.bytes;
+        in_use -= l.bytes;
+        live_count--;
+    }
+    l.site = &s;
+    l.bytes = bytes;
+    l.t_alloc = now;
+
+    in_use += bytes;
+    live_count++;
+    if (in_use > peak) peak = in_use;
+    if (live_count > peak_count) peak_count = live_count;
+    if (in_use > stage_peak[stage]) stage_peak[stage] = in_use;
+}
+
+extern "C" void ei_alloc_profile_free(const void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    uint64_t now = ei_read_timer_us();
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = live.find(ptr);
+    if (it == live.end()) {
+        unmatched_frees++;
+        return;
+    }
+    live_t &l = it->second;
+    l.site->live--;
+    l.site->live_bytes -= l.bytes;
+    l.site->lifetime[lifetime_bucket(now - l.t_alloc)]++;
+    in_use -= l.bytes;
+    live_count--;
+    live.erase(it);
+}
+
+extern "C" ei_alloc_stage_t ei_alloc_profile_set_stage(ei_alloc_stage_t s) {
+    std::lock_guard<std::mutex> guard(lock);
+    ei_alloc_stage_t prev = stage;
+    if (s == EI_ALLOC_STAGE_NN && prev == EI_ALLOC_STAGE_OTHER) {
+        runs++;
+    }
+    stage = s;
+    if (in_use > stage_peak[stage]) stage_peak[stage] = in_use;
+    return prev;
+}
+
+// Clears the statistics; allocations still live stay tracked so their frees match
+extern "C" void ei_alloc_profile_reset(void) {
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto &it : sites) {
+        site_t &s = it.second;
+        s.count = s.live;
+        s.bytes = s.live_bytes;
+        s.max_bytes = 0;
+        s.in_region = 0;
+        memset(s.stages, 0, sizeof(s.stages));
+        memset(s.lifetime, 0, sizeof(s.lifetime));
+    }
+    runs = 0;
+    unmatched_frees = 0;
+    peak = in_use;
+    peak_count = live_count;
+    for (size_t i = 0; i < EI_ALLOC_STAGE_COUNT; i++) stage_peak[i] = in_use;
+}
+
+extern "C" void ei_alloc_profile_json(void (*write)(const char *s, size_t len, void *ctx), void *ctx) {
+    std::lock_guard<std::mutex> guard(lock);
+    json_out o = { write, ctx };
+
+    o.fmt("{\"runs\":%llu", runs);
+    o.fmt(",\"in_use\":%llu", in_use);
+    o.fmt(",\"peak\":%llu", peak);
+    o.fmt(",\"live\":%llu", live_count);
+    o.fmt(",\"peak_live\":%llu", peak_count);
+    o.fmt(",\"unmatched_frees\":%llu", unmatched_frees);
+    o.raw(",\"stages\":[");
+    for (size_t i = 0; i < EI_ALLOC_STAGE_COUNT; i++) {
+        o.raw(i ? "," : "");
+        o.str(stage_names[i]);
+    }
+    o.raw("],\"stage_peak\":[");
+    for (size_t i = 0; i < EI_ALLOC_STAGE_COUNT; i++) o.fmt(i ? ",%llu" : "%llu", stage_peak[i]);
+    o.raw("],\"lifetime_us\":[10,100,1000,10000,100000],\"sites\":[");
+    bool first = true;
+    for (auto &it : sites) {
+        const site_t &s = it.second;
+        o.raw(first ? "\n{\"fn\":" : ",\n{\"fn\":");
+        first = false;
+        o.str(s.fn);
+        o.raw(",\"file\":");
+        o.str(s.file);
+        o.fmt(",\"line\":%llu", (unsigned long long)s.line);
+        o.fmt(",\"caller\":\"0x%llx\"", (unsigned long long)(uintptr_t)s.caller);
+        o.fmt(",\"count\":%llu", s.count);
+        o.fmt(",\"bytes\":%llu", s.bytes);
+        o.fmt(",\"max_bytes\":%llu", s.max_bytes);
+        o.fmt(",\"live\":%llu", s.live);
+        o.fmt(",\"live_bytes\":%llu", s.live_bytes);
+        o.fmt(",\"in_region\":%llu", s.in_region);
+        o.raw(",\"stages\":");
+        o.list(s.stages, EI_ALLOC_STAGE_COUNT);
+        o.raw(",\"lifetime\":");
+        o.list(s.lifetime, EI_ALLOC_LIFETIME_BUCKETS);
+        o.raw("}");
+    }
+    o.raw("]}\n");
+}
+
+#endif // EIDSP_TRACK_ALLOCATIONS
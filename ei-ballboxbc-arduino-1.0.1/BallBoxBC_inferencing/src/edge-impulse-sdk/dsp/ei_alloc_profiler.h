@@ -0,0 +1,73 @@
+/*
+ * Allocation profiler, built when EIDSP_TRACK_ALLOCATIONS is set (set
+ * EIDSP_PRINT_ALLOCATIONS=0 as well to silence the per-event prints).
+ *
+ * Every tracked allocation (ei_dsp_malloc / ei_dsp_calloc, DSP matrices,
+ * EiAlloc containers, ei_aligned_calloc and the EON overflow buffers) is
+ * recorded against its call site (__func__ / __FILE__ / __LINE__, plus the
+ * return address for ei_aligned_calloc, which is mostly reached through a
+ * function pointer) and against the pipeline stage that was running:
+ *
+ *   EI_ALLOC_STAGE(EI_ALLOC_STAGE_DSP);   // until the end of the block
+ *
+ * Per site it keeps the count, total and largest size, what is still live,
+ * how many came out of an ei::ei_inference_scope region, the count per
+ * stage and a histogram of lifetimes (decades of microseconds). Globally it
+ * keeps bytes in use, the peak, and the peak per stage.
+ * ei_alloc_profile_json() writes all of it as one JSON object, read by
+ * host/alloc_report. Without EIDSP_TRACK_ALLOCATIONS everything here is a
+ * no-op.
+ */
+#ifndef _EIDSP_ALLOC_PROFILER_H_
+#define _EIDSP_ALLOC_PROFILER_H_
+
+#include <stddef.h>
+#include "config.hpp"
+
+typedef enum {
+    EI_ALLOC_STAGE_OTHER = 0,
+    EI_ALLOC_STAGE_DSP,
+    EI_ALLOC_STAGE_NN,
+    EI_ALLOC_STAGE_POST,
+    EI_ALLOC_STAGE_COUNT
+} ei_alloc_stage_t;
+
+#if EIDSP_TRACK_ALLOCATIONS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ei_alloc_profile_alloc(const char *fn, const char *file, int line, const void *caller,
+                            size_t bytes, const void *ptr);
+void ei_alloc_profile_free(const void *ptr);
+// Returns the stage that was active; going from OTHER to NN counts a run
+ei_alloc_stage_t ei_alloc_profile_set_stage(ei_alloc_stage_t stage);
+void ei_alloc_profile_reset(void);
+void ei_alloc_profile_json(void (*write)(const char *s, size_t len, void *ctx), void *ctx);
+
+#ifdef __cplusplus
+}
+
+class ei_alloc_stage_scope {
+public:
+    explicit ei_alloc_stage_scope(ei_alloc_stage_t stage) : prev_(ei_alloc_profile_set_stage(stage)) { }
+    ~ei_alloc_stage_scope() { ei_alloc_profile_set_stage(prev_); }
+    ei_alloc_stage_scope(const ei_alloc_stage_scope &) = delete;
+    ei_alloc_stage_scope &operator=(const ei_alloc_stage_scope &) = delete;
+private:
+    ei_alloc_stage_t prev_;
+};
+
+#define EI_ALLOC_STAGE_CONCAT_(a, b) a##b
+#define EI_ALLOC_STAGE_CONCAT(a, b) EI_ALLOC_STAGE_CONCAT_(a, b)
+#define EI_ALLOC_STAGE(stage) ei_alloc_stage_scope EI_ALLOC_STAGE_CONCAT(ei_alloc_stage_, __LINE__)(stage)
+#endif // __cplusplus
+
+#else
+
+#define EI_ALLOC_STAGE(stage) (void)0
+
+#endif // EIDSP_TRACK_ALLOCATIONS
+
+#endif // _EIDSP_ALLOC_PROFILER_H_
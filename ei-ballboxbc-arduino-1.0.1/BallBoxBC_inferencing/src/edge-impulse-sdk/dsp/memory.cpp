@@ -28,7 +28,97 @@
  * either express or implied. See the License for the specific language governing
  * permissions, disclaimers and limitations under the License.
  */
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
 #include "memory.hpp"
 
 size_t ei_memory_in_use = 0;
 size_t ei_memory_peak_use = 0;
+
+namespace ei {
+
+static thread_local ei_inference_scope *current_scope = nullptr;
+static std::atomic<size_t> scope_peak{0};     // scopes end on any task
+
+ei_inference_scope::ei_inference_scope(void *region, size_t bytes)
+    : base_((uint8_t *)region), bytes_(region ? bytes : 0), outer_(current_scope) {
+    current_scope = this;
+}
+
+ei_inference_scope::~ei_inference_scope() {
+    current_scope = outer_;
+    size_t peak = scope_peak.load(std::memory_order_relaxed);
+    while (high_water_ > peak && !scope_peak.compare_exchange_weak(peak, high_water_, std::memory_order_relaxed)) {
+    }
+}
+
+void *ei_inference_scope::alloc(size_t bytes) {
+    size_t start = (used_ + 15) & ~(size_t)15;
+    if (start > bytes_ || bytes > bytes_ - start) {
+        overflows_++;
+        overflow_bytes_ += bytes;
+        return nullptr;
+    }
+    last_ = start;
+    used_ = start + bytes;
+    if (used_ > high_water_) {
+        high_water_ = used_;
+    }
+    live_++;
+    return base_ + start;
+}
+
+void ei_inference_scope::release(void *ptr) {
+    live_--;
+    if ((uint8_t *)ptr == base_ + last_ && last_ < used_) {
+        used_ = last_;
+    }
+}
+
+ei_inference_scope *ei_inference_scope::current() {
+    return current_scope;
+}
+
+size_t ei_inference_scope::peak() {
+    return scope_peak.load(std::memory_order_relaxed);
+}
+
+} // namespace ei
+
+void *ei_scope_malloc(size_t size) {
+    ei::ei_inference_scope *scope = ei::current_scope;
+    return scope ? scope->alloc(size) : nullptr;
+}
+
+void *ei_scope_calloc(size_t nitems, size_t size) {
+    ei::ei_inference_scope *scope = ei::current_scope;
+    if (!scope || (size && nitems > SIZE_MAX / size)) {
+        return nullptr;
+    }
+    void *p = scope->alloc(nitems * size);
+    if (p) {
+        memset(p, 0, nitems * size);
+    }
+    return p;
+}
+
+int ei_scope_free(void *ptr) {
+    for (ei::ei_inference_scope *scope = ei::current_scope; scope && ptr; scope = scope->outer()) {
+        if (scope->owns(ptr)) {
+            scope->release(ptr);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+__attribute__((weak)) void *ei_arena_calloc(ei_arena_tier_t tier, size_t bytes) {
+    (void)tier;
+    return ei_aligned_calloc(16, bytes);
+}
+
+__attribute__((weak)) void ei_arena_free(ei_arena_tier_t tier, void *ptr) {
+    (void)tier;
+    ei_aligned_free(ptr);
+}
@@ -38,6 +38,7 @@
 #include "../porting/ei_classifier_porting.h"
 #include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
 #include "config.hpp"
+#include "ei_alloc_profiler.h"
 
 extern size_t ei_memory_in_use;
 extern size_t ei_memory_peak_use;
@@ -81,7 +82,8 @@ namespace ei {
             ei_memory_peak_use = ei_memory_in_use; \
         } \
         ei_dsp_printf("alloc %lu bytes (in_use=%lu, peak=%lu) (%s@ %s:%d) %p\n", \
-            (unsigned long)bytes, (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr);
+            (unsigned long)bytes, (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr); \
+        ei_alloc_profile_alloc(fn, file, line, NULL, bytes, ptr);
 
     /**
      * Register a matrix allocation. Don't call this function yourself,
@@ -97,7 +99,8 @@ namespace ei {
         } \
         ei_dsp_printf("alloc matrix %lu x %lu = %lu bytes (in_use=%lu, peak=%lu) (%s@ %s:%d) %p\n", \
             (unsigned long)rows, (unsigned long)cols, (unsigned long)(rows * cols * type_size), (unsigned long)ei_memory_in_use, \
-                (unsigned long)ei_memory_peak_use, fn, file, line, ptr);
+                (unsigned long)ei_memory_peak_use, fn, file, line, ptr); \
+        ei_alloc_profile_alloc(fn, file, line, NULL, rows * cols * type_size, ptr);
 
     /**
      * Register free'ing manually allocated memory (allocated through malloc/calloc)
@@ -106,7 +109,8 @@ namespace ei {
     #define ei_dsp_register_free_internal(fn, file, line, bytes, ptr) \
         ei_memory_in_use -= bytes; \
         ei_dsp_printf("free %lu bytes (in_use=%lu, peak=%lu) (%s@ %s:%d) %p\n", \
-            (unsigned long)bytes, (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr);
+            (unsigned long)bytes, (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr); \
+        ei_alloc_profile_free(ptr);
 
     /**
      * Register a matrix free. Don't call this function yourself,
@@ -119,7 +123,8 @@ namespace ei {
         ei_memory_in_use -= (rows * cols * type_size); \
         ei_dsp_printf("free matrix %lu x %lu = %lu bytes (in_use=%lu, peak=%lu) (%s@ %s:%d) %p\n", \
             (unsigned long)rows, (unsigned long)cols, (unsigned long)(rows * cols * type_size), \
-                (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr);
+                (unsigned long)ei_memory_in_use, (unsigned long)ei_memory_peak_use, fn, file, line, ptr); \
+        ei_alloc_profile_free(ptr);
 
     #define ei_dsp_register_alloc(...) ei_dsp_register_alloc_internal(__func__, __FILE__, __LINE__, __VA_ARGS__)
     #define ei_dsp_register_matrix_alloc(...) ei_dsp_register_matrix_alloc_internal(__func__, __FILE__, __LINE__, __VA_ARGS__)
@@ -236,6 +241,66 @@ static ei_unique_ptr_t make_tracked_unique_ptr(void* ptr_in, size_t size)
 }
 #endif
 
+/**
+ * Scoped bump allocator for one inference. While a scope is open on a thread,
+ * ei_malloc() / ei_calloc() on that thread (and so matrix_t buffers, EiAlloc
+ * containers, ei_aligned_calloc() and the EON tensor arena) take the next
+ * 16-byte aligned piece of `region`, ei_free() of such a pointer only gives
+ * it back if it was the latest one (kernel scratch freed right away), and
+ * closing the scope gives all of it back at once. Requests that do not fit
+ * go to the heap as before and are counted in overflows().
+ *
+ * Everything allocated inside must be dead when the scope closes. Functions
+ * that keep a buffer in a static from their first call (the features matrix
+ * of process_impulse(), ...) must have made that call outside a scope, so run
+ * the classifier once before opening the first one. std::vector and new are
+ * not redirected: the SDK returns results in static std::vectors.
+ *
+ *   static uint8_t region[EI_REGION_BYTES];
+ *   {
+ *       ei::ei_inference_scope scope(region, sizeof(region));
+ *       run_classifier(&signal, &result);
+ *       // scope.high_water(): bytes the region needs
+ *   }
+ *
+ * Only ports whose allocation functions call ei_scope_malloc() /
+ * ei_scope_calloc() / ei_scope_free() honour it (arduino, espressif).
+ */
+class ei_inference_scope {
+public:
+    ei_inference_scope(void *region, size_t bytes);
+    ~ei_inference_scope();
+    ei_inference_scope(const ei_inference_scope &) = delete;
+    ei_inference_scope &operator=(const ei_inference_scope &) = delete;
+
+    void *alloc(size_t bytes);          // nullptr (and counted) when it does not fit
+    bool owns(const void *ptr) const { return ptr >= base_ && ptr < base_ + bytes_; }
+    void release(void *ptr);            // ei_free() of a pointer it owns
+
+    size_t used() const { return used_; }
+    size_t high_water() const { return high_water_; }
+    size_t overflows() const { return overflows_; }
+    size_t overflow_bytes() const { return overflow_bytes_; }
+    size_t live() const { return live_; }   // allocated here and not freed yet
+
+    // Open scope of the calling thread, or nullptr; scopes nest
+    static ei_inference_scope *current();
+    ei_inference_scope *outer() const { return outer_; }
+    // Largest high_water() of all scopes closed so far
+    static size_t peak();
+
+private:
+    uint8_t *base_;
+    size_t bytes_;
+    size_t used_ = 0;
+    size_t last_ = 0;                   // offset of the latest allocation
+    size_t high_water_ = 0;
+    size_t overflows_ = 0;
+    size_t overflow_bytes_ = 0;
+    size_t live_ = 0;
+    ei_inference_scope *outer_;
+};
+
 /*
  * @brief Make a unique ptr that supports memory tracking
  * @param ptr A pointer that will be written with the malloc'd address
@@ -98,15 +98,17 @@ __attribute__((weak)) void ei_printf_float(float f) {
 }
 
 __attribute__((weak)) void *ei_malloc(size_t size) {
-    return malloc(size);
+    void *p = ei_scope_malloc(size);
+    return p ? p : malloc(size);
 }
 
 __attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
-    return calloc(nitems, size);
+    void *p = ei_scope_calloc(nitems, size);
+    return p ? p : calloc(nitems, size);
 }
 
 __attribute__((weak)) void ei_free(void *ptr) {
-    free(ptr);
+    if (!ei_scope_free(ptr)) free(ptr);
 }
 
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -257,12 +257,107 @@ void *ei_calloc(size_t nitems, size_t size);
  */
 void ei_free(void *ptr);
 
+/**
+ * @brief Hooks for ei::ei_inference_scope (dsp/memory.hpp)
+ *
+ * A port's ei_malloc(), ei_calloc() and ei_free() try these first, so that
+ * allocations made while the calling thread has a scope open come from its
+ * region. They return NULL / 0 when there is no scope (or it is full), and the
+ * port then falls back to its heap:
+ *
+ * ```
+ * __attribute__((weak)) void *ei_malloc(size_t size) {
+ *     void *p = ei_scope_malloc(size);
+ *     return p ? p : malloc(size);
+ * }
+ *
+ * __attribute__((weak)) void ei_free(void *ptr) {
+ *     if (!ei_scope_free(ptr)) free(ptr);
+ * }
+ * ```
+ */
+void *ei_scope_malloc(size_t size);
+void *ei_scope_calloc(size_t nitems, size_t size);
+int ei_scope_free(void *ptr);
+
+/**
+ * @brief Memory tier of an EON tensor arena (see host/tier_plan)
+ */
+typedef enum {
+    EI_ARENA_FAST = 0,      /**< kTensorArenaSize, internal SRAM */
+    EI_ARENA_SLOW = 1       /**< kTensorArenaSlowSize, external RAM */
+} ei_arena_tier_t;
+
+/**
+ * @brief Allocates a tensor arena of a two-tier EON model in heap mode
+ *
+ * Only models with a tier plan call this, once per arena and inference; the
+ * other models take their arena from ei_aligned_calloc(). The memory must be
+ * 16-byte aligned and zeroed. The default (dsp/memory.cpp) ignores the tier
+ * and uses ei_aligned_calloc(); a target with internal and external RAM puts
+ * each arena where it belongs, e.g. on ESP-IDF:
+ *
+ * ```
+ * void *ei_arena_calloc(ei_arena_tier_t tier, size_t bytes) {
+ *     uint32_t caps = tier == EI_ARENA_FAST ? MALLOC_CAP_INTERNAL : MALLOC_CAP_SPIRAM;
+ *     return heap_caps_aligned_calloc(16, 1, bytes, caps | MALLOC_CAP_8BIT);
+ * }
+ * ```
+ *
+ * @param[in] tier Which arena
+ * @param[in] bytes Arena size
+ *
+ * @return Pointer to the arena, NULL when out of memory
+ */
+void *ei_arena_calloc(ei_arena_tier_t tier, size_t bytes);
+
+/**
+ * @brief Frees an arena from ei_arena_calloc()
+ */
+void ei_arena_free(ei_arena_tier_t tier, void *ptr);
+
 /** @} */
 
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
 }
 #endif // defined(__cplusplus) && EI_C_LINKAGE == 1
 
+// Called from C kernel libraries too, so always C linkage
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Task for ei_run_parallel(): handles items [begin, end)
+ */
+typedef void (*ei_parallel_fn_t)(void *ctx, int begin, int end);
+
+/**
+ * @brief Thread-pool hook for intra-op parallelism
+ *
+ * Runs `fn` over the items [0, count), split into ranges of at least `min_count`
+ * items, and returns once all of them are done. The calling thread should take
+ * one of the ranges. Only kernels that opt in (X86-NN) call this; the default in
+ * porting/x86 is a pool of one thread per core, and a target without threads can
+ * simply run `fn(ctx, 0, count)`:
+ *
+ * ```
+ * __attribute__((weak)) void ei_run_parallel(ei_parallel_fn_t fn, void *ctx, int count, int min_count) {
+ *     fn(ctx, 0, count);
+ * }
+ * ```
+ *
+ * @param[in] fn Task, must be safe to run concurrently on disjoint ranges
+ * @param[in] ctx Passed to every call of `fn`
+ * @param[in] count Number of items
+ * @param[in] min_count Smallest range worth running on another thread
+ */
+void ei_run_parallel(ei_parallel_fn_t fn, void *ctx, int count, int min_count);
+
+#ifdef __cplusplus
+}
+#endif
+
 // Load porting layer depending on target
 
 // First check if any of the general frameworks or operating systems are supported/enabled
@@ -257,6 +257,35 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                         const conv_params_t *conv_params,
                         const quant_data_t *quant_data);
 
+/**
+ * @brief       input offset folded into the bias of a 1x1 convolution
+ *
+ * @note        folded_bias[oc] = bias[oc] + in_offset * sum(filter[oc])
+ *              Depends on the filter and quantization only: compute it once
+ *              when the model is prepared, for esp_nn_conv_s8_1x1_folded_opt
+ */
+void esp_nn_conv_s8_fold_bias_opt(const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const uint16_t in_channels,
+                                  const uint16_t out_channels,
+                                  const int32_t in_offset,
+                                  int32_t *folded_bias);
+
+/**
+ * @brief       1x1 convolution (no padding) on a folded bias
+ *
+ * @note        operation: result = folded_bias + input * filter, i.e. the
+ *              esp_nn_conv_s8_opt result without an offset add per multiply
+ */
+void esp_nn_conv_s8_1x1_folded_opt(const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const int8_t *filter_data,
+                                   const int32_t *folded_bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const conv_params_t *conv_params,
+                                   const quant_data_t *quant_data);
+
 /**
  * @brief       depthwise convolution per channel optimized version
  *
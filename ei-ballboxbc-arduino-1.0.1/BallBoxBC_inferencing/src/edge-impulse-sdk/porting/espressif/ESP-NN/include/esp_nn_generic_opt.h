@@ -28,6 +28,8 @@
 #define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_opt
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_opt
+#define esp_nn_conv_s8_fold_bias esp_nn_conv_s8_fold_bias_opt
+#define esp_nn_conv_s8_1x1_folded esp_nn_conv_s8_1x1_folded_opt
 
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_opt
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_opt
@@ -88,6 +88,167 @@ static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
     }
 }
 
+void esp_nn_conv_s8_fold_bias_opt(const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const uint16_t in_channels,
+                                  const uint16_t out_channels,
+                                  const int32_t in_offset,
+                                  int32_t *folded_bias)
+{
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+        int32_t filter_sum = 0;
+        for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+            filter_sum += *filter_data++;
+        }
+        folded_bias[out_ch_idx] = (bias ? bias[out_ch_idx] : 0) + in_offset * filter_sum;
+    }
+}
+
+__NN_FORCE_INLINE__ int8_t esp_nn_conv_requant_s8(int32_t conv_out, int32_t mult, int32_t shift,
+                                                  int32_t out_offset, int32_t activation_min,
+                                                  int32_t activation_max)
+{
+    conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, mult, shift);
+    conv_out += out_offset;
+    conv_out = max(conv_out, activation_min);
+    conv_out = min(conv_out, activation_max);
+    return (int8_t) conv_out;
+}
+
+/**
+ * 3x3 convolution of a single-channel input (the stem on a grayscale frame):
+ * the nine taps under an output pixel are read once, straight from the three
+ * image rows, and every output channel is a 9-term dot product on them.
+ * Taps in the padding count as zero, as in esp_nn_conv_s8_opt.
+ */
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_ch1_3x3(const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const int8_t *filter_data,
+                                   const int32_t *bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const conv_params_t *conv_params,
+                                   const quant_data_t *quant_data)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t pad_ht = conv_params->padding.height;
+    const int32_t stride_wd = conv_params->stride.width;
+    const int32_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t *out_mult = quant_data->mult;
+    const int32_t *out_shift = quant_data->shift;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = stride_ht * out_y - pad_ht;
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t base_x = stride_wd * out_x - pad_wd;
+            int32_t in[9];
+            if (base_y >= 0 && base_y + 3 <= input_ht && base_x >= 0 && base_x + 3 <= input_wd) {
+                const int8_t *row0 = input_data + base_y * input_wd + base_x;
+                const int8_t *row1 = row0 + input_wd;
+                const int8_t *row2 = row1 + input_wd;
+                in[0] = row0[0] + input_offset;
+                in[1] = row0[1] + input_offset;
+                in[2] = row0[2] + input_offset;
+                in[3] = row1[0] + input_offset;
+                in[4] = row1[1] + input_offset;
+                in[5] = row1[2] + input_offset;
+                in[6] = row2[0] + input_offset;
+                in[7] = row2[1] + input_offset;
+                in[8] = row2[2] + input_offset;
+            } else {
+                for (int32_t tap = 0; tap < 9; tap++) {
+                    const int32_t in_row = base_y + tap / 3;
+                    const int32_t in_col = base_x + tap % 3;
+                    const bool inside = in_row >= 0 && in_row < input_ht && in_col >= 0 && in_col < input_wd;
+                    in[tap] = inside ? input_data[in_row * input_wd + in_col] + input_offset : 0;
+                }
+            }
+
+            const int8_t *filter_ptr = filter_data;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                int32_t conv_out = in[0] * filter_ptr[0] + in[1] * filter_ptr[1] + in[2] * filter_ptr[2]
+                                 + in[3] * filter_ptr[3] + in[4] * filter_ptr[4] + in[5] * filter_ptr[5]
+                                 + in[6] * filter_ptr[6] + in[7] * filter_ptr[7] + in[8] * filter_ptr[8];
+                filter_ptr += 9;
+                if (bias) {
+                    conv_out += bias[out_ch_idx];
+                }
+                *out_data++ = esp_nn_conv_requant_s8(conv_out, out_mult[out_ch_idx], out_shift[out_ch_idx],
+                                                     out_offset, activation_min, activation_max);
+            }
+        }
+    }
+}
+
+/**
+ * Same result as esp_nn_conv_s8_1x1: the input offset is already in
+ * folded_bias, so the inner loop is a plain int8 dot product, and two output
+ * channels share every input load.
+ */
+void esp_nn_conv_s8_1x1_folded_opt(const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const int8_t *filter_data,
+                                   const int32_t *folded_bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const conv_params_t *conv_params,
+                                   const quant_data_t *quant_data)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t *out_mult = quant_data->mult;
+    const int32_t *out_shift = quant_data->shift;
+
+    for (int32_t in_row = 0; in_row < out_ht * stride_ht; in_row += stride_ht) {
+        for (int32_t in_col = 0; in_col < out_wd * stride_wd; in_col += stride_wd) {
+            const int8_t *input_base_ptr = input_data + (in_row * input_wd + in_col) * in_channels;
+            const int8_t *filter_ptr = filter_data;
+            int32_t out_ch_idx = 0;
+            for (; out_ch_idx < out_channels - 1; out_ch_idx += 2) {
+                const int8_t *filter_ptr1 = filter_ptr + in_channels;
+                int32_t conv_out0 = folded_bias[out_ch_idx];
+                int32_t conv_out1 = folded_bias[out_ch_idx + 1];
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    const int32_t input_val = input_base_ptr[in_ch_idx];
+                    conv_out0 += input_val * filter_ptr[in_ch_idx];
+                    conv_out1 += input_val * filter_ptr1[in_ch_idx];
+                }
+                filter_ptr += 2 * in_channels;
+                *out_data++ = esp_nn_conv_requant_s8(conv_out0, out_mult[out_ch_idx], out_shift[out_ch_idx],
+                                                     out_offset, activation_min, activation_max);
+                *out_data++ = esp_nn_conv_requant_s8(conv_out1, out_mult[out_ch_idx + 1], out_shift[out_ch_idx + 1],
+                                                     out_offset, activation_min, activation_max);
+            }
+            if (out_ch_idx < out_channels) {
+                int32_t conv_out = folded_bias[out_ch_idx];
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    conv_out += input_base_ptr[in_ch_idx] * filter_ptr[in_ch_idx];
+                }
+                *out_data++ = esp_nn_conv_requant_s8(conv_out, out_mult[out_ch_idx], out_shift[out_ch_idx],
+                                                     out_offset, activation_min, activation_max);
+            }
+        }
+    }
+}
+
 /**
  * Assumption 1: i/p channels == o/p channels
  * Assumption 2: Pointers are valid
@@ -111,6 +272,11 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                            output_dims, out_data, conv_params, quant_data);
         return;
     }
+    if (filter_wd == 3 && filter_ht == 3 && input_dims->channels == 1) {
+        esp_nn_conv_s8_ch1_3x3(input_dims, input_data, filter_data, bias,
+                               output_dims, out_data, conv_params, quant_data);
+        return;
+    }
 
     const uint16_t input_wd = input_dims->width;
     const uint16_t input_ht = input_dims->height;
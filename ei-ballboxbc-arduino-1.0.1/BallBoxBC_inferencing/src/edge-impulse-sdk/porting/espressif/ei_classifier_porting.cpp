@@ -98,6 +98,10 @@ __attribute__((weak)) void ei_printf_float(float f) {
 // we use alligned alloc instead of regular malloc
 // due to https://github.com/espressif/esp-nn/issues/7
 __attribute__((weak)) void *ei_malloc(size_t size) {
+    void *p = ei_scope_malloc(size);
+    if (p) {
+        return p;
+    }
 #if defined(CONFIG_IDF_TARGET_ESP32S3)
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     return heap_caps_aligned_alloc(16, size, MALLOC_CAP_DEFAULT);
@@ -109,11 +113,14 @@ __attribute__((weak)) void *ei_malloc(size_t size) {
 }
 
 __attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
+    void *p = ei_scope_calloc(nitems, size);
+    if (p) {
+        return p;
+    }
 #if defined(CONFIG_IDF_TARGET_ESP32S3)
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     return heap_caps_calloc(nitems, size, MALLOC_CAP_DEFAULT);
 #else
-    void *p;
     p = aligned_alloc(16, nitems * size);
     if (p == nullptr)
         return p;
@@ -126,7 +133,9 @@ __attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
 }
 
 __attribute__((weak)) void ei_free(void *ptr) {
-    free(ptr);
+    if (!ei_scope_free(ptr)) {
+        free(ptr);
+    }
 }
 
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * X86-NN: int8 kernels for x86-64 hosts (AVX2, AVX-512 VNNI), used by the
+ * TFLite Micro kernels when EI_CLASSIFIER_TFLITE_ENABLE_X86_NN is set.
+ *
+ * The instruction set is picked at runtime from CPUID. Every kernel produces
+ * exactly what the reference_integer_ops kernel produces (same accumulation,
+ * same double-rounding requantization); a kernel returns -1 for a shape or
+ * CPU it does not handle, and the caller runs the reference kernel instead.
+ *
+ * CONV_2D packs the filter into the kernels' blocked layout; callers that keep
+ * a persistent buffer per node do that once (x86_nn_conv_s8_pack()), others
+ * pay for it on every call.
+ *
+ * CONV_2D and DEPTHWISE_CONV_2D split their output rows over ei_run_parallel()
+ * from the porting layer, in ranges of at least EI_CLASSIFIER_PARALLEL_MIN_MACS.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    X86_NN_LEVEL_NONE = 0,          // reference kernels only
+    X86_NN_LEVEL_AVX2 = 1,
+    X86_NN_LEVEL_AVX512_VNNI = 2,
+} x86_nn_level_t;
+
+/**
+ * @brief height x width x channels of one batch entry (NHWC)
+ *
+ * For conv filters (OHWI) channels is the output channel count.
+ */
+typedef struct x86_nn_dims {
+    int32_t height;
+    int32_t width;
+    int32_t channels;
+} x86_nn_dims_t;
+
+/**
+ * @brief conv / depthwise conv parameters, as in tflite::ConvParams
+ */
+typedef struct x86_nn_conv_params {
+    int32_t input_offset;           // -input zero point
+    int32_t output_offset;          // output zero point
+    int32_t activation_min;
+    int32_t activation_max;
+    int32_t stride_width;
+    int32_t stride_height;
+    int32_t pad_width;
+    int32_t pad_height;
+    int32_t depth_multiplier;       // depthwise only
+} x86_nn_conv_params_t;
+
+/**
+ * @brief per output channel requantization, as computed by CalculateOpDataConv
+ */
+typedef struct x86_nn_quant {
+    const int32_t *mult;
+    const int32_t *shift;
+} x86_nn_quant_t;
+
+/**
+ * @brief elementwise int8 add, as tflite::ArithmeticParams
+ */
+typedef struct x86_nn_add_params {
+    int32_t input1_offset;
+    int32_t input2_offset;
+    int32_t input1_multiplier;
+    int32_t input2_multiplier;
+    int32_t input1_shift;
+    int32_t input2_shift;
+    int32_t left_shift;
+    int32_t output_offset;
+    int32_t output_multiplier;
+    int32_t output_shift;
+    int32_t activation_min;
+    int32_t activation_max;
+} x86_nn_add_params_t;
+
+/**
+ * @brief best level this CPU (and OS) supports, capped by x86_nn_set_max_level()
+ */
+x86_nn_level_t x86_nn_level(void);
+
+/**
+ * @brief cap the level, e.g. to compare against the reference kernels
+ */
+void x86_nn_set_max_level(x86_nn_level_t level);
+
+const char *x86_nn_level_name(x86_nn_level_t level);
+
+/**
+ * @brief free the calling thread's work memory; threads that ran kernels call
+ * it before they exit (the pool's workers do), the next kernel call on the
+ * thread allocates it again
+ */
+void x86_nn_free_thread_scratch(void);
+
+/**
+ * @brief int8 CONV_2D (dilation 1, not grouped) on one batch entry
+ *
+ * @return 0 when done, -1 when the caller has to use the reference kernel
+ */
+int x86_nn_conv_s8(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                   const x86_nn_dims_t *input_dims, const int8_t *input,
+                   const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                   const int32_t *bias,
+                   const x86_nn_dims_t *output_dims, int8_t *output);
+
+/**
+ * @brief bytes x86_nn_conv_s8_pack() needs for this conv, 0 when X86-NN would
+ * leave it to the reference kernel
+ */
+int32_t x86_nn_conv_s8_packed_size(const x86_nn_conv_params_t *params,
+                                   const x86_nn_dims_t *input_dims, const x86_nn_dims_t *filter_dims);
+
+/**
+ * @brief rearrange an OHWI filter, its bias and requantization into the blocked
+ * layout the kernels read, once at prepare time; `packed` (16-byte aligned,
+ * x86_nn_conv_s8_packed_size() bytes) must outlive every x86_nn_conv_s8_packed()
+ * call, and `params` must not change
+ *
+ * @return 0 when packed, -1 when there is nothing to pack for this CPU
+ */
+int x86_nn_conv_s8_pack(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                        const x86_nn_dims_t *input_dims,
+                        const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                        const int32_t *bias, void *packed);
+
+/**
+ * @brief x86_nn_conv_s8() on a filter packed by x86_nn_conv_s8_pack()
+ *
+ * @return 0 when done, -1 when the caller has to fall back to x86_nn_conv_s8()
+ * (e.g. the level was capped after packing)
+ */
+int x86_nn_conv_s8_packed(const void *packed, const x86_nn_conv_params_t *params,
+                          const x86_nn_dims_t *input_dims, const int8_t *input,
+                          const x86_nn_dims_t *filter_dims,
+                          const x86_nn_dims_t *output_dims, int8_t *output);
+
+/**
+ * @brief int8 DEPTHWISE_CONV_2D (dilation 1, depth multiplier 1) on one batch entry
+ *
+ * @return 0 when done, -1 when the caller has to use the reference kernel
+ */
+int x86_nn_depthwise_conv_s8(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                             const x86_nn_dims_t *input_dims, const int8_t *input,
+                             const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                             const int32_t *bias,
+                             const x86_nn_dims_t *output_dims, int8_t *output);
+
+/**
+ * @brief int8 ADD of two tensors of the same shape (no broadcast)
+ *
+ * @return 0 when done, -1 when the caller has to use the reference kernel
+ */
+int x86_nn_add_s8(const x86_nn_add_params_t *params, const int8_t *input1, const int8_t *input2,
+                  int8_t *output, int32_t size);
+
+#ifdef __cplusplus
+}
+#endif
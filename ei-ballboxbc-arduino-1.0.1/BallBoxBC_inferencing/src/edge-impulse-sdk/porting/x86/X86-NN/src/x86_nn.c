@@ -0,0 +1,337 @@
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+
+#include <stdlib.h>
+#include "x86_nn_common.h"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+static int detected_level = -1;
+static int max_level = X86_NN_LEVEL_AVX512_VNNI;
+
+static int detect_level(void)
+{
+    __builtin_cpu_init();
+    // libgcc also checks XCR0, i.e. that the OS saves the wider registers
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512vnni")) {
+        return X86_NN_LEVEL_AVX512_VNNI;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return X86_NN_LEVEL_AVX2;
+    }
+    return X86_NN_LEVEL_NONE;
+}
+
+x86_nn_level_t x86_nn_level(void)
+{
+    int level = __atomic_load_n(&detected_level, __ATOMIC_RELAXED);
+    if (level < 0) {
+        level = detect_level();
+        __atomic_store_n(&detected_level, level, __ATOMIC_RELAXED);
+    }
+    int cap = __atomic_load_n(&max_level, __ATOMIC_RELAXED);
+#if defined(TFLITE_SINGLE_ROUNDING) && TFLITE_SINGLE_ROUNDING
+    cap = X86_NN_LEVEL_NONE;    // kernels implement the double-rounding requantization only
+#endif
+    return (x86_nn_level_t)(level < cap ? level : cap);
+}
+
+void x86_nn_set_max_level(x86_nn_level_t level)
+{
+    __atomic_store_n(&max_level, (int)level, __ATOMIC_RELAXED);
+}
+
+const char *x86_nn_level_name(x86_nn_level_t level)
+{
+    switch (level) {
+        case X86_NN_LEVEL_AVX2: return "avx2";
+        case X86_NN_LEVEL_AVX512_VNNI: return "avx512-vnni";
+        default: return "reference";
+    }
+}
+
+// Per-thread work memory: the calling thread's packed filter when the caller
+// did not pack it at prepare time, and one im2col column for every thread
+// that computes rows.
+typedef struct {
+    uint8_t *buf;
+    size_t bytes;
+} scratch_t;
+
+static __thread scratch_t packed_scratch;
+static __thread scratch_t column_scratch;
+
+static void *scratch(scratch_t *s, size_t bytes)
+{
+    if (bytes <= s->bytes) {
+        return s->buf;
+    }
+    free(s->buf);
+    bytes = X86_NN_ROUND_UP(bytes, 64);
+    s->buf = (uint8_t *)aligned_alloc(64, bytes);
+    s->bytes = s->buf ? bytes : 0;
+    return s->buf;
+}
+
+void x86_nn_free_thread_scratch(void)
+{
+    free(packed_scratch.buf);
+    free(column_scratch.buf);
+    packed_scratch = (scratch_t){ NULL, 0 };
+    column_scratch = (scratch_t){ NULL, 0 };
+}
+
+// Output rows per ei_run_parallel() range so that each range is worth a thread
+static int min_rows(int64_t row_macs)
+{
+    const int64_t rows = row_macs > 0 ? (EI_CLASSIFIER_PARALLEL_MIN_MACS + row_macs - 1) / row_macs : 1;
+    return rows < 1 ? 1 : rows > INT32_MAX ? INT32_MAX : (int)rows;
+}
+
+// Carves the packed layout for `level` out of `buf` (NULL: just sizes it).
+static size_t conv_layout(x86_nn_level_t level, int32_t k, int32_t oc, x86_nn_conv_packed_t *pk, uint8_t *buf)
+{
+    const int32_t k_pad = X86_NN_ROUND_UP(k, level == X86_NN_LEVEL_AVX512_VNNI ? 4 : 2);
+    const int32_t oc_pad = X86_NN_ROUND_UP(oc, level == X86_NN_LEVEL_AVX512_VNNI ? 16 : 8);
+    const size_t weight_bytes = X86_NN_ROUND_UP((size_t)k_pad * oc_pad * (level == X86_NN_LEVEL_AVX512_VNNI ? 1 : 2), 64);
+    const size_t channel_bytes = X86_NN_ROUND_UP((size_t)oc_pad * sizeof(int32_t), 64);
+    if (buf) {
+        pk->k = k;
+        pk->k_pad = k_pad;
+        pk->oc = oc;
+        pk->oc_pad = oc_pad;
+        pk->weights = buf;
+        pk->bias = (int32_t *)(buf + weight_bytes);
+        pk->mult = (int32_t *)(buf + weight_bytes + channel_bytes);
+        pk->left = (int32_t *)(buf + weight_bytes + 2 * channel_bytes);
+        pk->right = (int32_t *)(buf + weight_bytes + 3 * channel_bytes);
+    }
+    return weight_bytes + 4 * channel_bytes;
+}
+
+static void pack_channels(x86_nn_conv_packed_t *pk, const x86_nn_quant_t *q, const int32_t *bias)
+{
+    for (int32_t o = 0; o < pk->oc_pad; o++) {
+        const int valid = o < pk->oc;
+        const int32_t shift = valid ? q->shift[o] : 0;
+        pk->bias[o] = valid && bias ? bias[o] : 0;
+        pk->mult[o] = valid ? q->mult[o] : 0;
+        pk->left[o] = shift > 0 ? shift : 0;
+        pk->right[o] = shift > 0 ? 0 : -shift;
+    }
+}
+
+static void pack_avx2(x86_nn_conv_packed_t *pk, const int8_t *filter)
+{
+    int16_t *w = (int16_t *)pk->weights;
+    memset(w, 0, (size_t)pk->k_pad * pk->oc_pad * sizeof(int16_t));
+    for (int32_t o = 0; o < pk->oc; o++) {
+        for (int32_t k = 0; k < pk->k; k++) {
+            w[((k / 2) * pk->oc_pad + o) * 2 + (k & 1)] = filter[o * pk->k + k];
+        }
+    }
+}
+
+// dpbusd multiplies uint8 by int8, so the input goes in as x + 128 and the
+// bias absorbs the difference to x + input_offset:
+//   sum f * (x + off) = sum f * (x + 128) + (off - 128) * sum f
+// Out-of-image taps are fed as 128 - off, which makes their term zero.
+static void pack_vnni(x86_nn_conv_packed_t *pk, const int8_t *filter, int32_t input_offset)
+{
+    int8_t *w = (int8_t *)pk->weights;
+    memset(w, 0, (size_t)pk->k_pad * pk->oc_pad);
+    for (int32_t o = 0; o < pk->oc; o++) {
+        int32_t sum = 0;
+        for (int32_t k = 0; k < pk->k; k++) {
+            const int8_t f = filter[o * pk->k + k];
+            w[((k / 4) * pk->oc_pad + o) * 4 + (k & 3)] = f;
+            sum += f;
+        }
+        pk->bias[o] = (int32_t)((uint32_t)pk->bias[o] + (uint32_t)((input_offset - 128) * sum));
+    }
+}
+
+typedef struct {
+    x86_nn_level_t level;
+    const x86_nn_conv_params_t *params;
+    const x86_nn_conv_packed_t *pk;
+    const x86_nn_quant_t *quant;
+    const x86_nn_dims_t *input_dims;
+    const int8_t *input;
+    const x86_nn_dims_t *filter_dims;
+    const int8_t *filter;
+    const int32_t *bias;
+    const x86_nn_dims_t *output_dims;
+    int8_t *output;
+    int failed;
+} x86_nn_job_t;
+
+static void conv_task(void *ctx, int y0, int y1)
+{
+    x86_nn_job_t *job = (x86_nn_job_t *)ctx;
+    void *col = scratch(&column_scratch, (size_t)job->pk->k_pad * 2);
+    if (!col) {
+        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    if (job->level == X86_NN_LEVEL_AVX512_VNNI) {
+        x86_nn_conv_rows_vnni(job->params, job->pk, job->input_dims, job->input, job->filter_dims,
+                              job->output_dims, job->output, y0, y1, col);
+    }
+    else {
+        x86_nn_conv_rows_avx2(job->params, job->pk, job->input_dims, job->input, job->filter_dims,
+                              job->output_dims, job->output, y0, y1, col);
+    }
+}
+
+static void depthwise_task(void *ctx, int y0, int y1)
+{
+    x86_nn_job_t *job = (x86_nn_job_t *)ctx;
+    if (job->level == X86_NN_LEVEL_AVX512_VNNI) {
+        x86_nn_depthwise_rows_avx512(job->params, job->quant, job->input_dims, job->input, job->filter_dims,
+                                     job->filter, job->bias, job->output_dims, job->output, y0, y1);
+    }
+    else {
+        x86_nn_depthwise_rows_avx2(job->params, job->quant, job->input_dims, job->input, job->filter_dims,
+                                   job->filter, job->bias, job->output_dims, job->output, y0, y1);
+    }
+}
+
+// VNNI unless 128 - input_offset does not fit the uint8 padding value
+static x86_nn_level_t conv_level(const x86_nn_conv_params_t *params)
+{
+    const x86_nn_level_t level = x86_nn_level();
+    if (level == X86_NN_LEVEL_AVX512_VNNI &&
+        (params->input_offset < -127 || params->input_offset > 128)) {
+        return X86_NN_LEVEL_AVX2;
+    }
+    return level;
+}
+
+static void pack_conv(x86_nn_level_t level, const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                      int32_t k, const x86_nn_dims_t *filter_dims, const int8_t *filter, const int32_t *bias,
+                      x86_nn_conv_packed_t *pk, uint8_t *buf)
+{
+    conv_layout(level, k, filter_dims->channels, pk, buf);
+    pack_channels(pk, quant, bias);
+    if (level == X86_NN_LEVEL_AVX512_VNNI) {
+        pack_vnni(pk, filter, params->input_offset);
+    }
+    else {
+        pack_avx2(pk, filter);
+    }
+}
+
+static int run_conv(x86_nn_level_t level, const x86_nn_conv_params_t *params, const x86_nn_conv_packed_t *pk,
+                    const x86_nn_dims_t *input_dims, const int8_t *input, const x86_nn_dims_t *filter_dims,
+                    const x86_nn_dims_t *output_dims, int8_t *output)
+{
+    // rows are independent once the filter is packed
+    x86_nn_job_t job = { level, params, pk, NULL, input_dims, input, filter_dims, NULL, NULL,
+                         output_dims, output, 0 };
+    ei_run_parallel(conv_task, &job, output_dims->height,
+                    min_rows((int64_t)output_dims->width * pk->oc * pk->k));
+    return job.failed ? -1 : 0;
+}
+
+int x86_nn_conv_s8(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                   const x86_nn_dims_t *input_dims, const int8_t *input,
+                   const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                   const int32_t *bias,
+                   const x86_nn_dims_t *output_dims, int8_t *output)
+{
+    const x86_nn_level_t level = conv_level(params);
+    if (level == X86_NN_LEVEL_NONE) {
+        return -1;
+    }
+
+    const int32_t k = filter_dims->height * filter_dims->width * input_dims->channels;
+    x86_nn_conv_packed_t pk;
+    uint8_t *buf = (uint8_t *)scratch(&packed_scratch, conv_layout(level, k, filter_dims->channels, &pk, NULL));
+    if (!buf) {
+        return -1;
+    }
+    pack_conv(level, params, quant, k, filter_dims, filter, bias, &pk, buf);
+    return run_conv(level, params, &pk, input_dims, input, filter_dims, output_dims, output);
+}
+
+// What x86_nn_conv_s8_pack() leaves at the start of the caller's buffer; the
+// packed arrays follow at PREPACKED_HEADER.
+typedef struct {
+    int32_t level;
+    x86_nn_conv_packed_t pk;
+} x86_nn_conv_prepacked_t;
+
+#define PREPACKED_HEADER X86_NN_ROUND_UP(sizeof(x86_nn_conv_prepacked_t), 64)
+
+int32_t x86_nn_conv_s8_packed_size(const x86_nn_conv_params_t *params,
+                                   const x86_nn_dims_t *input_dims, const x86_nn_dims_t *filter_dims)
+{
+    const x86_nn_level_t level = conv_level(params);
+    if (level == X86_NN_LEVEL_NONE) {
+        return 0;
+    }
+    const int32_t k = filter_dims->height * filter_dims->width * input_dims->channels;
+    return (int32_t)(PREPACKED_HEADER + conv_layout(level, k, filter_dims->channels, NULL, NULL));
+}
+
+int x86_nn_conv_s8_pack(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                        const x86_nn_dims_t *input_dims,
+                        const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                        const int32_t *bias, void *packed)
+{
+    const x86_nn_level_t level = conv_level(params);
+    if (level == X86_NN_LEVEL_NONE) {
+        return -1;
+    }
+    x86_nn_conv_prepacked_t *pp = (x86_nn_conv_prepacked_t *)packed;
+    pp->level = level;
+    pack_conv(level, params, quant, filter_dims->height * filter_dims->width * input_dims->channels,
+              filter_dims, filter, bias, &pp->pk, (uint8_t *)packed + PREPACKED_HEADER);
+    return 0;
+}
+
+int x86_nn_conv_s8_packed(const void *packed, const x86_nn_conv_params_t *params,
+                          const x86_nn_dims_t *input_dims, const int8_t *input,
+                          const x86_nn_dims_t *filter_dims,
+                          const x86_nn_dims_t *output_dims, int8_t *output)
+{
+    const x86_nn_conv_prepacked_t *pp = (const x86_nn_conv_prepacked_t *)packed;
+    if (pp->level != (int32_t)conv_level(params)) {
+        return -1;      // level capped since the filter was packed
+    }
+    return run_conv((x86_nn_level_t)pp->level, params, &pp->pk, input_dims, input, filter_dims,
+                    output_dims, output);
+}
+
+int x86_nn_depthwise_conv_s8(const x86_nn_conv_params_t *params, const x86_nn_quant_t *quant,
+                             const x86_nn_dims_t *input_dims, const int8_t *input,
+                             const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                             const int32_t *bias,
+                             const x86_nn_dims_t *output_dims, int8_t *output)
+{
+    const x86_nn_level_t level = x86_nn_level();
+    if (level == X86_NN_LEVEL_NONE || params->depth_multiplier != 1 ||
+        input_dims->channels != output_dims->channels) {
+        return -1;
+    }
+    x86_nn_job_t job = { level, params, NULL, quant, input_dims, input, filter_dims, filter, bias,
+                         output_dims, output, 0 };
+    ei_run_parallel(depthwise_task, &job, output_dims->height,
+                    min_rows((int64_t)output_dims->width * output_dims->channels *
+                             filter_dims->height * filter_dims->width));
+    return 0;
+}
+
+int x86_nn_add_s8(const x86_nn_add_params_t *params, const int8_t *input1, const int8_t *input2,
+                  int8_t *output, int32_t size)
+{
+    // elementwise and a small part of any model: both levels share the AVX2 loop
+    if (x86_nn_level() == X86_NN_LEVEL_NONE) {
+        return -1;
+    }
+    x86_nn_add_avx2(params, input1, input2, output, size);
+    return 0;
+}
+
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_NN
@@ -0,0 +1,251 @@
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+
+#include <immintrin.h>
+#include "x86_nn_common.h"
+
+// x86_nn_requantize() on 8 lanes with per-lane multiplier and shifts.
+X86_NN_AVX2 static inline __m256i high_mul_round(__m256i p)
+{
+    // (p + nudge) / 2^31 rounded toward zero, as gemmlowp; the quotient fits
+    // in 32 bits, so a logical shift leaves the right low half
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i neg = _mm256_cmpgt_epi64(zero, p);
+    const __m256i nudge = _mm256_blendv_epi8(_mm256_set1_epi64x(1 << 30), _mm256_set1_epi64x(1 - (1 << 30)), neg);
+    p = _mm256_add_epi64(p, nudge);
+    p = _mm256_add_epi64(p, _mm256_and_si256(_mm256_cmpgt_epi64(zero, p), _mm256_set1_epi64x((1ll << 31) - 1)));
+    return _mm256_srli_epi64(p, 31);
+}
+
+X86_NN_AVX2 static inline __m256i requantize8(__m256i x, __m256i mult, __m256i left, __m256i right)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    x = _mm256_sllv_epi32(x, left);
+    // multipliers are >= 0, so the INT32_MIN * INT32_MIN saturation never applies
+    const __m256i even = high_mul_round(_mm256_mul_epi32(x, mult));
+    const __m256i odd = high_mul_round(_mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(mult, 32)));
+    const __m256i high = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+
+    const __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, right), one);
+    const __m256i remainder = _mm256_and_si256(high, mask);
+    const __m256i threshold = _mm256_add_epi32(_mm256_srli_epi32(mask, 1),
+                                               _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), high), one));
+    return _mm256_add_epi32(_mm256_srav_epi32(high, right),
+                            _mm256_and_si256(_mm256_cmpgt_epi32(remainder, threshold), one));
+}
+
+// requantized, offset, clamped; `n` (<= 8) int8 to dst
+X86_NN_AVX2 static inline void store8(int8_t *dst, __m256i v, int n, __m256i out_offset, __m256i lo, __m256i hi)
+{
+    v = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(v, out_offset), lo), hi);
+    const __m128i w16 = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    const __m128i b8 = _mm_packs_epi16(w16, w16);
+    if (n == 8) {
+        _mm_storel_epi64((__m128i *)dst, b8);
+    }
+    else {
+        int8_t tmp[16];
+        _mm_storeu_si128((__m128i *)tmp, b8);
+        memcpy(dst, tmp, (size_t)n);
+    }
+}
+
+// im2col of output pixel (oy, ox): int16 x + input_offset, 0 outside the image
+X86_NN_AVX2 static inline void fill_column(int16_t *col, const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                                           const x86_nn_dims_t *in, const int8_t *input, const x86_nn_dims_t *f,
+                                           int32_t oy, int32_t ox)
+{
+    const int32_t ic = in->channels;
+    const int32_t iy0 = oy * p->stride_height - p->pad_height;
+    const int32_t ix0 = ox * p->stride_width - p->pad_width;
+    const __m256i off16 = _mm256_set1_epi16((int16_t)p->input_offset);
+    int16_t *c = col;
+    if (ic == 1) {
+        // single-channel input (the grayscale stem): one tap per filter
+        // position, read straight from the image rows
+        const int inside = iy0 >= 0 && iy0 + f->height <= in->height && ix0 >= 0 && ix0 + f->width <= in->width;
+        for (int32_t ky = 0; ky < f->height; ky++) {
+            const int32_t iy = iy0 + ky;
+            for (int32_t kx = 0; kx < f->width; kx++) {
+                const int32_t ix = ix0 + kx;
+                *c++ = inside || (iy >= 0 && iy < in->height && ix >= 0 && ix < in->width)
+                     ? (int16_t)(input[(size_t)iy * in->width + ix] + p->input_offset) : 0;
+            }
+        }
+        for (int32_t k = pk->k; k < pk->k_pad; k++) {
+            col[k] = 0;
+        }
+        return;
+    }
+    for (int32_t ky = 0; ky < f->height; ky++) {
+        const int32_t iy = iy0 + ky;
+        for (int32_t kx = 0; kx < f->width; kx++, c += ic) {
+            const int32_t ix = ix0 + kx;
+            if (iy < 0 || iy >= in->height || ix < 0 || ix >= in->width) {
+                memset(c, 0, (size_t)ic * sizeof(int16_t));
+                continue;
+            }
+            const int8_t *src = input + ((size_t)iy * in->width + ix) * ic;
+            int32_t i = 0;
+            for (; i + 16 <= ic; i += 16) {
+                const __m256i v = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(src + i)));
+                _mm256_storeu_si256((__m256i *)(c + i), _mm256_add_epi16(v, off16));
+            }
+            for (; i < ic; i++) {
+                c[i] = (int16_t)(src[i] + p->input_offset);
+            }
+        }
+    }
+    for (int32_t k = pk->k; k < pk->k_pad; k++) {
+        col[k] = 0;
+    }
+}
+
+// `nb` blocks of 8 output channels starting at `ob`
+X86_NN_AVX2 static inline __attribute__((always_inline))
+void conv_tile(const int32_t *col32, const x86_nn_conv_packed_t *pk, int32_t ob, int nb, int8_t *dst,
+               __m256i out_offset, __m256i lo, __m256i hi)
+{
+    const int16_t *w = (const int16_t *)pk->weights + (size_t)ob * 2;
+    const size_t w_stride = (size_t)pk->oc_pad * 2;
+    __m256i acc[4];
+    for (int j = 0; j < nb; j++) {
+        acc[j] = _mm256_loadu_si256((const __m256i *)(pk->bias + ob + 8 * j));
+    }
+    for (int32_t k2 = 0; k2 < pk->k_pad / 2; k2++, w += w_stride) {
+        const __m256i x = _mm256_set1_epi32(col32[k2]);
+        for (int j = 0; j < nb; j++) {
+            acc[j] = _mm256_add_epi32(acc[j], _mm256_madd_epi16(x, _mm256_loadu_si256((const __m256i *)(w + 16 * j))));
+        }
+    }
+    for (int j = 0; j < nb; j++) {
+        const int32_t o = ob + 8 * j;
+        const __m256i v = requantize8(acc[j],
+                                      _mm256_loadu_si256((const __m256i *)(pk->mult + o)),
+                                      _mm256_loadu_si256((const __m256i *)(pk->left + o)),
+                                      _mm256_loadu_si256((const __m256i *)(pk->right + o)));
+        const int n = pk->oc - o < 8 ? pk->oc - o : 8;
+        store8(dst + o, v, n, out_offset, lo, hi);
+    }
+}
+
+X86_NN_AVX2
+void x86_nn_conv_rows_avx2(const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                           const x86_nn_dims_t *input_dims, const int8_t *input,
+                           const x86_nn_dims_t *filter_dims,
+                           const x86_nn_dims_t *output_dims, int8_t *output,
+                           int32_t y0, int32_t y1, void *col)
+{
+    const __m256i out_offset = _mm256_set1_epi32(p->output_offset);
+    const __m256i lo = _mm256_set1_epi32(p->activation_min);
+    const __m256i hi = _mm256_set1_epi32(p->activation_max);
+    int16_t *col16 = (int16_t *)col;
+
+    for (int32_t oy = y0; oy < y1; oy++) {
+        for (int32_t ox = 0; ox < output_dims->width; ox++) {
+            fill_column(col16, p, pk, input_dims, input, filter_dims, oy, ox);
+            int8_t *dst = output + ((size_t)oy * output_dims->width + ox) * pk->oc;
+            int32_t ob = 0;
+            for (; ob + 32 <= pk->oc_pad; ob += 32) {
+                conv_tile((const int32_t *)col16, pk, ob, 4, dst, out_offset, lo, hi);
+            }
+            for (; ob < pk->oc_pad; ob += 8) {
+                conv_tile((const int32_t *)col16, pk, ob, 1, dst, out_offset, lo, hi);
+            }
+        }
+    }
+}
+
+X86_NN_AVX2
+void x86_nn_depthwise_rows_avx2(const x86_nn_conv_params_t *p, const x86_nn_quant_t *q,
+                                const x86_nn_dims_t *input_dims, const int8_t *input,
+                                const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                                const int32_t *bias,
+                                const x86_nn_dims_t *output_dims, int8_t *output,
+                                int32_t y0, int32_t y1)
+{
+    const int32_t ch = input_dims->channels;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i in_offset = _mm256_set1_epi32(p->input_offset);
+    const __m256i out_offset = _mm256_set1_epi32(p->output_offset);
+    const __m256i lo = _mm256_set1_epi32(p->activation_min);
+    const __m256i hi = _mm256_set1_epi32(p->activation_max);
+
+    for (int32_t oy = y0; oy < y1; oy++) {
+        const int32_t iy0 = oy * p->stride_height - p->pad_height;
+        const int32_t ky0 = iy0 < 0 ? -iy0 : 0;
+        const int32_t ky1 = input_dims->height - iy0 < filter_dims->height ? input_dims->height - iy0 : filter_dims->height;
+        for (int32_t ox = 0; ox < output_dims->width; ox++) {
+            const int32_t ix0 = ox * p->stride_width - p->pad_width;
+            const int32_t kx0 = ix0 < 0 ? -ix0 : 0;
+            const int32_t kx1 = input_dims->width - ix0 < filter_dims->width ? input_dims->width - ix0 : filter_dims->width;
+            int8_t *dst = output + ((size_t)oy * output_dims->width + ox) * ch;
+
+            int32_t c = 0;
+            for (; c + 8 <= ch; c += 8) {
+                __m256i acc = bias ? _mm256_loadu_si256((const __m256i *)(bias + c)) : zero;
+                for (int32_t ky = ky0; ky < ky1; ky++) {
+                    const int8_t *src = input + ((size_t)(iy0 + ky) * input_dims->width + ix0) * ch + c;
+                    const int8_t *w = filter + (size_t)ky * filter_dims->width * ch + c;
+                    for (int32_t kx = kx0; kx < kx1; kx++) {
+                        const __m256i x = _mm256_add_epi32(
+                            _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(src + (size_t)kx * ch))), in_offset);
+                        const __m256i f = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(w + (size_t)kx * ch)));
+                        acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(x, f));
+                    }
+                }
+                const __m256i shift = _mm256_loadu_si256((const __m256i *)(q->shift + c));
+                const __m256i v = requantize8(acc, _mm256_loadu_si256((const __m256i *)(q->mult + c)),
+                                              _mm256_max_epi32(shift, zero),
+                                              _mm256_max_epi32(_mm256_sub_epi32(zero, shift), zero));
+                store8(dst + c, v, 8, out_offset, lo, hi);
+            }
+            for (; c < ch; c++) {
+                int32_t acc = bias ? bias[c] : 0;
+                for (int32_t ky = ky0; ky < ky1; ky++) {
+                    for (int32_t kx = kx0; kx < kx1; kx++) {
+                        const int8_t x = input[((size_t)(iy0 + ky) * input_dims->width + ix0 + kx) * ch + c];
+                        acc += filter[((size_t)ky * filter_dims->width + kx) * ch + c] * (x + p->input_offset);
+                    }
+                }
+                dst[c] = x86_nn_clamp_s8(x86_nn_requantize(acc, q->mult[c], q->shift[c]) + p->output_offset,
+                                         p->activation_min, p->activation_max);
+            }
+        }
+    }
+}
+
+X86_NN_AVX2
+void x86_nn_add_avx2(const x86_nn_add_params_t *p, const int8_t *input1, const int8_t *input2,
+                     int8_t *output, int32_t size)
+{
+    const __m256i off1 = _mm256_set1_epi32(p->input1_offset);
+    const __m256i off2 = _mm256_set1_epi32(p->input2_offset);
+    const __m128i left_shift = _mm_cvtsi32_si128(p->left_shift);
+    const __m256i m1 = _mm256_set1_epi32(p->input1_multiplier);
+    const __m256i m2 = _mm256_set1_epi32(p->input2_multiplier);
+    const __m256i mo = _mm256_set1_epi32(p->output_multiplier);
+    const __m256i l1 = _mm256_set1_epi32(p->input1_shift > 0 ? p->input1_shift : 0);
+    const __m256i r1 = _mm256_set1_epi32(p->input1_shift > 0 ? 0 : -p->input1_shift);
+    const __m256i l2 = _mm256_set1_epi32(p->input2_shift > 0 ? p->input2_shift : 0);
+    const __m256i r2 = _mm256_set1_epi32(p->input2_shift > 0 ? 0 : -p->input2_shift);
+    const __m256i lout = _mm256_set1_epi32(p->output_shift > 0 ? p->output_shift : 0);
+    const __m256i ro = _mm256_set1_epi32(p->output_shift > 0 ? 0 : -p->output_shift);
+    const __m256i out_offset = _mm256_set1_epi32(p->output_offset);
+    const __m256i lo = _mm256_set1_epi32(p->activation_min);
+    const __m256i hi = _mm256_set1_epi32(p->activation_max);
+
+    int32_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i a = _mm256_add_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(input1 + i))), off1);
+        __m256i b = _mm256_add_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(input2 + i))), off2);
+        a = requantize8(_mm256_sll_epi32(a, left_shift), m1, l1, r1);
+        b = requantize8(_mm256_sll_epi32(b, left_shift), m2, l2, r2);
+        store8(output + i, requantize8(_mm256_add_epi32(a, b), mo, lout, ro), 8, out_offset, lo, hi);
+    }
+    for (; i < size; i++) {
+        output[i] = x86_nn_add_one(p, input1[i], input2[i]);
+    }
+}
+
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_NN
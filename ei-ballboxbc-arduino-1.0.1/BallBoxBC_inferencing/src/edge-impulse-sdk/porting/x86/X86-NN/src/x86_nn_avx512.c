@@ -0,0 +1,199 @@
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+
+#include <immintrin.h>
+#include "x86_nn_common.h"
+
+// x86_nn_requantize() on 16 lanes, see requantize8() in x86_nn_avx2.c
+X86_NN_AVX512 static inline __m512i high_mul_round(__m512i p)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __mmask8 neg = _mm512_cmplt_epi64_mask(p, zero);
+    p = _mm512_add_epi64(p, _mm512_mask_blend_epi64(neg, _mm512_set1_epi64(1 << 30), _mm512_set1_epi64(1 - (1 << 30))));
+    p = _mm512_mask_add_epi64(p, _mm512_cmplt_epi64_mask(p, zero), p, _mm512_set1_epi64((1ll << 31) - 1));
+    return _mm512_srli_epi64(p, 31);
+}
+
+X86_NN_AVX512 static inline __m512i requantize16(__m512i x, __m512i mult, __m512i left, __m512i right)
+{
+    const __m512i one = _mm512_set1_epi32(1);
+    x = _mm512_sllv_epi32(x, left);
+    const __m512i even = high_mul_round(_mm512_mul_epi32(x, mult));
+    const __m512i odd = high_mul_round(_mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(mult, 32)));
+    const __m512i high = _mm512_mask_blend_epi32(0xaaaa, even, _mm512_slli_epi64(odd, 32));
+
+    const __m512i mask = _mm512_sub_epi32(_mm512_sllv_epi32(one, right), one);
+    const __m512i remainder = _mm512_and_si512(high, mask);
+    const __m512i threshold = _mm512_mask_add_epi32(_mm512_srli_epi32(mask, 1),
+                                                    _mm512_cmplt_epi32_mask(high, _mm512_setzero_si512()),
+                                                    _mm512_srli_epi32(mask, 1), one);
+    return _mm512_mask_add_epi32(_mm512_srav_epi32(high, right),
+                                 _mm512_cmpgt_epi32_mask(remainder, threshold),
+                                 _mm512_srav_epi32(high, right), one);
+}
+
+X86_NN_AVX512 static inline void store16(int8_t *dst, __m512i v, __mmask16 valid,
+                                         __m512i out_offset, __m512i lo, __m512i hi)
+{
+    v = _mm512_min_epi32(_mm512_max_epi32(_mm512_add_epi32(v, out_offset), lo), hi);
+    _mm_mask_storeu_epi8(dst, valid, _mm512_cvtepi32_epi8(v));
+}
+
+X86_NN_AVX512 static inline __mmask16 lanes(int32_t n)
+{
+    return n >= 16 ? (__mmask16)0xffff : (__mmask16)((1u << n) - 1);
+}
+
+// im2col of output pixel (oy, ox) as uint8 x + 128; taps outside the image
+// read 128 - input_offset, see pack_vnni() in x86_nn.c
+X86_NN_AVX512 static inline void fill_column(uint8_t *col, const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                                             const x86_nn_dims_t *in, const int8_t *input, const x86_nn_dims_t *f,
+                                             int32_t oy, int32_t ox)
+{
+    const int32_t ic = in->channels;
+    const int32_t iy0 = oy * p->stride_height - p->pad_height;
+    const int32_t ix0 = ox * p->stride_width - p->pad_width;
+    const uint8_t pad = (uint8_t)(128 - p->input_offset);
+    const __m512i flip = _mm512_set1_epi8((char)0x80);
+    uint8_t *c = col;
+    if (ic == 1) {
+        // single-channel input (the grayscale stem): one byte per tap, read
+        // straight from the image rows
+        const int inside = iy0 >= 0 && iy0 + f->height <= in->height && ix0 >= 0 && ix0 + f->width <= in->width;
+        for (int32_t ky = 0; ky < f->height; ky++) {
+            const int32_t iy = iy0 + ky;
+            for (int32_t kx = 0; kx < f->width; kx++) {
+                const int32_t ix = ix0 + kx;
+                *c++ = inside || (iy >= 0 && iy < in->height && ix >= 0 && ix < in->width)
+                     ? (uint8_t)input[(size_t)iy * in->width + ix] ^ 0x80 : pad;
+            }
+        }
+        for (int32_t k = pk->k; k < pk->k_pad; k++) {
+            col[k] = 0;
+        }
+        return;
+    }
+    for (int32_t ky = 0; ky < f->height; ky++) {
+        const int32_t iy = iy0 + ky;
+        for (int32_t kx = 0; kx < f->width; kx++, c += ic) {
+            const int32_t ix = ix0 + kx;
+            if (iy < 0 || iy >= in->height || ix < 0 || ix >= in->width) {
+                memset(c, pad, (size_t)ic);
+                continue;
+            }
+            const int8_t *src = input + ((size_t)iy * in->width + ix) * ic;
+            int32_t i = 0;
+            for (; i + 64 <= ic; i += 64) {
+                _mm512_storeu_si512(c + i, _mm512_xor_si512(_mm512_loadu_si512(src + i), flip));
+            }
+            for (; i < ic; i++) {
+                c[i] = (uint8_t)src[i] ^ 0x80;
+            }
+        }
+    }
+    for (int32_t k = pk->k; k < pk->k_pad; k++) {
+        col[k] = 0;
+    }
+}
+
+// `nb` blocks of 16 output channels starting at `ob`
+X86_NN_AVX512 static inline __attribute__((always_inline))
+void conv_tile(const int32_t *col32, const x86_nn_conv_packed_t *pk, int32_t ob, int nb, int8_t *dst,
+               __m512i out_offset, __m512i lo, __m512i hi)
+{
+    const int8_t *w = (const int8_t *)pk->weights + (size_t)ob * 4;
+    const size_t w_stride = (size_t)pk->oc_pad * 4;
+    __m512i acc[4];
+    for (int j = 0; j < nb; j++) {
+        acc[j] = _mm512_loadu_si512(pk->bias + ob + 16 * j);
+    }
+    for (int32_t k4 = 0; k4 < pk->k_pad / 4; k4++, w += w_stride) {
+        const __m512i x = _mm512_set1_epi32(col32[k4]);
+        for (int j = 0; j < nb; j++) {
+            acc[j] = _mm512_dpbusd_epi32(acc[j], x, _mm512_loadu_si512(w + 64 * j));
+        }
+    }
+    for (int j = 0; j < nb; j++) {
+        const int32_t o = ob + 16 * j;
+        const __m512i v = requantize16(acc[j], _mm512_loadu_si512(pk->mult + o),
+                                       _mm512_loadu_si512(pk->left + o), _mm512_loadu_si512(pk->right + o));
+        store16(dst + o, v, lanes(pk->oc - o), out_offset, lo, hi);
+    }
+}
+
+X86_NN_AVX512
+void x86_nn_conv_rows_vnni(const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                           const x86_nn_dims_t *input_dims, const int8_t *input,
+                           const x86_nn_dims_t *filter_dims,
+                           const x86_nn_dims_t *output_dims, int8_t *output,
+                           int32_t y0, int32_t y1, void *col)
+{
+    const __m512i out_offset = _mm512_set1_epi32(p->output_offset);
+    const __m512i lo = _mm512_set1_epi32(p->activation_min);
+    const __m512i hi = _mm512_set1_epi32(p->activation_max);
+    uint8_t *col8 = (uint8_t *)col;
+
+    for (int32_t oy = y0; oy < y1; oy++) {
+        for (int32_t ox = 0; ox < output_dims->width; ox++) {
+            fill_column(col8, p, pk, input_dims, input, filter_dims, oy, ox);
+            int8_t *dst = output + ((size_t)oy * output_dims->width + ox) * pk->oc;
+            int32_t ob = 0;
+            for (; ob + 64 <= pk->oc_pad; ob += 64) {
+                conv_tile((const int32_t *)col8, pk, ob, 4, dst, out_offset, lo, hi);
+            }
+            for (; ob < pk->oc_pad; ob += 16) {
+                conv_tile((const int32_t *)col8, pk, ob, 1, dst, out_offset, lo, hi);
+            }
+        }
+    }
+}
+
+X86_NN_AVX512
+void x86_nn_depthwise_rows_avx512(const x86_nn_conv_params_t *p, const x86_nn_quant_t *q,
+                                  const x86_nn_dims_t *input_dims, const int8_t *input,
+                                  const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                                  const int32_t *bias,
+                                  const x86_nn_dims_t *output_dims, int8_t *output,
+                                  int32_t y0, int32_t y1)
+{
+    const int32_t ch = input_dims->channels;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i in_offset = _mm512_set1_epi32(p->input_offset);
+    const __m512i out_offset = _mm512_set1_epi32(p->output_offset);
+    const __m512i lo = _mm512_set1_epi32(p->activation_min);
+    const __m512i hi = _mm512_set1_epi32(p->activation_max);
+
+    for (int32_t oy = y0; oy < y1; oy++) {
+        const int32_t iy0 = oy * p->stride_height - p->pad_height;
+        const int32_t ky0 = iy0 < 0 ? -iy0 : 0;
+        const int32_t ky1 = input_dims->height - iy0 < filter_dims->height ? input_dims->height - iy0 : filter_dims->height;
+        for (int32_t ox = 0; ox < output_dims->width; ox++) {
+            const int32_t ix0 = ox * p->stride_width - p->pad_width;
+            const int32_t kx0 = ix0 < 0 ? -ix0 : 0;
+            const int32_t kx1 = input_dims->width - ix0 < filter_dims->width ? input_dims->width - ix0 : filter_dims->width;
+            int8_t *dst = output + ((size_t)oy * output_dims->width + ox) * ch;
+
+            // channel tail through masked loads and stores
+            for (int32_t c = 0; c < ch; c += 16) {
+                const __mmask16 m = lanes(ch - c);
+                __m512i acc = bias ? _mm512_maskz_loadu_epi32(m, bias + c) : zero;
+                for (int32_t ky = ky0; ky < ky1; ky++) {
+                    for (int32_t kx = kx0; kx < kx1; kx++) {
+                        const int8_t *src = input + ((size_t)(iy0 + ky) * input_dims->width + ix0 + kx) * ch + c;
+                        const int8_t *w = filter + ((size_t)ky * filter_dims->width + kx) * ch + c;
+                        const __m512i x = _mm512_add_epi32(_mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(m, src)), in_offset);
+                        const __m512i f = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(m, w));
+                        acc = _mm512_add_epi32(acc, _mm512_mullo_epi32(x, f));
+                    }
+                }
+                const __m512i shift = _mm512_maskz_loadu_epi32(m, q->shift + c);
+                const __m512i v = requantize16(acc, _mm512_maskz_loadu_epi32(m, q->mult + c),
+                                               _mm512_max_epi32(shift, zero),
+                                               _mm512_max_epi32(_mm512_sub_epi32(zero, shift), zero));
+                store16(dst + c, v, m, out_offset, lo, hi);
+            }
+        }
+    }
+}
+
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_NN
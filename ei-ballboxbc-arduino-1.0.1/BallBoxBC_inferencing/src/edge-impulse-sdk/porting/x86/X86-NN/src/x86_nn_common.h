@@ -0,0 +1,93 @@
+#pragma once
+
+// Shared between the X86-NN dispatcher and the per-ISA kernel files. The ISA
+// files are built with the project's normal flags; their functions carry a
+// target attribute instead, so nothing runs AVX code before the CPUID check.
+
+#include <stdint.h>
+#include <string.h>
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+
+#define X86_NN_AVX2     __attribute__((target("avx2")))
+#define X86_NN_AVX512   __attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512vnni")))
+
+#define X86_NN_ROUND_UP(x, n) (((x) + (n) - 1) / (n) * (n))
+
+// Conv filter and per-channel data in the layout the SIMD loops read.
+// AVX2:  int16 pairs   [k_pad / 2][oc_pad][2], input taps added to input_offset
+// VNNI:  int8 quads    [k_pad / 4][oc_pad][4], input taps as uint8 (x + 128)
+// with k = filter_height * filter_width * input_channels in (ky, kx, ic) order.
+typedef struct x86_nn_conv_packed {
+    int32_t k;
+    int32_t k_pad;
+    int32_t oc;
+    int32_t oc_pad;
+    void *weights;
+    int32_t *bias;      // VNNI: bias + (input_offset - 128) * sum(filter), see x86_nn_pack_vnni
+    int32_t *mult;
+    int32_t *left;      // max(shift, 0)
+    int32_t *right;     // max(-shift, 0)
+} x86_nn_conv_packed_t;
+
+// MultiplyByQuantizedMultiplier() as in tflite/kernels/internal/common.h
+// (gemmlowp SaturatingRoundingDoublingHighMul + RoundingDivideByPOT)
+static inline int32_t x86_nn_requantize(int32_t x, int32_t mult, int32_t shift)
+{
+    const int32_t left = shift > 0 ? shift : 0;
+    const int32_t right = shift > 0 ? 0 : -shift;
+    const int32_t a = (int32_t)((uint32_t)x << left);
+    if (a == INT32_MIN && mult == INT32_MIN) {
+        return INT32_MAX;
+    }
+    const int64_t ab = (int64_t)a * mult;
+    const int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+    const int32_t high = (int32_t)((ab + nudge) / (1ll << 31));
+    const int32_t mask = (int32_t)((1ll << right) - 1);
+    const int32_t remainder = high & mask;
+    const int32_t threshold = (mask >> 1) + (high < 0 ? 1 : 0);
+    return (high >> right) + (remainder > threshold ? 1 : 0);
+}
+
+static inline int8_t x86_nn_clamp_s8(int32_t v, int32_t lo, int32_t hi)
+{
+    return (int8_t)(v < lo ? lo : v > hi ? hi : v);
+}
+
+static inline int8_t x86_nn_add_one(const x86_nn_add_params_t *p, int8_t x, int8_t y)
+{
+    const int32_t a = (int32_t)((uint32_t)(p->input1_offset + x) << p->left_shift);
+    const int32_t b = (int32_t)((uint32_t)(p->input2_offset + y) << p->left_shift);
+    const int32_t sum = x86_nn_requantize(a, p->input1_multiplier, p->input1_shift) +
+                        x86_nn_requantize(b, p->input2_multiplier, p->input2_shift);
+    return x86_nn_clamp_s8(x86_nn_requantize(sum, p->output_multiplier, p->output_shift) + p->output_offset,
+                           p->activation_min, p->activation_max);
+}
+
+// Output rows [y0, y1) of one batch entry. `col` holds one im2col column
+// (k_pad entries, 64-byte aligned).
+void x86_nn_conv_rows_avx2(const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                           const x86_nn_dims_t *input_dims, const int8_t *input,
+                           const x86_nn_dims_t *filter_dims,
+                           const x86_nn_dims_t *output_dims, int8_t *output,
+                           int32_t y0, int32_t y1, void *col);
+void x86_nn_conv_rows_vnni(const x86_nn_conv_params_t *p, const x86_nn_conv_packed_t *pk,
+                           const x86_nn_dims_t *input_dims, const int8_t *input,
+                           const x86_nn_dims_t *filter_dims,
+                           const x86_nn_dims_t *output_dims, int8_t *output,
+                           int32_t y0, int32_t y1, void *col);
+
+void x86_nn_depthwise_rows_avx2(const x86_nn_conv_params_t *p, const x86_nn_quant_t *q,
+                                const x86_nn_dims_t *input_dims, const int8_t *input,
+                                const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                                const int32_t *bias,
+                                const x86_nn_dims_t *output_dims, int8_t *output,
+                                int32_t y0, int32_t y1);
+void x86_nn_depthwise_rows_avx512(const x86_nn_conv_params_t *p, const x86_nn_quant_t *q,
+                                  const x86_nn_dims_t *input_dims, const int8_t *input,
+                                  const x86_nn_dims_t *filter_dims, const int8_t *filter,
+                                  const int32_t *bias,
+                                  const x86_nn_dims_t *output_dims, int8_t *output,
+                                  int32_t y0, int32_t y1);
+
+void x86_nn_add_avx2(const x86_nn_add_params_t *p, const int8_t *input1, const int8_t *input2,
+                     int8_t *output, int32_t size);
@@ -0,0 +1,150 @@
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+#include "ei_thread_pool.h"
+
+// Persistent workers woken per job. Ranges are claimed from an atomic counter,
+// the caller takes its share, and the job ends when every range is done and no
+// worker still holds it; job fields only change under mu_ with no holders.
+// One job at a time: a second inference thread that finds the pool busy runs
+// its op inline instead of queueing behind it.
+
+namespace {
+
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads) { resize(threads); }
+
+    void resize(int threads) {
+        std::lock_guard<std::mutex> busy(run_mu_);
+        stop_workers();
+        if (threads <= 0) {
+            threads = (int)std::thread::hardware_concurrency();
+        }
+        size_ = threads < 1 ? 1 : threads;
+        stop_ = false;
+        for (int i = 1; i < size_; i++) {
+            workers_.emplace_back([this] { worker(); });
+        }
+    }
+
+    int size() const { return size_; }
+
+    void run(ei_parallel_fn_t fn, void *ctx, int count, int min_count) {
+        int chunks = min_count > 0 ? count / min_count : count;
+        if (chunks > size_) chunks = size_;
+        std::unique_lock<std::mutex> busy(run_mu_, std::try_to_lock);
+        if (chunks <= 1 || !busy.owns_lock()) {
+            fn(ctx, 0, count);
+            return;
+        }
+
+        {
+            // a worker that woke too late for the previous job may still be
+            // looking at it; its ranges were all taken, so it leaves right away
+            std::unique_lock<std::mutex> lk(mu_);
+            finished_.wait(lk, [this] { return holders_ == 0; });
+            fn_ = fn;
+            ctx_ = ctx;
+            count_ = count;
+            chunk_ = (count + chunks - 1) / chunks;
+            chunks_ = (count + chunk_ - 1) / chunk_;
+            next_.store(0);
+            done_ = 0;
+            generation_++;
+        }
+        wake_.notify_all();
+
+        work();
+        std::unique_lock<std::mutex> lk(mu_);
+        finished_.wait(lk, [this] { return done_ == chunks_ && holders_ == 0; });
+    }
+
+private:
+    void work() {
+        int done = 0;
+        for (int c; (c = next_.fetch_add(1)) < chunks_;) {
+            const int begin = c * chunk_;
+            fn_(ctx_, begin, begin + chunk_ < count_ ? begin + chunk_ : count_);
+            done++;
+        }
+        std::lock_guard<std::mutex> lk(mu_);
+        done_ += done;
+        if (done_ == chunks_) finished_.notify_all();
+    }
+
+    void worker() {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lk(mu_);
+        for (;;) {
+            wake_.wait(lk, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                x86_nn_free_thread_scratch();   // __thread buffers are not freed on exit
+                return;
+            }
+            seen = generation_;
+            holders_++;
+            lk.unlock();
+            work();
+            lk.lock();
+            if (--holders_ == 0) finished_.notify_all();
+        }
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &t : workers_) t.join();
+        workers_.clear();
+    }
+
+    std::mutex run_mu_;                 // held by the thread that owns the current job
+    std::mutex mu_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    std::vector<std::thread> workers_;
+    int size_ = 1;
+    bool stop_ = false;
+    uint64_t generation_ = 0;
+    int holders_ = 0;                   // workers inside work() for the current job
+    int done_ = 0;
+
+    ei_parallel_fn_t fn_ = nullptr;
+    void *ctx_ = nullptr;
+    int count_ = 0;
+    int chunk_ = 0;
+    int chunks_ = 0;
+    std::atomic<int> next_{0};
+};
+
+// never destroyed: the workers may outlive static destructors at exit
+ThreadPool &pool() {
+    static ThreadPool *p = new ThreadPool(EI_CLASSIFIER_PARALLEL_THREADS);
+    return *p;
+}
+
+} // namespace
+
+void ei_thread_pool_set_size(int threads) {
+    pool().resize(threads);
+}
+
+int ei_thread_pool_size(void) {
+    return pool().size();
+}
+
+__attribute__((weak)) void ei_run_parallel(ei_parallel_fn_t fn, void *ctx, int count, int min_count) {
+    pool().run(fn, ctx, count, min_count);
+}
+
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_NN
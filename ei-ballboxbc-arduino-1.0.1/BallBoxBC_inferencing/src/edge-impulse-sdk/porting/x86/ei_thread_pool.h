@@ -0,0 +1,14 @@
+#pragma once
+
+// Pool behind the default ei_run_parallel() on x86 hosts (ei_thread_pool.cpp).
+
+/**
+ * @brief resize the pool: 1 keeps everything on the calling thread, 0 means one
+ * thread per core; must not race with a running inference
+ */
+void ei_thread_pool_set_size(int threads);
+
+/**
+ * @brief threads that share the work, the caller included
+ */
+int ei_thread_pool_size(void);
@@ -1704,6 +1704,7 @@ limitations under the License.
 #if ESP_NN
 #include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
 #endif
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/packed_weights.h"
 
 
 long long conv_total_time = 0;
@@ -1715,6 +1716,9 @@ struct NodeData {
   OpDataConv op_data;
 #if ESP_NN
   int buffer_idx;
+  // 1x1 convs: bias + input_offset * sum(filter) per output channel, so
+  // Eval skips the offset add per multiply; nullptr for other convs
+  int32_t* folded_bias;
 #endif
 };
 
@@ -1811,6 +1815,38 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     } else {
       data->buffer_idx = -1;
     }
+
+    data->folded_bias = nullptr;
+#if defined(esp_nn_conv_s8_1x1_folded)
+    if (filter_width == 1 && filter_height == 1 &&
+        data->op_data.padding.width == 0 && data->op_data.padding.height == 0 &&
+        params.dilation_width_factor == 1 && params.dilation_height_factor == 1 &&
+        filter->type == kTfLiteInt8) {
+      // computed by the first Prepare and kept (packed_weights.h); without
+      // room for it Eval keeps the plain kernel
+      const size_t folded_bytes = num_channels * sizeof(int32_t);
+      bool fresh = false;
+      data->folded_bias = static_cast<int32_t*>(
+          PackedWeightsGet(filter->data.data, folded_bytes, 0, &fresh));
+      if (data->folded_bias == nullptr) {
+        data->folded_bias = static_cast<int32_t*>(
+            context->AllocatePersistentBuffer(context, folded_bytes));
+        fresh = true;
+      }
+      TfLiteTensor* bias =
+          micro_context->AllocateTempInputTensor(node, kConvBiasTensor);
+      if (data->folded_bias != nullptr && fresh) {
+        esp_nn_conv_s8_fold_bias(GetTensorData<int8_t>(filter),
+                                 bias ? GetTensorData<int32_t>(bias) : nullptr,
+                                 input->dims->data[3], num_channels,
+                                 -data->op_data.input_zero_point,
+                                 data->folded_bias);
+      }
+      if (bias != nullptr) {
+        micro_context->DeallocateTempTfLiteTensor(bias);
+      }
+    }
+#endif
   }
 #endif
 
@@ -1906,6 +1942,16 @@ inline void EvalQuantizedPerChannel(
                               };
 
     for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+#if defined(esp_nn_conv_s8_1x1_folded)
+      if (data.folded_bias != nullptr) {
+        esp_nn_conv_s8_1x1_folded(&input_dims, input_data + i_batch * input_size,
+                                  tflite::micro::GetTensorData<int8_t>(filter),
+                                  data.folded_bias,
+                                  &output_dims, output_data + i_batch * output_size,
+                                  &conv_params, &quant_data);
+        continue;
+      }
+#endif
       esp_nn_conv_s8(&input_dims, input_data + i_batch * input_size,
                      &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
                      tflite::micro::GetTensorData<int32_t>(bias),
@@ -2036,6 +2082,328 @@ TfLiteRegistration Register_CONV_2D() {
 
 }  // namespace tflite
 
+#elif EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/conv.h"
+
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/portable_tensor_utils.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
+
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/packed_weights.h"
+
+namespace tflite {
+namespace {
+
+struct OpDataX86 {
+  OpDataConv reference;  // first, ConvPrepare() sees an OpDataConv
+  void* packed;          // filter packed at prepare, nullptr: packed per call
+};
+
+// X86-NN view of the node; false when the reference kernel has to run
+// (dilation, grouped conv).
+bool GetX86ConvParams(const TfLiteConvParams& params, const OpDataConv& data,
+                      const RuntimeShape& input_shape,
+                      const RuntimeShape& filter_shape,
+                      const RuntimeShape& output_shape, x86_nn_conv_params_t* p,
+                      x86_nn_dims_t* in_dims, x86_nn_dims_t* filter_dims,
+                      x86_nn_dims_t* out_dims) {
+  if (params.dilation_width_factor != 1 || params.dilation_height_factor != 1 ||
+      filter_shape.Dims(3) != input_shape.Dims(3)) {
+    return false;
+  }
+  p->input_offset = -data.input_zero_point;
+  p->output_offset = data.output_zero_point;
+  p->activation_min = data.output_activation_min;
+  p->activation_max = data.output_activation_max;
+  p->stride_width = params.stride_width;
+  p->stride_height = params.stride_height;
+  p->pad_width = data.padding.width;
+  p->pad_height = data.padding.height;
+  p->depth_multiplier = 1;
+  *in_dims = {input_shape.Dims(1), input_shape.Dims(2), input_shape.Dims(3)};
+  *filter_dims = {filter_shape.Dims(1), filter_shape.Dims(2),
+                  filter_shape.Dims(0)};
+  *out_dims = {output_shape.Dims(1), output_shape.Dims(2),
+               output_shape.Dims(3)};
+  return true;
+}
+
+// int8 x int8 through X86-NN, one batch entry at a time, on the filter packed
+// at prepare when there is one. Returns -1 when the reference kernel has to
+// run instead (dilation, grouped conv, no AVX2).
+int EvalX86Int8(const TfLiteConvParams& params, const OpDataX86& data,
+                const TfLiteEvalTensor* input, const TfLiteEvalTensor* filter,
+                const TfLiteEvalTensor* bias, TfLiteEvalTensor* output) {
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  x86_nn_conv_params_t p;
+  x86_nn_dims_t in_dims, filter_dims, out_dims;
+  if (!GetX86ConvParams(params, data.reference, input_shape,
+                        tflite::micro::GetTensorShape(filter), output_shape,
+                        &p, &in_dims, &filter_dims, &out_dims)) {
+    return -1;
+  }
+  const x86_nn_quant_t q = {data.reference.per_channel_output_multiplier,
+                            data.reference.per_channel_output_shift};
+
+  const int8_t* in = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t* out = tflite::micro::GetTensorData<int8_t>(output);
+  for (int b = 0; b < input_shape.Dims(0); b++) {
+    const int8_t* in_b = in + b * input_shape.FlatSize() / input_shape.Dims(0);
+    int8_t* out_b = out + b * output_shape.FlatSize() / output_shape.Dims(0);
+    if (data.packed != nullptr &&
+        x86_nn_conv_s8_packed(data.packed, &p, &in_dims, in_b, &filter_dims,
+                              &out_dims, out_b) == 0) {
+      continue;
+    }
+    if (x86_nn_conv_s8(&p, &q, &in_dims, in_b, &filter_dims,
+                       tflite::micro::GetTensorData<int8_t>(filter),
+                       tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                       &out_dims, out_b) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataX86));
+}
+
+// ConvPrepare(), then the int8 filter, bias and requantization packed once
+// and kept across graph initialisations (packed_weights.h) so Eval skips the
+// repacking. Packing is an optimization only: without room for it Eval packs
+// per call.
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(ConvPrepare(context, node));
+
+  OpDataX86* data = static_cast<OpDataX86*>(node->user_data);
+  const auto& params =
+      *(static_cast<const TfLiteConvParams*>(node->builtin_data));
+  data->packed = nullptr;
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kConvInputTensor);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, kConvWeightsTensor);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, kConvBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kConvOutputTensor);
+
+  x86_nn_conv_params_t p;
+  x86_nn_dims_t in_dims, filter_dims, out_dims;
+  if (input->type == kTfLiteInt8 && filter->type == kTfLiteInt8 &&
+      GetX86ConvParams(params, data->reference, GetTensorShape(input),
+                       GetTensorShape(filter), GetTensorShape(output), &p,
+                       &in_dims, &filter_dims, &out_dims)) {
+    const int32_t bytes =
+        x86_nn_conv_s8_packed_size(&p, &in_dims, &filter_dims);
+    bool fresh = false;
+    if (bytes > 0) {
+      // the blob's layout follows the kernel level, which can be capped
+      // (x86_nn_set_max_level) between initialisations
+      data->packed = PackedWeightsGet(filter->data.data, bytes,
+                                      (int)x86_nn_level(), &fresh);
+      if (data->packed == nullptr) {
+        data->packed = context->AllocatePersistentBuffer(context, bytes);
+        fresh = true;
+      }
+    }
+    const x86_nn_quant_t q = {data->reference.per_channel_output_multiplier,
+                              data->reference.per_channel_output_shift};
+    if (data->packed != nullptr && fresh &&
+        x86_nn_conv_s8_pack(&p, &q, &in_dims, &filter_dims,
+                            GetTensorData<int8_t>(filter),
+                            bias ? GetTensorData<int32_t>(bias) : nullptr,
+                            data->packed) != 0) {
+      PackedWeightsForget(filter->data.data, 1);
+      data->packed = nullptr;
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kConvWeightsTensor);
+  const TfLiteEvalTensor* bias =
+      (NumInputs(node) == 3)
+          ? tflite::micro::GetEvalInput(context, node, kConvBiasTensor)
+          : nullptr;
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kConvOutputTensor);
+
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+  const auto& params =
+      *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const auto& x86_data = *(static_cast<const OpDataX86*>(node->user_data));
+  const OpDataConv& data = x86_data.reference;
+
+  TF_LITE_ENSURE_EQ(context, input->type, output->type);
+  TF_LITE_ENSURE_MSG(
+      context,
+      input->type == filter->type ||
+          (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8) ||
+          (input->type == kTfLiteInt8 && filter->type == kTfLiteInt4),
+      "Hybrid models are not supported on TFLite Micro.");
+
+  switch (input->type) {  // Already know in/out types are same.
+    case kTfLiteFloat32: {
+#if EI_TFLITE_DISABLE_CONV_2D_IN_F32
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+#endif
+      tflite::reference_ops::Conv(
+          ConvParamsFloat(params, data), tflite::micro::GetTensorShape(input),
+          tflite::micro::GetTensorData<float>(input),
+          tflite::micro::GetTensorShape(filter),
+          tflite::micro::GetTensorData<float>(filter),
+          tflite::micro::GetTensorShape(bias),
+          tflite::micro::GetOptionalTensorData<float>(bias),
+          tflite::micro::GetTensorShape(output),
+          tflite::micro::GetTensorData<float>(output),
+          tflite::micro::GetTensorShape(nullptr), nullptr);
+      break;
+    }
+    case kTfLiteInt16: {
+      switch (bias->type) {
+        case kTfLiteInt32: {
+          reference_integer_ops::ConvPerChannel(
+              ConvParamsQuantized(params, data),
+              data.per_channel_output_multiplier, data.per_channel_output_shift,
+              tflite::micro::GetTensorShape(input),
+              tflite::micro::GetTensorData<int16_t>(input),
+              tflite::micro::GetTensorShape(filter),
+              tflite::micro::GetTensorData<int8_t>(filter),
+              tflite::micro::GetTensorShape(bias),
+              tflite::micro::GetOptionalTensorData<std::int32_t>(bias),
+              tflite::micro::GetTensorShape(output),
+              tflite::micro::GetTensorData<int16_t>(output));
+          break;
+        }
+        case kTfLiteInt64: {
+          reference_integer_ops::ConvPerChannel(
+              ConvParamsQuantized(params, data),
+              data.per_channel_output_multiplier, data.per_channel_output_shift,
+              tflite::micro::GetTensorShape(input),
+              tflite::micro::GetTensorData<int16_t>(input),
+              tflite::micro::GetTensorShape(filter),
+              tflite::micro::GetTensorData<int8_t>(filter),
+              tflite::micro::GetTensorShape(bias),
+              tflite::micro::GetOptionalTensorData<std::int64_t>(bias),
+              tflite::micro::GetTensorShape(output),
+              tflite::micro::GetTensorData<int16_t>(output));
+          break;
+        }
+        default:
+          MicroPrintf("Bias type %s (%d) not supported.",
+                      TfLiteTypeGetName(bias->type), bias->type);
+          return kTfLiteError;
+      }
+      break;
+    }
+    case kTfLiteInt8: {
+#if EI_TFLITE_DISABLE_CONV_2D_IN_I8
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+#endif
+      switch (filter->type) {
+        case kTfLiteInt4: {
+          int8_t* unpacked_filter_data = static_cast<int8_t*>(
+              context->GetScratchBuffer(context, data.filter_buffer_index));
+          tflite::tensor_utils::UnpackDenseInt4IntoInt8(
+              tflite::micro::GetTensorData<int8_t>(filter),
+              tflite::micro::GetTensorShape(filter).FlatSize(),
+              unpacked_filter_data);
+          reference_integer_ops::ConvPerChannel(
+              ConvParamsQuantized(params, data),
+              data.per_channel_output_multiplier, data.per_channel_output_shift,
+              tflite::micro::GetTensorShape(input),
+              tflite::micro::GetTensorData<int8_t>(input),
+              tflite::micro::GetTensorShape(filter), unpacked_filter_data,
+              tflite::micro::GetTensorShape(bias),
+              tflite::micro::GetOptionalTensorData<int32_t>(bias),
+              tflite::micro::GetTensorShape(output),
+              tflite::micro::GetTensorData<int8_t>(output));
+          break;
+        }
+        case kTfLiteInt8: {
+          if (EvalX86Int8(params, x86_data, input, filter, bias, output) == 0) {
+            break;
+          }
+          reference_integer_ops::ConvPerChannel(
+              ConvParamsQuantized(params, data),
+              data.per_channel_output_multiplier, data.per_channel_output_shift,
+              tflite::micro::GetTensorShape(input),
+              tflite::micro::GetTensorData<int8_t>(input),
+              tflite::micro::GetTensorShape(filter),
+              tflite::micro::GetTensorData<int8_t>(filter),
+              tflite::micro::GetTensorShape(bias),
+              tflite::micro::GetOptionalTensorData<int32_t>(bias),
+              tflite::micro::GetTensorShape(output),
+              tflite::micro::GetTensorData<int8_t>(output));
+          break;
+        }
+        default:
+          MicroPrintf("Weight type %s (%d) not supported.",
+                      TfLiteTypeGetName(filter->type), filter->type);
+          return kTfLiteError;
+      }
+      break;
+    }
+    default:
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration Register_CONV_2D() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
+}
+
+}  // namespace tflite
+
 #else
 /* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
 
@@ -0,0 +1,158 @@
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_FIXED_SHAPE_KERNELS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_FIXED_SHAPE_KERNELS_H_
+
+// int8 CONV_2D / DEPTHWISE_CONV_2D with every shape known at compile time, for
+// the specialized EON invoke (EI_CLASSIFIER_EON_SPECIALIZED, generated by
+// host/eon_specialize). Each node gets a shape struct of constants:
+//
+//   struct Node3 {
+//     static const int in_h = 48, in_w = 48, in_c = 8;
+//     static const int out_h = 48, out_w = 48, out_c = 48;
+//     static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+//     static const int pad_h = 0, pad_w = 0;
+//     static const int input_offset = 128, output_offset = -128;
+//     static const int act_min = -128, act_max = 127;
+//   };
+//
+// so the loops over channels and filter taps have constant trip counts the
+// compiler can unroll and vectorize. The per-channel multipliers still come
+// from the OpDataConv the kernel's Prepare filled in (every backend's node
+// data starts with one). Results are exactly those of reference_integer_ops.
+// C++11, no dilation, depth multiplier 1.
+
+#include <stdint.h>
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/compatibility.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/conv.h"
+
+namespace tflite {
+namespace fixed_shape {
+
+template <typename S>
+inline void CheckOpData(const OpDataConv& data) {
+  TFLITE_DCHECK_EQ(data.padding.height, S::pad_h);
+  TFLITE_DCHECK_EQ(data.padding.width, S::pad_w);
+  TFLITE_DCHECK_EQ(-data.input_zero_point, S::input_offset);
+  TFLITE_DCHECK_EQ(data.output_zero_point, S::output_offset);
+  TFLITE_DCHECK_EQ(data.output_activation_min, S::act_min);
+  TFLITE_DCHECK_EQ(data.output_activation_max, S::act_max);
+  (void)data;
+}
+
+template <typename S, int C>
+inline void Requantize(const OpDataConv& data, const int32_t* acc,
+                       int8_t* output) {
+  const int32_t lo = S::act_min, hi = S::act_max;
+  for (int c = 0; c < C; ++c) {
+    int32_t v = MultiplyByQuantizedMultiplier(
+        acc[c], data.per_channel_output_multiplier[c],
+        data.per_channel_output_shift[c]);
+    v += S::output_offset;
+    v = v < lo ? lo : v;
+    v = v > hi ? hi : v;
+    output[c] = static_cast<int8_t>(v);
+  }
+}
+
+// Filter OHWI, bias may be null.
+template <typename S>
+inline void Conv(const OpDataConv& data, const int8_t* input,
+                 const int8_t* filter, const int32_t* bias, int8_t* output) {
+  CheckOpData<S>(data);
+  const int IC = S::in_c, OC = S::out_c;
+  int32_t acc[OC];
+
+  if (S::filter_h == 1 && S::filter_w == 1 && S::pad_h == 0 &&
+      S::pad_w == 0) {
+    // Pointwise: the input offset times the filter sum goes into the bias
+    // once per call, leaving a plain int8 dot product per output channel.
+    int32_t base[OC];
+    for (int oc = 0; oc < OC; ++oc) {
+      int32_t sum = 0;
+      for (int ic = 0; ic < IC; ++ic) sum += filter[oc * IC + ic];
+      base[oc] = (bias ? bias[oc] : 0) + S::input_offset * sum;
+    }
+    for (int oy = 0; oy < S::out_h; ++oy) {
+      for (int ox = 0; ox < S::out_w; ++ox) {
+        const int8_t* in =
+            input + ((oy * S::stride_h) * S::in_w + ox * S::stride_w) * IC;
+        for (int oc = 0; oc < OC; ++oc) {
+          const int8_t* f = filter + oc * IC;
+          int32_t sum = 0;
+          for (int ic = 0; ic < IC; ++ic) sum += f[ic] * in[ic];
+          acc[oc] = base[oc] + sum;
+        }
+        Requantize<S, OC>(data, acc, output + (oy * S::out_w + ox) * OC);
+      }
+    }
+    return;
+  }
+
+  for (int oy = 0; oy < S::out_h; ++oy) {
+    const int iy0 = oy * S::stride_h - S::pad_h;
+    for (int ox = 0; ox < S::out_w; ++ox) {
+      const int ix0 = ox * S::stride_w - S::pad_w;
+      for (int oc = 0; oc < OC; ++oc) acc[oc] = 0;
+      for (int ky = 0; ky < S::filter_h; ++ky) {
+        const int iy = iy0 + ky;
+        if (iy < 0 || iy >= S::in_h) continue;
+        for (int kx = 0; kx < S::filter_w; ++kx) {
+          const int ix = ix0 + kx;
+          if (ix < 0 || ix >= S::in_w) continue;
+          const int8_t* in = input + (iy * S::in_w + ix) * IC;
+          for (int oc = 0; oc < OC; ++oc) {
+            const int8_t* f =
+                filter + ((oc * S::filter_h + ky) * S::filter_w + kx) * IC;
+            int32_t sum = 0;
+            for (int ic = 0; ic < IC; ++ic) {
+              sum += f[ic] * (in[ic] + S::input_offset);
+            }
+            acc[oc] += sum;
+          }
+        }
+      }
+      if (bias) {
+        for (int oc = 0; oc < OC; ++oc) acc[oc] += bias[oc];
+      }
+      Requantize<S, OC>(data, acc, output + (oy * S::out_w + ox) * OC);
+    }
+  }
+}
+
+// Filter 1HWC (depth multiplier 1, so out_c == in_c), bias may be null.
+template <typename S>
+inline void DepthwiseConv(const OpDataConv& data, const int8_t* input,
+                          const int8_t* filter, const int32_t* bias,
+                          int8_t* output) {
+  CheckOpData<S>(data);
+  const int C = S::out_c;
+  int32_t acc[C];
+
+  for (int oy = 0; oy < S::out_h; ++oy) {
+    const int iy0 = oy * S::stride_h - S::pad_h;
+    for (int ox = 0; ox < S::out_w; ++ox) {
+      const int ix0 = ox * S::stride_w - S::pad_w;
+      for (int c = 0; c < C; ++c) acc[c] = bias ? bias[c] : 0;
+      for (int ky = 0; ky < S::filter_h; ++ky) {
+        const int iy = iy0 + ky;
+        if (iy < 0 || iy >= S::in_h) continue;
+        for (int kx = 0; kx < S::filter_w; ++kx) {
+          const int ix = ix0 + kx;
+          if (ix < 0 || ix >= S::in_w) continue;
+          const int8_t* in = input + (iy * S::in_w + ix) * C;
+          const int8_t* f = filter + (ky * S::filter_w + kx) * C;
+          for (int c = 0; c < C; ++c) {
+            acc[c] += f[c] * (in[c] + S::input_offset);
+          }
+        }
+      }
+      Requantize<S, C>(data, acc, output + (oy * S::out_w + ox) * C);
+    }
+  }
+}
+
+}  // namespace fixed_shape
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_FIXED_SHAPE_KERNELS_H_
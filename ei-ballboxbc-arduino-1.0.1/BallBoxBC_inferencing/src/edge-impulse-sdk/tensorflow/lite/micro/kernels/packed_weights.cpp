@@ -0,0 +1,74 @@
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/packed_weights.h"
+
+#if EI_TFLITE_PACKED_WEIGHTS
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mutex>
+
+namespace tflite {
+namespace {
+
+// Two models' worth of convs (the built-in one and a hot-swapped one)
+constexpr int kMaxPackedWeights = 32;
+
+struct PackedWeights {
+  const void* filter;   // nullptr: free entry
+  size_t bytes;
+  int tag;
+  void* raw;            // malloc(), not ei_malloc(): must outlive inference scopes
+  void* data;           // raw, 16-byte aligned
+};
+
+PackedWeights entries[kMaxPackedWeights];
+std::mutex entries_mutex;
+
+}  // namespace
+
+void* PackedWeightsGet(const void* filter, size_t bytes, int tag, bool* fresh) {
+  std::lock_guard<std::mutex> lock(entries_mutex);
+  PackedWeights* free_entry = nullptr;
+  for (PackedWeights& e : entries) {
+    if (e.filter == filter) {
+      if (e.bytes == bytes && e.tag == tag) {
+        *fresh = false;
+        return e.data;
+      }
+      // packed for another level: stale, repack in its place
+      free(e.raw);
+      memset(&e, 0, sizeof(e));
+    }
+    if (e.filter == nullptr && free_entry == nullptr) {
+      free_entry = &e;
+    }
+  }
+  if (free_entry == nullptr) {
+    return nullptr;
+  }
+  void* raw = calloc(1, bytes + 15);
+  if (raw == nullptr) {
+    return nullptr;
+  }
+  free_entry->filter = filter;
+  free_entry->bytes = bytes;
+  free_entry->tag = tag;
+  free_entry->raw = raw;
+  free_entry->data = (void*)(((uintptr_t)raw + 15) & ~(uintptr_t)15);
+  *fresh = true;
+  return free_entry->data;
+}
+
+void PackedWeightsForget(const void* begin, size_t bytes) {
+  std::lock_guard<std::mutex> lock(entries_mutex);
+  for (PackedWeights& e : entries) {
+    if (e.filter != nullptr && (uintptr_t)e.filter - (uintptr_t)begin < bytes) {
+      free(e.raw);
+      memset(&e, 0, sizeof(e));
+    }
+  }
+}
+
+}  // namespace tflite
+
+#endif  // EI_TFLITE_PACKED_WEIGHTS
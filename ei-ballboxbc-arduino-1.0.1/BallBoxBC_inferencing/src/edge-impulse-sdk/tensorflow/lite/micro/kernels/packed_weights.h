@@ -0,0 +1,44 @@
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
+
+// Data a conv kernel derives from a constant filter at prepare time (X86-NN's
+// packed filter, ESP-NN's folded 1x1 bias), kept across graph
+// initialisations. The EON graph is initialised again for every inference and
+// its persistent buffers go with it, so without this the packing would run,
+// and spill to the heap, on every frame. A filter tensor belongs to one node,
+// so there is one entry per filter data pointer, holding the size of the
+// derived data and a tag for whatever else its layout depends on (X86-NN's
+// kernel level); a lookup with another size or tag replaces it. Entries live
+// on the heap outside any inference scope.
+
+#include <stddef.h>
+
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1 || EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN == 1
+#define EI_TFLITE_PACKED_WEIGHTS 1
+#else
+#define EI_TFLITE_PACKED_WEIGHTS 0
+#endif
+
+namespace tflite {
+
+#if EI_TFLITE_PACKED_WEIGHTS
+// 16-byte aligned buffer of `bytes` for `filter` packed as `tag`. *fresh is
+// true when it was just allocated and the caller has to fill it. nullptr when
+// the cache is full or out of memory: the kernel falls back to a persistent
+// buffer.
+void* PackedWeightsGet(const void* filter, size_t bytes, int tag, bool* fresh);
+
+// Drops the entries whose filter lies in [begin, begin + bytes), before the
+// memory holding a model (a hot-swapped model image) is freed or when
+// filling an entry failed.
+void PackedWeightsForget(const void* begin, size_t bytes);
+#else
+inline void* PackedWeightsGet(const void*, size_t, int, bool*) { return nullptr; }
+inline void PackedWeightsForget(const void*, size_t) {}
+#endif
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
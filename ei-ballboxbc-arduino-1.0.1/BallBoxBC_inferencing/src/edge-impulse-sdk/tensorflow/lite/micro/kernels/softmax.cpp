@@ -452,6 +452,232 @@ TfLiteRegistration Register_SOFTMAX() {
 
 }  // namespace tflite
 
+#elif EI_CLASSIFIER_TFLITE_ENABLE_X86_NN == 1
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/softmax.h"
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/softmax.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/op_macros.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// SoftmaxParams comes first so SoftmaxPrepare can fill it in place. For int8
+// input every exp() the reference kernel evaluates is one of 256 values
+// (input - row max), so Prepare tabulates them once with the same gemmlowp
+// arithmetic and Eval only does the table lookups, sum and reciprocal. Like the
+// other X86-NN kernels it is off at X86_NN_LEVEL_NONE (reference kernels).
+struct OpDataX86 {
+  SoftmaxParams params;
+  bool has_lut;
+  int32_t exp_lut[256];  // FixedPoint<0> raw, indexed by max - input
+  int32_t sum_lut[256];  // the same rescaled to the accumulator, 0 below diff_min
+};
+
+constexpr int kScaledDiffIntegerBits = 5;
+constexpr int kAccumulationIntegerBits = 12;
+
+void* SoftmaxInitX86(TfLiteContext* context, const char* buffer,
+                     size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataX86));
+}
+
+TfLiteStatus SoftmaxPrepareX86(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_OK(context, SoftmaxPrepare(context, node));
+  OpDataX86* data = static_cast<OpDataX86*>(node->user_data);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  data->has_lut =
+      input->type == kTfLiteInt8 && x86_nn_level() != X86_NN_LEVEL_NONE;
+  micro_context->DeallocateTempTfLiteTensor(input);
+  if (!data->has_lut) {
+    return kTfLiteOk;
+  }
+
+  using FixedPointScaledDiff =
+      gemmlowp::FixedPoint<int32_t, kScaledDiffIntegerBits>;
+  for (int i = 0; i < 256; i++) {
+    const int32_t input_diff = -i;
+    const int32_t input_diff_rescaled =
+        MultiplyByQuantizedMultiplierGreaterThanOne(
+            input_diff, data->params.input_multiplier,
+            data->params.input_left_shift);
+    const auto exp_in_0 = exp_on_negative_values(
+        FixedPointScaledDiff::FromRaw(input_diff_rescaled));
+    data->exp_lut[i] = exp_in_0.raw();
+    data->sum_lut[i] = input_diff >= data->params.diff_min
+                           ? gemmlowp::Rescale<kAccumulationIntegerBits>(
+                                 exp_in_0).raw()
+                           : 0;
+  }
+  return kTfLiteOk;
+}
+
+// reference_ops::Softmax for int8 input with the exp() calls looked up
+template <typename OutputT>
+void SoftmaxInt8Lut(const OpDataX86& data, const TfLiteEvalTensor* input,
+                    TfLiteEvalTensor* output) {
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  OutputT* output_data = tflite::micro::GetTensorData<OutputT>(output);
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size =
+      MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth =
+      MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int diff_min = data.params.diff_min;
+
+  for (int i = 0; i < outer_size; ++i) {
+    const int8_t* in = input_data + i * depth;
+    OutputT* out = output_data + i * depth;
+    int8_t max_in_row = std::numeric_limits<int8_t>::min();
+    for (int c = 0; c < depth; ++c) {
+      max_in_row = std::max(max_in_row, in[c]);
+    }
+
+    int32_t sum_of_exps = 0;
+    for (int c = 0; c < depth; ++c) {
+      sum_of_exps += data.sum_lut[max_in_row - in[c]];
+    }
+    int num_bits_over_unit;
+    const int32_t shifted_scale = GetReciprocal(
+        sum_of_exps, kAccumulationIntegerBits, &num_bits_over_unit);
+    const int exponent = num_bits_over_unit + 31 - (sizeof(OutputT) * 8);
+
+    for (int c = 0; c < depth; ++c) {
+      const int32_t input_diff = static_cast<int32_t>(in[c]) - max_in_row;
+      if (input_diff >= diff_min) {
+        const int32_t unsat_output = gemmlowp::RoundingDivideByPOT(
+            gemmlowp::SaturatingRoundingDoublingHighMul(
+                shifted_scale, data.exp_lut[-input_diff]),
+            exponent);
+        const int32_t shifted_output =
+            unsat_output +
+            static_cast<int32_t>(std::numeric_limits<OutputT>::min());
+        out[c] = static_cast<OutputT>(std::max(
+            std::min(shifted_output,
+                     static_cast<int32_t>(std::numeric_limits<OutputT>::max())),
+            static_cast<int32_t>(std::numeric_limits<OutputT>::min())));
+      } else {
+        out[c] = std::numeric_limits<OutputT>::min();
+      }
+    }
+  }
+}
+
+
+void SoftmaxQuantized(const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
+                      const SoftmaxParams& op_data) {
+  if (input->type == kTfLiteInt8) {
+    if (output->type == kTfLiteInt16) {
+      tflite::reference_ops::Softmax(
+          op_data, tflite::micro::GetTensorShape(input),
+          tflite::micro::GetTensorData<int8_t>(input),
+          tflite::micro::GetTensorShape(output),
+          tflite::micro::GetTensorData<int16_t>(output));
+    } else {
+      tflite::reference_ops::Softmax(
+          op_data, tflite::micro::GetTensorShape(input),
+          tflite::micro::GetTensorData<int8_t>(input),
+          tflite::micro::GetTensorShape(output),
+          tflite::micro::GetTensorData<int8_t>(output));
+    }
+  } else {
+    tflite::reference_ops::SoftmaxInt16(
+        op_data, tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<int16_t>(input),
+        tflite::micro::GetTensorShape(output),
+        tflite::micro::GetTensorData<int16_t>(output));
+  }
+}
+
+TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpDataX86& data = *static_cast<const OpDataX86*>(node->user_data);
+  SoftmaxParams op_data = data.params;
+
+  switch (input->type) {
+    case kTfLiteFloat32: {
+#if EI_TFLITE_DISABLE_SOFTMAX_IN_F32
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+#endif
+      tflite::reference_ops::Softmax(
+          op_data, tflite::micro::GetTensorShape(input),
+          tflite::micro::GetTensorData<float>(input),
+          tflite::micro::GetTensorShape(output),
+          tflite::micro::GetTensorData<float>(output));
+      return kTfLiteOk;
+    }
+    case kTfLiteInt8: {
+#if EI_TFLITE_DISABLE_SOFTMAX_IN_I8
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+#endif
+      if (data.has_lut && output->type == kTfLiteInt8) {
+        SoftmaxInt8Lut<int8_t>(data, input, output);
+      } else if (data.has_lut && output->type == kTfLiteInt16) {
+        SoftmaxInt8Lut<int16_t>(data, input, output);
+      } else {
+        SoftmaxQuantized(input, output, op_data);
+      }
+      return kTfLiteOk;
+    }
+    case kTfLiteInt16: {
+#if EI_TFLITE_DISABLE_SOFTMAX_IN_I16
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+#endif
+      SoftmaxQuantized(input, output, op_data);
+      return kTfLiteOk;
+    }
+    default:
+      MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
+                  input->type);
+      return kTfLiteError;
+  }
+}
+}  // namespace
+
+TfLiteRegistration Register_SOFTMAX() {
+  return tflite::micro::RegisterOp(SoftmaxInitX86, SoftmaxPrepareX86, SoftmaxEval);
+}
+
+}  // namespace tflite
+
 #else
 /* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
 
@@ -84,6 +84,7 @@ const ei_config_tflite_eon_graph_t ei_config_graph_854371_3 = {
     .model_reset = &tflite_learn_854371_3_reset,
     .model_input = &tflite_learn_854371_3_input,
     .model_output = &tflite_learn_854371_3_output,
+    .model_free_regions = &tflite_learn_854371_3_free_regions,
 };
 
 const uint8_t ei_output_tensors_indices_854371_3[1] = { 0 };
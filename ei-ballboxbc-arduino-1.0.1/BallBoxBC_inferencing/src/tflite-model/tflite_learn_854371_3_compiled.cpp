@@ -36,6 +36,8 @@
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/classifier/ei_arena_regions.h"
+#include "edge-impulse-sdk/dsp/ei_alloc_profiler.h"
 
 #if EI_CLASSIFIER_PRINT_STATE
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -75,6 +77,17 @@ extern void ei_printf(const char *format, ...);
 #define MODEL_SECTION(X)
 #endif
 
+// weights host/tier_plan put in internal RAM (ESP32: ".dram1", as DRAM_ATTR);
+// the Arduino IDE passes no defines to a library, hence the ESP32 default
+#if !defined(EI_WEIGHTS_FAST_LOCATION) && defined(CONFIG_IDF_TARGET_ESP32)
+#define EI_WEIGHTS_FAST_LOCATION .dram1
+#endif
+#if defined(EI_WEIGHTS_FAST_LOCATION) && (defined(__GNUC__) || defined(__clang__))
+#define FAST_MODEL_SECTION __attribute__((section(STRINGIZE_VALUE_OF(EI_WEIGHTS_FAST_LOCATION))))
+#else
+#define FAST_MODEL_SECTION MODEL_SECTION(EI_MODEL_SECTION)
+#endif
+
 #ifndef EI_MAX_SCRATCH_BUFFER_COUNT
 #ifndef CONFIG_IDF_TARGET_ESP32S3
 #define EI_MAX_SCRATCH_BUFFER_COUNT 14
@@ -93,12 +106,24 @@ using namespace tflite::ops::micro;
 
 namespace {
 
+// Arena size and tensorData offsets re-planned by host/arena_plan (ADD and PAD
+// run in place); rerun it after every model export.
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX) || defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX_GNU)
-constexpr int kTensorArenaSize = 242592;
+constexpr int kTensorArenaSize = 44400;
 #else
-constexpr int kTensorArenaSize = 241568;
+constexpr int kTensorArenaSize = 43376;
 #endif
 
+// Two-tier placement from host/tier_plan: tensors whose tensorData row points
+// into tensor_arena_slow (and the persistent / scratch buffers when
+// kTierScratchSlow) live in a second arena in external RAM. Static arenas
+// take their sections from EI_TENSOR_ARENA_LOCATION /
+// EI_TENSOR_ARENA_SLOW_LOCATION; in heap mode a planned model gets both
+// arenas from ei_arena_calloc().
+constexpr bool kTierPlanned = true;
+constexpr int kTensorArenaSlowSize = 115248;
+constexpr bool kTierScratchSlow = false;
+
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC)
 #if defined (EI_TENSOR_ARENA_LOCATION)
 uint8_t tensor_arena[kTensorArenaSize] ALIGN(16) DEFINE_SECTION(STRINGIZE_VALUE_OF(EI_TENSOR_ARENA_LOCATION));
@@ -116,6 +141,16 @@ uint8_t tensor_arena[kTensorArenaSize] ALIGN(16) __attribute__((section(".tensor
 uint8_t* tensor_arena = NULL;
 #endif
 
+#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
+// Until init the arena rows hold offsets; starting this one at
+// kTensorArenaSize keeps the slow ones apart from the fast ones (tensor_tier).
+uint8_t* tensor_arena_slow = tensor_arena + kTensorArenaSize;
+#elif defined (EI_TENSOR_ARENA_SLOW_LOCATION)
+uint8_t tensor_arena_slow[kTensorArenaSlowSize ? kTensorArenaSlowSize : 1] ALIGN(16) DEFINE_SECTION(STRINGIZE_VALUE_OF(EI_TENSOR_ARENA_SLOW_LOCATION));
+#else
+uint8_t tensor_arena_slow[kTensorArenaSlowSize ? kTensorArenaSlowSize : 1] ALIGN(16);
+#endif
+
 static uint8_t* tensor_boundary;
 static uint8_t* current_location;
 
@@ -158,19 +193,19 @@ const TfArray<4, int> tensor_dimension0 = { 4, { 1,96,96,1 } };
 const TfArray<1, float> quant0_scale = { 1, { 0.0039215688593685627, } };
 const TfArray<1, int> quant0_zero = { 1, { -128 } };
 const TfLiteAffineQuantization quant0 = { (TfLiteFloatArray*)&quant0_scale, (TfLiteIntArray*)&quant0_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data1[4*2] = { 
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data1[4*2] = { 
   0, 0, 
   0, 1, 
   0, 1, 
   0, 0, 
 };
 const TfArray<2, int> tensor_dimension1 = { 2, { 4,2 } };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(8) int32_t tensor_data2[3] = { 38758, -42222, -41199, };
+const FAST_MODEL_SECTION ALIGN(8) int32_t tensor_data2[3] = { 38758, -42222, -41199, };
 const TfArray<1, int> tensor_dimension2 = { 1, { 3 } };
 const TfArray<3, float> quant2_scale = { 3, { 0.00012808330939151347, 0.0001355515414616093, 0.00013383600162342191, } };
 const TfArray<3, int> quant2_zero = { 3, { 0,0,0 } };
 const TfLiteAffineQuantization quant2 = { (TfLiteFloatArray*)&quant2_scale, (TfLiteIntArray*)&quant2_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data3[3*1*1*32] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data3[3*1*1*32] = { 
   /* [0][0][][] */ 89,75,119,-89,-60,8,-28,32,-13,53,37,-39,-33,-100,81,26,-59,87,78,108,-27,-31,44,-111,-127,113,-62,17,84,5,-24,-7, 
   /* [1][0][][] */ 57,-31,-67,25,-10,127,-26,-3,122,-47,2,-73,-63,107,43,-46,93,-43,-4,-89,-106,27,115,74,28,25,2,-24,-75,-50,-1,-28, 
   /* [2][0][][] */ -29,81,-75,83,87,-37,-30,116,95,36,127,-10,-98,-82,91,119,-78,-51,1,-109,74,120,-44,-84,94,-52,-16,-127,13,-71,85,-20, 
@@ -178,12 +213,12 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data3[3*1*1*32] =
 const TfArray<4, int> tensor_dimension3 = { 4, { 3,1,1,32 } };
 const TfArray<3, float> quant3_scale = { 3, { 0.0032010741997510195, 0.0033877212554216385, 0.0033448461908847094, } };
 const TfLiteAffineQuantization quant3 = { (TfLiteFloatArray*)&quant3_scale, (TfLiteIntArray*)&g0::quant2_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data4[32] = { 253, 393, -369, 475, 512, 530, -157, 440, 482, -201, 444, -75, -258, 514, 474, 405, -21, -351, -434, -470, -511, 461, 368, -218, 489, 94, -410, 660, 680, -452, -168, -313, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data4[32] = { 253, 393, -369, 475, 512, 530, -157, 440, 482, -201, 444, -75, -258, 514, 474, 405, -21, -351, -434, -470, -511, 461, 368, -218, 489, 94, -410, 660, 680, -452, -168, -313, };
 const TfArray<1, int> tensor_dimension4 = { 1, { 32 } };
 const TfArray<32, float> quant4_scale = { 32, { 4.092254675924778e-05, 4.1755727579584345e-05, 3.9437032683053985e-05, 4.2816958739422262e-05, 3.9505051972810179e-05, 4.1831444832496345e-05, 4.1931078158086166e-05, 4.2360552470199764e-05, 4.2272436985513195e-05, 4.0886148781282827e-05, 4.239940972183831e-05, 4.3514173739822581e-05, 4.301123772165738e-05, 4.308669304009527e-05, 4.2405761632835492e-05, 4.0838796849129722e-05, 4.1194976802216843e-05, 4.1128325392492115e-05, 4.1549486923031509e-05, 4.1100654925685376e-05, 4.2116182157769799e-05, 4.2057909013237804e-05, 4.1769362724153325e-05, 4.1765510104596615e-05, 4.1884512029355392e-05, 4.1093524487223476e-05, 4.2242219933541492e-05, 4.3632509914459661e-05, 4.1684848838485777e-05, 4.0513608837500215e-05, 3.9395552448695526e-05, 4.2172283428953961e-05, } };
 const TfArray<32, int> quant4_zero = { 32, { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } };
 const TfLiteAffineQuantization quant4 = { (TfLiteFloatArray*)&quant4_scale, (TfLiteIntArray*)&quant4_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data5[32*1*1*96] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data5[32*1*1*96] = { 
   /* [0][0][][] */ -45,-46,107,14,100,-20,-87,-102,70,-103,-107,2,62,8,-33,53,-51,-26,-66,-51,-66,-103,11,116,-119,7,84,-42,114,4,-31,-83,91,-67,-89,63,-106,-79,-89,35,70,-91,-95,109,58,-120,101,-20,20,-64,-38,104,-70,-46,-96,113,19,75,127,-114,-70,90,-46,52,-7,18,71,84,59,106,93,-113,108,-101,47,92,-103,20,-55,39,59,11,96,-3,-63,-42,-81,110,31,119,-11,-111,5,62,36,24, 
   /* [1][0][][] */ -44,45,-62,-10,-31,95,43,10,88,-100,-96,98,53,-24,12,77,100,-47,29,126,-41,-18,46,31,46,10,-39,118,-1,11,111,-62,49,106,-22,19,60,70,-5,-76,-49,16,-19,-87,-43,45,-21,-44,-25,-78,125,67,20,94,-77,-60,21,88,71,93,-51,104,-69,-76,-49,30,83,51,91,21,23,3,-114,103,-39,56,93,-50,-33,84,-73,99,-49,-119,38,127,-80,-56,89,91,104,16,97,85,14,4, 
   /* [2][0][][] */ 65,30,-73,91,-28,-48,93,89,-115,107,-47,117,87,-24,79,-127,-64,-35,32,47,-113,-24,108,14,-35,84,100,0,-81,74,99,106,-81,-14,-108,-118,-102,90,101,-37,-108,-89,8,-16,-95,119,-31,-92,113,44,85,-96,-59,58,29,11,-62,91,-76,8,-28,55,-47,67,87,47,41,93,-110,63,-1,-87,26,-89,25,22,-65,-37,-5,1,30,-85,-21,-44,-7,-112,-29,-44,85,109,-35,2,-31,-88,-59,-80, 
@@ -220,12 +255,12 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data5[32*1*1*96] =
 const TfArray<4, int> tensor_dimension5 = { 4, { 32,1,1,96 } };
 const TfArray<32, float> quant5_scale = { 32, { 0.0017903021071106195, 0.0018267524428665638, 0.0017253130208700895, 0.00187317980453372, 0.0017282887129113078, 0.0018300650408491492, 0.0018344238633289933, 0.0018532127141952515, 0.0018493578536435962, 0.0017887097783386707, 0.0018549126107245684, 0.0019036820158362389, 0.0018816792871803045, 0.0018849803600460291, 0.0018551906105130911, 0.0017866381676867604, 0.0018022204749286175, 0.0017993045039474964, 0.001817729789763689, 0.0017980940174311399, 0.0018425219459459186, 0.0018399725668132305, 0.001827348954975605, 0.0018271805020049214, 0.001832386595197022, 0.0017977821407839656, 0.0018480358412489295, 0.0019088590051978827, 0.0018236517207697034, 0.0017724116332828999, 0.0017234982224181294, 0.001844976213760674, } };
 const TfLiteAffineQuantization quant5 = { (TfLiteFloatArray*)&quant5_scale, (TfLiteIntArray*)&g0::quant4_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data6[96] = { 1996, -2, 3752, 5829, 6477, -3847, 5144, -1598, -2584, -893, 5131, -3043, 5206, 7391, 2311, 2591, -793, -449, -2086, 7009, 2502, -993, 3631, -545, -1335, 4462, 1762, 1973, 5646, 2479, 6150, 1921, 1701, 7838, 7111, 4240, -520, 4648, 3907, -4859, -314, 1936, 18, 1979, -1592, 482, -1806, 1290, -9635, 2085, 1368, -4009, 8474, -946, 2663, 1753, 1107, 3164, -1175, -2402, 395, 2237, 607, 4930, 6907, 4214, 2983, 6219, 4272, -829, 3572, 7053, 3829, -1975, 6581, 8466, 801, -3836, 1050, 2017, 10935, 2906, -669, -3674, 1396, 865, 1607, -3546, 5969, -883, 4704, 1753, -27, -3759, -335, 1939, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data6[96] = { 1996, -2, 3752, 5829, 6477, -3847, 5144, -1598, -2584, -893, 5131, -3043, 5206, 7391, 2311, 2591, -793, -449, -2086, 7009, 2502, -993, 3631, -545, -1335, 4462, 1762, 1973, 5646, 2479, 6150, 1921, 1701, 7838, 7111, 4240, -520, 4648, 3907, -4859, -314, 1936, 18, 1979, -1592, 482, -1806, 1290, -9635, 2085, 1368, -4009, 8474, -946, 2663, 1753, 1107, 3164, -1175, -2402, 395, 2237, 607, 4930, 6907, 4214, 2983, 6219, 4272, -829, 3572, 7053, 3829, -1975, 6581, 8466, 801, -3836, 1050, 2017, 10935, 2906, -669, -3674, 1396, 865, 1607, -3546, 5969, -883, 4704, 1753, -27, -3759, -335, 1939, };
 const TfArray<1, int> tensor_dimension6 = { 1, { 96 } };
 const TfArray<96, float> quant6_scale = { 96, { 8.8276901806239039e-05, 0.00020047390717081726, 0.00015453413652721792, 0.0001267222105525434, 9.8676944617182016e-05, 0.00010783985635498539, 0.00011460616224212572, 0.00016350724035874009, 0.00014814722817391157, 0.00015703591634519398, 0.00012593578139785677, 0.00014598020061384887, 0.00011073695350205526, 8.2289756392128766e-05, 0.00012231362052261829, 0.00014999930863268673, 0.00017846529954113066, 0.00015144108328968287, 0.00014507384912576526, 9.0892361185979098e-05, 0.00017851109441835433, 0.00012573176354635507, 0.00010380296589573845, 0.00016188477457035333, 0.00018135606660507619, 0.00014165676839184016, 0.00015098969743121415, 0.00018664401432033628, 0.00012266231351532042, 0.00017616807599551976, 8.3732244092971087e-05, 0.00012258495553396642, 0.00016319236601702869, 8.2129248767159879e-05, 9.3373819254338741e-05, 0.00011857124627567828, 0.00012604855874087662, 0.00010327017662348226, 0.0001041197101585567, 0.00010161935642827302, 0.00015937117859721184, 0.0001216747477883473, 0.0001863900397438556, 0.00013214891077950597, 0.00013272442447487265, 0.00012124946806579828, 0.00015158747555688024, 0.0001242334401467815, 7.2688388172537088e-05, 0.00011860769154736772, 0.00017468452278990299, 0.00011782343062805012, 8.8329419668298215e-05, 0.0001596046204213053, 0.00012553705892059952, 0.00013081912766210735, 0.00014992506476119161, 0.00012673468154389411, 0.00015333012561313808, 0.00011754976731026545, 0.0001900996285257861, 0.0001256779651157558, 0.00016721517022233456, 0.00013355340342968702, 9.7316020401194692e-05, 0.00011582846491364762, 0.00013097219925839454, 0.0001131259705289267, 0.00015203692601062357, 0.00016082999354694039, 0.00013072666479274631, 0.00010116014891536906, 0.000129226318676956, 0.00011329188419040293, 0.00011174529936397448, 9.6266368927899748e-05, 0.00012336009240243584, 0.00015324914420489222, 0.0001199506368720904, 0.00010907807154580951, 8.0289901234209538e-05, 0.00010231623309664428, 0.0001542307436466217, 0.00011935320071643218, 0.00013740094436798245, 0.00012489131768234074, 0.00017499866953585297, 0.00011627258936641738, 0.00010929913696600124, 0.00011963064025621861, 0.00013083734665997326, 0.00013946263061370701, 0.00011737300519598648, 0.00011768932017730549, 0.00018942855240311474, 0.00014031933096703142, } };
 const TfArray<96, int> quant6_zero = { 96, { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } };
 const TfLiteAffineQuantization quant6 = { (TfLiteFloatArray*)&quant6_scale, (TfLiteIntArray*)&quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data7[96*1*1*16] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data7[96*1*1*16] = { 
   /* [0][0][][] */ -9,97,-82,35,49,-30,96,65,-59,2,34,-90,82,127,-58,21, 
   /* [1][0][][] */ -23,-4,-64,-21,-6,45,23,-127,35,-45,-26,-57,-10,-46,-50,4, 
   /* [2][0][][] */ -28,-30,38,73,20,40,-105,127,-28,5,78,-55,-21,-69,-49,71, 
@@ -326,12 +361,12 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data7[96*1*1*16] =
 const TfArray<4, int> tensor_dimension7 = { 4, { 96,1,1,16 } };
 const TfArray<96, float> quant7_scale = { 96, { 0.0012091408716514707, 0.0027459186967462301, 0.0021166752558201551, 0.0017357314936816692, 0.0013515916652977467, 0.0014770972775295377, 0.0015697763301432133, 0.0022395811975002289, 0.0020291928667575121, 0.0021509425714612007, 0.0017249597003683448, 0.0019995109178125858, 0.0015167793026193976, 0.0011271340772509575, 0.0016753465170040727, 0.0020545611623674631, 0.0024444637820124626, 0.002074309391900897, 0.0019870963878929615, 0.0012449651258066297, 0.0024450910277664661, 0.0017221651505678892, 0.0014218034921213984, 0.0022173579782247543, 0.0024840589612722397, 0.0019402923062443733, 0.0020681265741586685, 0.0025564886163920164, 0.0016801225719973445, 0.0024129983503371477, 0.0011468920856714249, 0.0016790629597380757, 0.0022352682426571846, 0.0011249355738982558, 0.0012789539759978652, 0.0016240866389125586, 0.0017265044152736664, 0.0014145057648420334, 0.0014261419419199228, 0.001391894300468266, 0.0021829288452863693, 0.0016665956936776638, 0.0025530098937451839, 0.0018100617453455925, 0.0018179446924477816, 0.0016607706202194095, 0.0020763145294040442, 0.0017016424098983407, 0.00099562283139675856, 0.0016245858278125525, 0.0023926778230816126, 0.0016138437204062939, 0.0012098602019250393, 0.0021861263085156679, 0.0017194983083754778, 0.0017918476369231939, 0.002053544158115983, 0.0017359023913741112, 0.0021001838613301516, 0.0016100952634587884, 0.0026038207579404116, 0.0017214283579960465, 0.0022903692442923784, 0.0018292992608621716, 0.0013329508947208524, 0.0015865183668211102, 0.0017939441604539752, 0.0015495019033551216, 0.0020824705716222525, 0.0022029106039553881, 0.0017905810382217169, 0.0013856044970452785, 0.0017700307071208954, 0.0015517744468525052, 0.0015305906999856234, 0.0013185737188905478, 0.0016896800370886922, 0.0020990746561437845, 0.0016429803799837828, 0.0014940573601052165, 0.0010997417848557234, 0.0014014395419508219, 0.0021125196944922209, 0.001634797197766602, 0.0018819996621459723, 0.0017106535378843546, 0.0023969807662069798, 0.0015926016494631767, 0.0014970853226259351, 0.0016385973431169987, 0.0017920971149578691, 0.0019102388760074973, 0.0016076741740107536, 0.0016120068030431867, 0.0025946288369596004, 0.0019219731912016869, } };
 const TfLiteAffineQuantization quant7 = { (TfLiteFloatArray*)&quant7_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data8[16] = { 10532, 14975, -3587, 2202, -1235, 7651, 420, 3313, 15938, -5396, -10011, 9327, -16486, 10686, 4301, 6687, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data8[16] = { 10532, 14975, -3587, 2202, -1235, 7651, 420, 3313, 15938, -5396, -10011, 9327, -16486, 10686, 4301, 6687, };
 const TfArray<1, int> tensor_dimension8 = { 1, { 16 } };
 const TfArray<16, float> quant8_scale = { 16, { 4.8607045755488798e-05, 6.971494440222159e-05, 5.5287408031290397e-05, 6.4751977333799005e-05, 6.2837083532940596e-05, 7.2978145908564329e-05, 4.8608129873173311e-05, 5.3604780987370759e-05, 0.00010332258534617722, 7.5716263381764293e-05, 5.3607207519235089e-05, 5.2117738960077986e-05, 6.7776170908473432e-05, 5.969392805127427e-05, 8.5770836449228227e-05, 5.6772154493955895e-05, } };
 const TfArray<16, int> quant8_zero = { 16, { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } };
 const TfLiteAffineQuantization quant8 = { (TfLiteFloatArray*)&quant8_scale, (TfLiteIntArray*)&quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data9[16*1*1*96] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data9[16*1*1*96] = { 
   /* [0][0][][] */ -116,37,68,-24,-79,-5,-66,-4,-57,10,-18,-35,31,39,46,-39,17,4,102,8,4,-55,127,68,47,24,9,35,-67,-118,-95,6,-50,-45,25,15,9,21,-5,29,-13,1,-91,1,-66,-22,0,96,-17,19,-46,-15,-5,6,28,-51,-107,7,-17,85,54,27,2,4,-29,-60,-43,21,-54,-73,7,-14,12,0,-74,-51,-44,14,-37,11,-63,77,82,-79,15,53,14,58,29,-24,-9,-22,-37,-36,-61,17, 
   /* [1][0][][] */ 43,20,33,-57,-70,-21,-16,8,-13,30,58,-58,9,-15,-66,-33,-5,3,-66,27,-14,-84,15,56,-5,-65,-4,-46,67,-107,119,-78,52,20,-20,58,41,77,-18,-45,37,13,-6,-17,3,58,-127,-46,-52,-50,-11,-21,35,-46,-41,52,16,-1,-26,22,33,49,-4,-98,-17,-11,-68,-1,5,-20,-91,-5,-39,-27,11,-82,2,19,28,-73,-20,-23,-86,-36,40,-34,-28,13,-73,-16,-55,48,24,58,-61,59, 
   /* [2][0][][] */ 79,-43,14,30,24,-74,69,8,-15,-17,-15,-6,-73,-23,11,-41,-94,-46,-45,41,7,-53,-46,24,-3,-74,6,-27,-33,43,-64,122,-48,127,-27,20,-18,-21,-11,-11,-102,85,74,22,-59,12,-26,-19,32,2,-39,-60,59,-24,-19,63,35,-4,41,-11,4,52,-36,4,72,14,1,-7,26,55,-43,-8,42,51,73,46,38,-68,70,48,82,-21,-42,28,-64,28,19,78,12,15,-23,32,-46,55,-11,30, 
@@ -352,10 +387,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data9[16*1*1*96] =
 const TfArray<4, int> tensor_dimension9 = { 4, { 16,1,1,96 } };
 const TfArray<16, float> quant9_scale = { 16, { 0.0020657994318753481, 0.0029628851916640997, 0.0023497147485613823, 0.0027519590221345425, 0.0026705760974436998, 0.0031015712302178144, 0.0020658455323427916, 0.0022782031446695328, 0.0043912096880376339, 0.0032179411500692368, 0.0022783062886446714, 0.0022150038275867701, 0.0028804871253669262, 0.0025369918439537287, 0.0036452603526413441, 0.002412816509604454, } };
 const TfLiteAffineQuantization quant9 = { (TfLiteFloatArray*)&quant9_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data10[96] = { -331, -1346, -3651, -5392, -712, 3764, 755, -1239, -1172, -1927, 10820, -2012, 360, 11872, 8434, -5226, 16737, 2482, -5786, -318, 47, -1583, 1187, -2560, 578, -4322, -1321, -5052, -61, -10109, 401, 728, 13203, 720, -1546, -343, -605, -1951, -739, 7745, -447, -81, 1572, -7727, 13627, 14318, 412, 17662, -1584, 16232, 16475, -4622, -854, -446, 171, 13017, -1264, 260, 18479, 8514, 9506, 13004, 8139, -8716, 1290, 2143, -2798, 3376, -3611, -2520, 2365, 2565, 13811, -576, -1357, 13975, -430, -703, 10509, -1629, 78, 23816, -496, 2823, 23787, 1475, -5248, -3648, 1203, -6289, 13889, 239, 75, -441, -6812, -3989, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data10[96] = { -331, -1346, -3651, -5392, -712, 3764, 755, -1239, -1172, -1927, 10820, -2012, 360, 11872, 8434, -5226, 16737, 2482, -5786, -318, 47, -1583, 1187, -2560, 578, -4322, -1321, -5052, -61, -10109, 401, 728, 13203, 720, -1546, -343, -605, -1951, -739, 7745, -447, -81, 1572, -7727, 13627, 14318, 412, 17662, -1584, 16232, 16475, -4622, -854, -446, 171, 13017, -1264, 260, 18479, 8514, 9506, 13004, 8139, -8716, 1290, 2143, -2798, 3376, -3611, -2520, 2365, 2565, 13811, -576, -1357, 13975, -430, -703, 10509, -1629, 78, 23816, -496, 2823, 23787, 1475, -5248, -3648, 1203, -6289, 13889, 239, 75, -441, -6812, -3989, };
 const TfArray<96, float> quant10_scale = { 96, { 0.00020265407511033118, 0.00015287799760699272, 0.00012711544695775956, 0.00013376367860473692, 0.00021287922572810203, 0.00025045411894097924, 0.00024090416263788939, 0.00018891382205765694, 0.00019358137797098607, 0.00013143493561074138, 0.00010148997534997761, 0.00033093098318204284, 0.00019903233624063432, 0.00010597768414299935, 0.00014074145292397588, 0.00013396867143455893, 0.00010250719788018614, 0.00022366746270563453, 0.00013957603368908167, 0.00010500067583052441, 0.00014989345800131559, 0.00025546384858898818, 0.00017510006728116423, 0.00018737096979748458, 0.00052984029753133655, 0.0001804291969165206, 0.00021561529138125479, 0.00013132940512150526, 0.00017825757095124573, 8.8390697783324867e-05, 0.00025497208116576076, 0.00020303271594457328, 0.00014055208885110915, 0.00016582899843342602, 0.00022958718182053417, 0.00032313185511156917, 0.00016339680587407202, 0.00026790730771608651, 0.00027983472682535648, 9.2088281235191971e-05, 0.00017463602125644684, 0.00021566687792073935, 0.00020662839233409613, 9.0169152827002108e-05, 9.4724920927546918e-05, 9.8588447144720703e-05, 0.00017669863882474601, 9.2801325081381947e-05, 0.00016432066331617534, 7.4470612162258476e-05, 0.00010124847176484764, 0.00011329498374834657, 0.00012627261457964778, 0.00013408370432443917, 0.00017909218149725348, 0.00014109609765000641, 0.00016212541959248483, 0.0001751227246131748, 0.00011520063708303496, 0.0001075766485882923, 0.00014463138359133154, 0.0001810270914575085, 0.00013623795530293137, 0.00011286177323199809, 0.00013177283108234406, 0.00020822753140237182, 0.00023308326490223408, 0.00015885310131125152, 0.00017796215252019465, 0.00018181282212026417, 0.00022329938656184822, 0.00012291723396629095, 9.200199565384537e-05, 0.00019042726489715278, 0.00025214924244210124, 0.00010552175081102178, 0.00012855528621003032, 0.0001814044953789562, 0.0001420024927938357, 0.00018932354578282684, 0.00021618697792291641, 7.8508572187274694e-05, 0.00018438065308146179, 0.00015701162919867784, 6.2540959334000945e-05, 0.000161231160745956, 0.00012132207484683022, 0.00017362933431286365, 0.00016874859284143895, 0.00017800560453906655, 9.5539799076505005e-05, 0.00034611407318152487, 0.00018878746777772903, 0.00025085729430429637, 0.00011029654706362635, 0.00025411299429833889, } };
 const TfLiteAffineQuantization quant10 = { (TfLiteFloatArray*)&quant10_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data11[1*3*3*96] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data11[1*3*3*96] = { 
   /* [0][0][][] */ 29,127,5,15,-31,-2,38,50,69,-78,-82,33,-20,-1,35,-36,-75,13,22,29,34,69,65,96,12,-11,-50,-1,-17,19,17,-24,-51,5,-28,109,2,56,-2,5,29,-39,-2,38,-86,-52,8,-25,-16,-93,-32,-4,17,59,-20,-10,-74,-70,-52,-127,-127,2,-84,6,-35,36,43,-19,-25,40,34,-7,-22,11,42,-7,2,-30,-68,28,8,-98,51,-39,-78,-51,-17,20,-123,9,-66,36,64,-5,70,3, -36,-28,-11,76,-6,82,-32,2,73,26,-127,66,-37,-64,-74,127,-96,55,49,84,127,19,105,127,23,10,24,47,-2,127,-17,-127,84,70,9,54,78,116,-31,-127,127,-13,91,127,-45,-83,127,-76,-6,-127,-106,-37,6,127,-28,-127,8,31,-118,-80,-49,-127,-38,83,-41,76,104,-34,0,127,127,0,-73,31,-32,-104,24,-45,-28,127,-2,-86,127,-78,-115,-48,110,62,104,91,-83,0,127,-27,127,38, 21,-101,-2,4,-20,-17,-12,52,33,70,-61,18,-15,55,13,-63,-31,10,0,20,40,52,49,93,13,-30,27,43,4,23,-16,-62,-53,-84,-29,74,3,0,11,20,-5,29,-20,49,-33,-23,-3,3,25,-68,30,12,-1,-11,12,-8,54,-85,-19,-68,-96,23,-69,-2,43,7,-33,-12,-21,-12,5,1,-11,-33,-4,13,11,-12,-66,5,7,-119,29,-14,-8,-39,0,-16,-91,-7,-12,29,18,36,14,-10, 
   /* [0][1][][] */ 94,2,72,111,7,-52,127,39,-25,-127,-98,127,-6,-126,-59,27,-77,-48,77,30,-115,6,-127,-64,-12,46,-127,127,-80,85,127,66,23,58,12,127,-127,79,-24,-66,56,-127,27,76,-127,-72,0,-125,-107,-108,-113,10,127,-55,78,-19,-127,-4,-68,-5,-80,-54,-37,47,-106,-23,98,-95,-49,36,-44,-127,-127,64,127,-100,93,67,-95,-39,127,-127,-32,106,-35,-8,6,91,-13,25,-68,28,-6,-77,98,-14, -127,9,-60,127,-87,-127,-126,-127,80,2,-43,37,-99,-127,-48,108,-127,-127,127,127,29,-127,-104,93,-127,127,19,68,-80,-24,-105,68,-127,73,127,-26,26,127,127,-106,-43,30,22,41,-48,-127,-84,-127,-2,-113,-127,127,40,85,52,-67,27,21,87,-23,-54,-33,-127,127,-16,-127,127,127,19,60,-102,-67,-34,60,-99,-127,127,127,71,-42,-88,23,-99,63,-95,-89,127,127,127,127,-127,-127,-91,-53,99,127, 52,-1,96,58,6,-27,6,32,-46,123,-59,75,4,-11,-127,58,6,-32,15,5,-119,6,-80,-63,-3,23,127,-11,127,100,8,-111,-37,-127,-13,115,-121,2,-36,-47,-10,100,20,99,-15,-21,-13,-78,127,-91,-71,7,61,-82,-127,18,103,-9,-127,64,-32,-38,-1,43,127,-47,-14,-9,-56,0,-44,-50,-108,-127,-1,-59,1,-22,-127,-36,-75,-124,-24,127,-127,18,3,1,-40,-16,-13,38,-18,127,25,-18, 
   /* [0][2][][] */ 31,-114,44,-17,13,12,25,47,-34,-44,8,-42,10,4,7,31,-22,15,-5,39,-11,39,2,-36,22,36,-2,-6,-20,18,0,18,-18,-21,-28,-1,43,-4,-1,-20,2,17,-20,-39,-20,-17,-14,0,-9,20,-17,30,-17,-10,-36,-17,-5,0,-5,26,-38,-7,44,-14,-36,40,-36,-26,29,11,8,75,-12,17,14,3,-43,-25,-16,3,5,-36,-20,-49,-101,36,-36,-9,-93,30,0,26,-19,4,16,-15, -47,24,127,2,127,61,-34,7,-127,13,-73,-51,127,-21,-51,16,9,45,-9,-50,10,9,58,-4,68,-44,-3,28,-8,109,-13,14,-82,21,12,-38,76,37,20,-95,-19,4,-127,3,-16,2,-37,-47,0,-69,-69,100,111,-71,-36,-80,-11,127,-32,6,67,-103,83,58,-31,19,-30,11,127,-13,2,92,-64,24,-16,-72,-14,-65,-34,-35,-15,-95,-35,-82,-104,127,36,5,98,37,33,25,-28,-8,4,-4, 5,85,21,-33,6,-8,-21,40,2,64,20,-7,5,10,8,30,-29,6,-11,34,-23,30,-7,-28,11,32,13,25,4,20,-23,-69,-47,-26,-19,-13,33,-26,-1,-7,-3,-5,0,-3,-26,-4,-17,11,22,26,-13,16,-13,-12,8,-2,5,6,-4,55,-31,8,30,-17,29,10,-54,14,21,5,1,74,30,-13,-2,1,-17,-7,-11,4,-10,-78,-17,-8,-77,27,-27,-20,-84,27,8,16,-24,13,-2,-19, 
@@ -363,10 +398,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data11[1*3*3*96] =
 const TfArray<4, int> tensor_dimension11 = { 4, { 1,3,3,96 } };
 const TfArray<96, float> quant11_scale = { 96, { 0.010499043390154839, 0.0079202586784958839, 0.0065855602733790874, 0.0069299894385039806, 0.01102878525853157, 0.012975454330444336, 0.012480692937970161, 0.0097871925681829453, 0.01002900768071413, 0.0068093426525592804, 0.005257963202893734, 0.017144776880741119, 0.010311409831047058, 0.0054904608987271786, 0.0072914925403892994, 0.0069406097754836082, 0.0053106630221009254, 0.011587698943912983, 0.0072311148978769779, 0.0054398444481194019, 0.0077656367793679237, 0.013234996236860752, 0.0090715335682034492, 0.0097072608768939972, 0.027449812740087509, 0.0093476232141256332, 0.011170534417033195, 0.0068038753233850002, 0.0092351166531443596, 0.0045793196186423302, 0.013209519907832146, 0.010518659837543964, 0.0072816819883882999, 0.0085912207141518593, 0.011894386261701584, 0.016740720719099045, 0.0084652146324515343, 0.013879663310945034, 0.014497596770524979, 0.0047708828933537006, 0.0090474924072623253, 0.011173207312822342, 0.010704943910241127, 0.0046714572235941887, 0.0049074813723564148, 0.0051076416857540607, 0.0091543514281511307, 0.0048078242689371109, 0.0085130771622061729, 0.0038581518456339836, 0.0052454513497650623, 0.0058695534244179726, 0.0065418952144682407, 0.0069465693086385727, 0.009278356097638607, 0.0073098656721413136, 0.0083993468433618546, 0.0090727070346474648, 0.0059682810679078102, 0.0055732997134327888, 0.0074930209666490555, 0.0093785990029573441, 0.0070581766776740551, 0.0058471099473536015, 0.0068268482573330402, 0.010787791572511196, 0.012075509876012802, 0.0082298154011368752, 0.0092198112979531288, 0.009419306181371212, 0.011568630114197731, 0.0063680601306259632, 0.0047664125449955463, 0.0098656006157398224, 0.013063274323940277, 0.0054668402299284935, 0.0066601545549929142, 0.0093981511890888214, 0.0073568238876760006, 0.0098084192723035812, 0.011200152337551117, 0.0040673492476344109, 0.0095523390918970108, 0.0081344125792384148, 0.0032401038333773613, 0.008353017270565033, 0.0062854187563061714, 0.0089953383430838585, 0.0087424777448177338, 0.0092220623046159744, 0.0049496982246637344, 0.0179313775151968, 0.0097806463018059731, 0.012996342033147812, 0.0057142116129398346, 0.013165012001991272, } };
 const TfLiteAffineQuantization quant11 = { (TfLiteFloatArray*)&quant11_scale, (TfLiteIntArray*)&g0::quant6_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data12[96] = { 9478, 5253, 1688, -1869, 5967, 16533, 10353, 2137, -574, 13993, 1217, -5984, 5184, 5114, 474, -924, 4095, 10233, -658, -72, 6150, 15495, 13147, -2605, -4661, -1379, 14980, 78, 2109, 1724, 12366, -2606, 13970, 3733, 4891, -6044, 1382, -6366, 318, 2774, 4121, 1959, 2650, -424, 1342, 3150, 6518, 6006, 5112, 3979, 9508, 4530, -3744, 2167, 1590, 3104, 2728, 4377, 10865, 1865, -1466, 9066, 6802, 5537, 5398, 9754, -7456, 3422, 8196, -778, 8885, 2543, 5163, 6113, 5169, 3990, -421, 3020, 3558, 4227, 4070, 5510, 13234, 1203, 3803, 5890, 1135, -1372, 19922, -734, 1240, -2135, 16069, 4147, -9, -1389, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data12[96] = { 9478, 5253, 1688, -1869, 5967, 16533, 10353, 2137, -574, 13993, 1217, -5984, 5184, 5114, 474, -924, 4095, 10233, -658, -72, 6150, 15495, 13147, -2605, -4661, -1379, 14980, 78, 2109, 1724, 12366, -2606, 13970, 3733, 4891, -6044, 1382, -6366, 318, 2774, 4121, 1959, 2650, -424, 1342, 3150, 6518, 6006, 5112, 3979, 9508, 4530, -3744, 2167, 1590, 3104, 2728, 4377, 10865, 1865, -1466, 9066, 6802, 5537, 5398, 9754, -7456, 3422, 8196, -778, 8885, 2543, 5163, 6113, 5169, 3990, -421, 3020, 3558, 4227, 4070, 5510, 13234, 1203, 3803, 5890, 1135, -1372, 19922, -734, 1240, -2135, 16069, 4147, -9, -1389, };
 const TfArray<96, float> quant12_scale = { 96, { 7.837184239178896e-05, 6.8996036134194583e-05, 9.4383947725873441e-05, 0.00011170079960720614, 0.00011557736434042454, 4.9436701374361292e-05, 7.8146207670215517e-05, 0.00013147333811502904, 0.00010269967606291175, 5.6400062021566555e-05, 0.00015103393525350839, 7.8765348007436842e-05, 0.00010016786109190434, 9.4874245405662805e-05, 0.00013923797814641148, 0.00010226095764664933, 0.00014491048932541162, 7.1748057962395251e-05, 8.0121804785449058e-05, 0.00011262192856520414, 0.00010063541412819177, 5.6995275372173637e-05, 6.5221676777582616e-05, 0.00010634975478751585, 0.00011904061830136925, 0.0001038964037434198, 5.9332287491997704e-05, 7.6778494985774159e-05, 0.00011955959780607373, 0.00011026168067473918, 6.8995846959296614e-05, 0.00010791164822876453, 5.7744207879295573e-05, 0.00012706933193840086, 0.00013971531006973237, 9.8271368187852204e-05, 0.00010389003728050739, 9.59029421210289e-05, 0.00011037604417651892, 0.00010704553278628737, 0.00011187566997250542, 0.00012258173956070095, 0.0001351435057586059, 0.00014509721950162202, 0.00017957603267859668, 0.00012383752618916333, 8.9220047811977565e-05, 0.00010736497642938048, 0.00011006960994563997, 0.00012415813398547471, 7.7134449384175241e-05, 9.4381568487733603e-05, 9.9077944469172508e-05, 0.0001610150357009843, 0.00015255113248713315, 0.00013630047033075243, 0.00011624648323049769, 9.0651112259365618e-05, 7.41539042792283e-05, 0.00012120028986828402, 0.00014546350575983524, 8.158695709425956e-05, 8.6755419033579528e-05, 0.00010443798237247393, 0.00010394106357125565, 7.8454570029862225e-05, 8.0977166362572461e-05, 0.00011966940655838698, 7.6250747952144593e-05, 0.00016423276974819601, 7.8486555139534175e-05, 8.5489213233813643e-05, 8.8240456534549594e-05, 6.996635056566447e-05, 0.00010047492833109573, 7.3562674515414983e-05, 0.00014661214663647115, 0.00011338324111420661, 0.0001011359563563019, 0.00011929695756407455, 0.00010673880024114624, 7.8873643360566348e-05, 5.9211906773271039e-05, 9.2147980467416346e-05, 9.5959992904681712e-05, 0.00011315636947983876, 0.00013148352445568889, 0.00017430885054636747, 4.7508361603831872e-05, 0.0001103389950003475, 0.00014125790039543062, 0.00011277543671894819, 5.4043241107137874e-05, 9.667547419667244e-05, 0.00016563561803195626, 9.6171250334009528e-05, } };
 const TfLiteAffineQuantization quant12 = { (TfLiteFloatArray*)&quant12_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data13[96*1*1*16] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data13[96*1*1*16] = { 
   /* [0][0][][] */ -54,49,-10,-29,-23,-60,-69,-34,60,-57,41,-57,79,-110,13,-127, 
   /* [1][0][][] */ -98,74,-116,-108,-88,33,-17,52,-40,0,97,-48,53,127,22,52, 
   /* [2][0][][] */ -48,-12,-84,14,-7,-49,29,-36,-101,127,85,7,45,68,-42,124, 
@@ -466,10 +501,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data13[96*1*1*16]
 };
 const TfArray<96, float> quant13_scale = { 96, { 0.0015419732080772519, 0.0013575033517554402, 0.0018570128595456481, 0.0021977236028760672, 0.00227399542927742, 0.00097267166711390018, 0.0015375339426100254, 0.0025867500808089972, 0.0020206256303936243, 0.0011096764355897903, 0.0029716065619140863, 0.001549715525470674, 0.0019708119798451662, 0.0018666596151888371, 0.0027395202778279781, 0.0020119938999414444, 0.0028511274140328169, 0.0014116497477516532, 0.0015764039708301425, 0.0022158469073474407, 0.0019800111185759306, 0.0011213873513042927, 0.0012832426000386477, 0.0020924413111060858, 0.0023421351797878742, 0.0020441713277250528, 0.0011673682602122426, 0.0015106239588931203, 0.0023523462004959583, 0.0021694088354706764, 0.0013574996264651418, 0.0021231716964393854, 0.001136122620664537, 0.0025001009926199913, 0.0027489117346704006, 0.0019334983080625534, 0.0020440460648387671, 0.0018868993502110243, 0.0021716589108109474, 0.0021061308216303587, 0.0022011641412973404, 0.0024118071887642145, 0.0026589611079543829, 0.0028548012487590313, 0.0035331749822944403, 0.0024365147110074759, 0.0017554126679897308, 0.0021124158520251513, 0.0021656297612935305, 0.0024428227916359901, 0.0015176275046542287, 0.0018569661770015955, 0.0019493678119033575, 0.0031679857056587934, 0.003001457778736949, 0.0026817244943231344, 0.0022871603723615408, 0.0017835689941421151, 0.0014589849160984159, 0.0023846270050853491, 0.0028620080556720495, 0.0016052309656515718, 0.0017069209134206176, 0.0020548270549625158, 0.0020450500305742025, 0.0015436009271070361, 0.0015932332025840878, 0.0023545066360384226, 0.0015002405270934105, 0.0032312949188053608, 0.0015442302683368325, 0.0016820082673802972, 0.0017361391801387072, 0.0013765944167971611, 0.0019768534693866968, 0.0014473524643108249, 0.0028846075292676687, 0.0022308258339762688, 0.001989859389141202, 0.0023471787571907043, 0.0021000958513468504, 0.0015518462751060724, 0.0011649997904896736, 0.0018130200915038586, 0.0018880218267440796, 0.0022263620048761368, 0.0025869505479931831, 0.0034295427612960339, 0.00093473138986155391, 0.0021709299180656672, 0.0027792623732239008, 0.0022188671864569187, 0.0010633057681843638, 0.0019020988838747144, 0.0032588962931185961, 0.0018921783193945885, } };
 const TfLiteAffineQuantization quant13 = { (TfLiteFloatArray*)&quant13_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data14[16] = { -30868, -9151, 5873, -16757, 13263, -16028, 28021, -11038, 13479, -11487, 14535, 14128, -6337, -35326, -1836, 5568, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data14[16] = { -30868, -9151, 5873, -16757, 13263, -16028, 28021, -11038, 13479, -11487, 14535, 14128, -6337, -35326, -1836, 5568, };
 const TfArray<16, float> quant14_scale = { 16, { 7.9713201557751745e-05, 5.0992159231100231e-05, 5.7772573200054467e-05, 5.2662118832813576e-05, 7.5699608714785427e-05, 0.00012329006858635694, 4.846192678087391e-05, 5.2338651585159823e-05, 9.8327385785523802e-05, 9.1628717200364918e-05, 9.1372836322989315e-05, 7.3595299909356982e-05, 7.193099008873105e-05, 6.658616621280089e-05, 6.1732396716251969e-05, 6.2858722230885178e-05, } };
 const TfLiteAffineQuantization quant14 = { (TfLiteFloatArray*)&quant14_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data15[16*1*1*96] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data15[16*1*1*96] = { 
   /* [0][0][][] */ 20,29,7,22,-20,-74,-9,-2,-19,-68,16,-5,51,-61,55,26,-84,-25,40,10,74,24,-68,8,-10,67,127,65,12,75,53,-38,1,-2,4,-23,33,29,-13,-12,112,18,28,-23,-5,-6,8,-37,21,-40,89,-8,-71,-2,38,29,-7,-37,3,17,-10,39,-60,-16,16,-1,68,31,-2,-19,27,24,5,42,11,37,52,-35,51,19,-11,43,36,34,-51,9,-12,67,16,6,-90,-18,22,14,109,65, 
   /* [1][0][][] */ 27,46,-55,-12,-8,-48,103,-74,-61,-36,-61,-44,-4,-41,-6,-62,-29,-20,-29,-11,-22,-90,117,-30,-2,22,6,60,-49,14,-35,18,-38,29,18,10,-17,62,-59,83,36,16,3,-51,63,-63,-3,41,-92,-4,57,-106,-42,42,67,58,29,30,-70,16,-44,6,-10,-22,40,34,112,11,-49,-127,14,10,19,71,-18,41,-61,-37,113,-29,48,-17,61,-58,-23,-59,-24,14,-20,-47,29,-1,69,-55,-30,60, 
   /* [2][0][][] */ 3,-20,16,-14,66,39,-55,22,-58,39,10,-29,33,-13,16,34,29,-30,-127,-13,-12,-45,-14,17,-1,-18,-47,20,-39,-23,-22,68,-13,-40,0,12,-46,20,-25,-14,64,9,0,36,2,57,1,-10,-77,5,-22,13,-24,50,9,-60,37,17,42,31,-20,-15,-23,57,33,-6,-38,-5,-5,-6,-18,-39,25,45,22,63,-48,-5,-30,-34,29,33,48,-19,-15,-45,-8,-52,-11,-30,-10,63,0,-12,76,-43, 
@@ -489,20 +524,20 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data15[16*1*1*96]
 };
 const TfArray<16, float> quant15_scale = { 16, { 0.0038136793300509453, 0.00243959273211658, 0.0027639847248792648, 0.0025194878689944744, 0.0036216590087860823, 0.0058985059149563313, 0.0023185401223599911, 0.0025040123146027327, 0.0047042286023497581, 0.0043837474659085274, 0.0043715056963264942, 0.00352098373696208, 0.0034413589164614677, 0.0031856491696089506, 0.0029534327331930399, 0.0030073188245296478, } };
 const TfLiteAffineQuantization quant15 = { (TfLiteFloatArray*)&quant15_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data16[96] = { 10816, -1410, -6641, 7885, 1102, 571, -141, -1440, 2638, -4597, 305, -2446, 14484, -3955, -3045, -10778, 532, 603, -12640, 393, -2779, 265, -8936, -198, 31, 12051, -12129, -6861, -134, -3676, -107, -394, 21868, 271, -3129, -82, 738, 15661, 4721, 11774, 721, 7158, -46, 7103, 403, 674, 13017, 2866, -7187, -309, -4428, 837, -943, -3953, -11, 2531, 1581, 3772, 71, 1270, -498, 95, -1031, 9693, 12676, 1250, 13946, 11047, -1606, -224, 14130, -1542, -32, 1061, -5078, 442, 22656, 13548, 14095, 13871, 20754, -1885, 10453, 10905, -2241, -1233, 12224, -9393, 11943, 502, -11724, -2371, -415, -382, 26094, -1564, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data16[96] = { 10816, -1410, -6641, 7885, 1102, 571, -141, -1440, 2638, -4597, 305, -2446, 14484, -3955, -3045, -10778, 532, 603, -12640, 393, -2779, 265, -8936, -198, 31, 12051, -12129, -6861, -134, -3676, -107, -394, 21868, 271, -3129, -82, 738, 15661, 4721, 11774, 721, 7158, -46, 7103, 403, 674, 13017, 2866, -7187, -309, -4428, 837, -943, -3953, -11, 2531, 1581, 3772, 71, 1270, -498, 95, -1031, 9693, 12676, 1250, 13946, 11047, -1606, -224, 14130, -1542, -32, 1061, -5078, 442, 22656, 13548, 14095, 13871, 20754, -1885, 10453, 10905, -2241, -1233, 12224, -9393, 11943, 502, -11724, -2371, -415, -382, 26094, -1564, };
 const TfArray<96, float> quant16_scale = { 96, { 0.00010166910942643881, 0.00021481377189047635, 0.00014759600162506104, 0.00013920600758865476, 0.0001638195535633713, 0.00036379930679686368, 8.3357263065408915e-05, 0.00018285385158378631, 0.00029296043794602156, 0.0002129016793332994, 0.00021971651585772634, 0.00012569705722853541, 6.7023516749031842e-05, 0.00013362556637730449, 0.00017436902271583676, 0.00010666884190868586, 0.00019421869365032762, 0.00023628442431800067, 9.4530187197960913e-05, 0.0002374127070652321, 0.00019072707800660282, 0.00018646143143996596, 8.1421290815342218e-05, 0.00013422270421870053, 0.0019177523208782077, 0.00010982828825945035, 0.0001755257835611701, 0.00012543285265564919, 0.00020203867461532354, 0.00015629718836862594, 0.00013175503409001976, 0.00022864712809678167, 6.0842143284389749e-05, 0.00032058183569461107, 0.00010836646106326953, 0.000148249018820934, 0.00023470315500162542, 8.7089581938926131e-05, 0.00017224725161213428, 9.446548210689798e-05, 0.00043993518920615315, 0.00014693637785967439, 0.00017080552061088383, 0.00012317467189859599, 0.00011099523544544354, 0.00019362141028977931, 0.0001117193532991223, 0.00020653373212553561, 0.00015395750233437866, 0.00030382993281818926, 0.00020940371905453503, 0.00019608000002335757, 0.0001127406139858067, 0.00024779263185337186, 0.00020057120127603412, 0.00022064530639909208, 0.00014274672139436007, 0.00028043179190717638, 0.00027087837224826217, 0.00027758843498304486, 0.00019634135242085904, 0.00023193385277409106, 0.00011606233601924032, 9.8747361334972084e-05, 0.00020885095000267029, 0.00032584549626335502, 0.00011246526992181316, 0.00011746009840862826, 0.00020695202692877501, 0.00025109548005275428, 9.7786243713926524e-05, 0.00019143107056152076, 0.00036694778827950358, 0.00014544998703058809, 0.00012765570136252791, 0.00016845444042701274, 5.7505083532305434e-05, 0.00012580008478835225, 9.7095107776112854e-05, 0.00013207296433392912, 6.9736815930809826e-05, 0.00021500520233530551, 8.3371509390417486e-05, 0.00024175416911020875, 7.0882677391637117e-05, 0.00021503109019249678, 0.00010266550816595554, 0.00016790619702078402, 0.00010531553562032059, 0.00017779537301976234, 8.5716492321807891e-05, 0.00018443920998834074, 0.00024694486637599766, 0.00011895336501765996, 7.0027141191530973e-05, 0.00020213096286170185, } };
 const TfLiteAffineQuantization quant16 = { (TfLiteFloatArray*)&quant16_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data17[1*3*3*96] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data17[1*3*3*96] = { 
   /* [0][0][][] */ -48,-6,6,-39,86,-3,31,-12,-5,-5,-12,-30,-35,2,0,-12,-19,1,-6,-21,-7,25,23,43,-3,-26,-27,3,14,-2,29,3,-6,3,-6,-33,-5,-68,-39,1,-3,1,35,-27,-23,36,-61,-21,-24,11,-8,49,-56,7,33,-14,-4,-11,7,-14,-11,-18,-14,-47,-25,-28,-45,-30,-8,25,-6,1,37,0,-2,0,-8,18,127,-12,-127,10,-114,-19,-28,-18,31,11,-19,-17,11,-29,-5,35,-31,7, -27,39,49,-65,-44,2,127,-52,-1,-16,-36,5,-79,4,-81,90,-13,69,73,-34,-9,127,93,123,31,-9,40,70,127,32,127,-34,-127,-17,-72,-35,-27,-81,127,-40,-31,-127,-16,-39,64,-36,-34,-7,45,6,20,127,-84,43,-85,-8,-81,-7,-4,27,-13,-127,-127,-56,-53,-5,-7,-88,-4,14,-80,108,-127,-16,7,-31,-127,-72,-6,-80,-113,8,15,-58,123,74,-72,29,-127,0,41,-11,6,127,-49,-86, -42,3,-1,-12,55,-1,43,-22,-21,13,-11,-1,-11,-4,0,-20,-16,-4,-10,-30,-11,8,28,34,-4,-18,-3,-12,6,5,16,7,-29,2,-17,55,-6,-64,-35,8,-7,-13,17,-9,-14,-26,-42,-28,-14,1,-7,34,1,-2,4,-16,48,-18,9,-19,-11,-9,-46,0,-32,-40,127,-26,0,20,2,9,20,4,1,15,-7,42,-46,-7,-85,2,-121,-18,13,-29,12,-21,-30,-33,13,50,0,32,-19,11, 
   /* [0][1][][] */ -75,-3,34,-58,38,103,-37,-15,-5,-13,-26,-19,-127,19,24,84,-16,36,88,19,26,-20,127,-29,35,18,67,22,-16,-1,-5,-21,-104,-15,61,-16,-13,-127,-64,-127,-20,3,91,-32,-71,127,-102,-83,52,64,15,-45,-107,66,64,-26,23,-33,36,-8,12,-11,97,-83,-36,9,-28,-61,-6,-4,-127,15,80,127,12,-78,-104,-71,-58,-50,-89,-7,-25,-58,47,23,-106,58,-51,127,99,-81,127,8,-67,-6, 80,127,127,127,-127,-127,106,-60,127,127,-77,-68,-103,127,-24,127,127,-127,127,127,127,-80,77,-127,-127,-127,127,127,-119,127,-22,127,-74,127,127,-97,127,74,2,-7,127,-6,-127,-104,127,-30,127,127,127,-127,127,-118,115,127,-127,127,-127,127,-127,127,-99,113,116,-127,127,127,-12,127,-102,-127,-21,-127,18,107,127,66,-12,-127,87,-127,51,127,127,127,127,64,-127,127,-90,49,2,-21,-87,-19,-127,-33, -127,-26,30,-57,7,56,-50,0,-38,-11,-4,127,-111,15,27,71,-26,47,72,3,12,-25,76,-24,35,10,37,7,-12,-2,12,-19,-89,-30,76,127,-7,-94,-80,-81,-31,-29,27,-39,-61,-69,-96,-111,45,69,-3,-28,127,8,92,-48,88,-31,50,-37,3,-32,-127,-33,-71,-16,-49,-69,-15,5,-116,-1,36,-95,5,127,-88,-48,-61,5,-119,-13,-65,-80,7,27,-91,44,-27,-77,127,127,-44,-17,-80,-9, 
   /* [0][2][][] */ -11,-40,-24,-14,30,-1,-13,19,-11,4,32,-27,47,2,-5,-30,-2,-8,-49,-22,-17,-10,27,-24,4,-16,-5,5,-4,-12,-22,7,18,-2,-1,-27,-7,-37,-25,-13,-26,7,22,11,17,8,-63,0,-28,5,-16,-18,-11,-25,29,-15,1,-20,8,-14,-1,21,11,6,-31,-28,115,21,30,23,-12,0,-2,-10,-5,-30,-9,13,-33,-18,-31,3,-77,-20,-14,-5,48,-14,13,4,-7,-19,-13,-8,-25,-3, -20,-56,18,-79,-49,0,59,127,-54,57,127,-31,-74,14,127,99,-8,-33,68,-49,-28,-33,116,17,19,-24,30,8,-15,4,-86,-42,-64,-31,-78,-5,-93,-85,40,-48,-23,-96,-39,127,31,-26,-48,-4,30,-11,-6,-10,62,34,-47,-40,-53,-52,46,-48,127,30,112,-5,-86,-53,-20,-50,127,26,-52,14,30,-27,21,-26,-32,-49,1,32,-89,-24,-74,-72,38,-127,0,16,-28,-3,52,2,16,-109,-64,127, -28,4,-18,5,22,-9,3,12,-23,-6,14,37,50,-1,-3,-32,-6,11,-12,-27,-15,-5,5,-10,-2,-17,-16,-8,-4,-1,-32,2,-1,2,-3,-1,-10,-47,-34,-7,-34,6,-1,8,22,-6,-60,4,-24,-3,-10,-17,8,-31,28,-17,48,-14,13,-19,4,22,-13,15,-27,-30,-24,25,28,7,-24,-1,-45,-38,-7,-9,-32,5,96,-3,-32,1,-59,-7,-9,2,42,8,8,-4,-6,17,2,-14,-15,-8, 
 };
 const TfArray<96, float> quant17_scale = { 96, { 0.0059045525267720222, 0.012475560419261456, 0.0085718100890517235, 0.0080845514312386513, 0.00951401237398386, 0.02112806960940361, 0.0048410706222057343, 0.01061945129185915, 0.017014019191265106, 0.012364514172077179, 0.012760293669998646, 0.0073000038973987103, 0.0038924692198634148, 0.0077604609541594982, 0.010126684792339802, 0.0061949174851179123, 0.01127947773784399, 0.0137224942445755, 0.0054899509996175766, 0.013788020238280296, 0.011076698079705238, 0.010828965343534946, 0.0047286367043852806, 0.0077951406128704548, 0.11137570440769196, 0.0063784061931073666, 0.010193864814937115, 0.0072846598923206329, 0.011733632534742355, 0.0090771419927477837, 0.007651827298104763, 0.013278949074447155, 0.0035334785934537649, 0.018618164584040642, 0.0062935086898505688, 0.008609735406935215, 0.013630660250782967, 0.0050578294321894646, 0.010003460571169853, 0.0054861931130290031, 0.025549750775098801, 0.008533501997590065, 0.0099197300150990486, 0.0071535129100084305, 0.0064461780712008476, 0.011244789697229862, 0.0064882319420576096, 0.011994687840342522, 0.0089412620291113853, 0.017645278945565224, 0.012161365710198879, 0.011387575417757034, 0.006547542754560709, 0.014390846714377403, 0.011648407205939293, 0.012814234010875225, 0.0082901827991008759, 0.016286404803395271, 0.015731578692793846, 0.016121271997690201, 0.011402753181755543, 0.013469829224050045, 0.0067404559813439846, 0.0057348683476448059, 0.012129263021051884, 0.018923858180642128, 0.0065315519459545612, 0.0068216323852539062, 0.012018980458378792, 0.014582662843167782, 0.0056790504604578018, 0.011117583140730858, 0.021310921758413315, 0.0084471777081489563, 0.0074137537740170956, 0.0097831888124346733, 0.0033396750222891569, 0.0073059871792793274, 0.0056389118544757366, 0.0076702916994690895, 0.0040500471368432045, 0.012486678548157215, 0.0048418976366519928, 0.01404015626758337, 0.0041165943257510662, 0.012488181702792645, 0.0059624193236231804, 0.0097513487562537193, 0.0061163227073848248, 0.010325673967599869, 0.0049780854023993015, 0.010711522772908211, 0.014341611415147781, 0.0069083557464182377, 0.0040669082663953304, 0.011738992296159267, } };
 const TfLiteAffineQuantization quant17 = { (TfLiteFloatArray*)&quant17_scale, (TfLiteIntArray*)&g0::quant6_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data18[96] = { 1961, 10542, 327, 2059, 5420, 20950, 320, 3144, 18314, -1295, 24154, 5195, 2264, 595, 6169, 531, 2871, 5540, -516, 12339, 1575, 10165, -1513, 2508, -11442, 1821, 3547, 2122, 9116, 1196, 5036, 5439, 2016, 14281, 5782, 5619, 4761, 2890, 4647, 3344, 24920, 1902, 2648, 1902, 3915, 9884, 7692, 11462, 1297, -1051, 2340, 8002, 3225, -3836, 9559, 282, 3585, 17188, 1634, 2498, 2994, 12449, 5239, -349, 22357, 18594, 3065, 4848, 8318, 6331, 2955, 2027, -4900, 6319, 2965, 4723, 351, 16085, 5141, 8761, 3862, 1250, 6514, 16571, 51, 12595, 7643, 2498, -869, 3975, 1545, 17420, 4455, 3556, 5666, 6560, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data18[96] = { 1961, 10542, 327, 2059, 5420, 20950, 320, 3144, 18314, -1295, 24154, 5195, 2264, 595, 6169, 531, 2871, 5540, -516, 12339, 1575, 10165, -1513, 2508, -11442, 1821, 3547, 2122, 9116, 1196, 5036, 5439, 2016, 14281, 5782, 5619, 4761, 2890, 4647, 3344, 24920, 1902, 2648, 1902, 3915, 9884, 7692, 11462, 1297, -1051, 2340, 8002, 3225, -3836, 9559, 282, 3585, 17188, 1634, 2498, 2994, 12449, 5239, -349, 22357, 18594, 3065, 4848, 8318, 6331, 2955, 2027, -4900, 6319, 2965, 4723, 351, 16085, 5141, 8761, 3862, 1250, 6514, 16571, 51, 12595, 7643, 2498, -869, 3975, 1545, 17420, 4455, 3556, 5666, 6560, };
 const TfArray<96, float> quant18_scale = { 96, { 0.00016843917546793818, 7.3571492976043373e-05, 0.00023312865232583135, 0.00017718123854137957, 0.00012192174472147599, 4.4210653868503869e-05, 0.00017674361879471689, 0.00010262537398375571, 4.8751680878922343e-05, 0.00013181685062590986, 3.5965636925539002e-05, 9.5069073722697794e-05, 0.00013594173651654273, 0.00028636257047764957, 8.909686584956944e-05, 0.00010066637332784012, 0.00021056171681266278, 0.00011141081631649286, 0.00010803227633005008, 7.4146053520962596e-05, 0.0001660428533796221, 7.5931493483949453e-05, 0.00015550694661214948, 0.00011067622835980728, 6.5420936152804643e-05, 0.00011570654169190675, 0.0001394621649524197, 0.00016301845607813448, 9.6320560260210186e-05, 0.00020779775513801724, 0.00011643913603620604, 0.00010145151463802904, 0.00019933469593524933, 5.9294499806128442e-05, 9.3441391072701663e-05, 0.00010970020230161026, 0.00012681301450356841, 0.00014650929369963706, 0.00010397184087196365, 0.0001242968428414315, 3.8922476960578933e-05, 0.000136877570184879, 0.00013688436592929065, 9.8344906291458756e-05, 9.7199212177656591e-05, 8.4629755292553455e-05, 8.9727400336414576e-05, 6.8286601162981242e-05, 0.00021018282859586179, 0.00022128412092570215, 0.00017805336392484605, 8.9798319095280021e-05, 0.00014359780470840633, 0.00010430937254568562, 7.9039142292458564e-05, 0.00023519794922322035, 9.9993172625545412e-05, 5.2234016038710251e-05, 0.00011632501991698518, 0.00010720898717409, 0.00014134177763480693, 7.0257541665341705e-05, 0.00011598940909607336, 0.00016226203297264874, 4.3934061977779493e-05, 4.9792306526796892e-05, 0.00014403734530787915, 0.00012087653885828331, 9.202105866279453e-05, 8.2345322880428284e-05, 0.00016400740423705429, 0.00010730662324931473, 0.00011831671872641891, 0.00010432728595333174, 0.00012220835196785629, 0.00013404384662862867, 0.00017591079813428223, 5.2125731599517167e-05, 0.00011580190766835585, 9.7067102615255862e-05, 0.00011504725989652798, 0.00013791733363177627, 7.964748510858044e-05, 5.6266442697960883e-05, 8.667266956763342e-05, 5.8103229093831033e-05, 9.0638721303548664e-05, 0.00015883272862993181, 0.00014630331133957952, 0.00014250772073864937, 0.00013315188698470592, 4.8829449951881543e-05, 0.00011713692219927907, 0.00011172442464157939, 9.4804832770023495e-05, 9.8791577329393476e-05, } };
 const TfLiteAffineQuantization quant18 = { (TfLiteFloatArray*)&quant18_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data19[96*1*1*16] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data19[96*1*1*16] = { 
   /* [0][0][][] */ 50,5,0,53,-127,-28,98,55,68,95,-25,46,15,7,38,78, 
   /* [1][0][][] */ -20,24,-98,6,127,109,0,-5,-22,13,-57,33,-47,90,-58,-45, 
   /* [2][0][][] */ -35,57,79,-5,65,80,3,39,40,-3,35,-20,49,-127,-6,8, 
@@ -602,10 +637,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data19[96*1*1*16]
 };
 const TfArray<96, float> quant19_scale = { 96, { 0.0039256466552615166, 0.0017146585742011666, 0.0054333005100488663, 0.004129389300942421, 0.0028415103442966938, 0.0010303743183612823, 0.0041191899217665195, 0.0023917888756841421, 0.0011362076038494706, 0.0030721258372068405, 0.00083821575390174985, 0.0022156815975904465, 0.003168260445818305, 0.0066739711910486221, 0.0020764931105077267, 0.0023461324162781239, 0.0049073551781475544, 0.0025965424720197916, 0.0025178021751344204, 0.0017280493630096316, 0.0038697978015989065, 0.0017696607392281294, 0.0036242478527128696, 0.0025794222019612789, 0.0015247015981003642, 0.0026966587174683809, 0.0032503078691661358, 0.0037993111182004213, 0.002244848757982254, 0.0048429383896291256, 0.0027137326542288065, 0.0023644308093935251, 0.0046456982381641865, 0.001381918671540916, 0.0021777467336505651, 0.0025566748809069395, 0.0029555065557360649, 0.003414548235014081, 0.002423169557005167, 0.0028968644328415394, 0.00090712792007252574, 0.0031900710891932249, 0.0031902294140309095, 0.0022920281626284122, 0.0022653266787528992, 0.0019723826553672552, 0.0020911884494125843, 0.0015914887189865112, 0.0048985248431563377, 0.0051572518423199654, 0.0041497149504721165, 0.0020928413141518831, 0.0033466930035501719, 0.0024310362059623003, 0.0018420877167955041, 0.0054815276525914669, 0.0023304426576942205, 0.0012173668947070837, 0.0027110730297863483, 0.002498614601790905, 0.0032941140234470367, 0.0016374235274270177, 0.0027032513171434402, 0.0037816818803548813, 0.0010239280527457595, 0.0011604604078456759, 0.0033569368533790112, 0.002817150903865695, 0.0021446445025503635, 0.0019191416213288903, 0.0038223594892770052, 0.0025008900556713343, 0.0027574915438890457, 0.0024314536713063717, 0.0028481902554631233, 0.0031240282114595175, 0.0040997802279889584, 0.0012148432433605194, 0.0026988813187927008, 0.0022622477263212204, 0.0026812935248017311, 0.003214303869754076, 0.0018562657060101628, 0.0013113467721268535, 0.002019994892179966, 0.0013541548978537321, 0.0021124277263879776, 0.0037017585709691048, 0.0034097477328032255, 0.0033212876878678799, 0.0031032401602715254, 0.0011380200739949942, 0.0027299951761960983, 0.0026038514915853739, 0.0022095232270658016, 0.0023024382535368204, } };
 const TfLiteAffineQuantization quant19 = { (TfLiteFloatArray*)&quant19_scale, (TfLiteIntArray*)&g0::quant6_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data20[16] = { -5337, 11138, -21712, 722, 14594, -17609, -46529, -10206, -6540, 7606, -18710, -14971, 6929, -14140, -4215, -3382, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data20[16] = { -5337, 11138, -21712, 722, 14594, -17609, -46529, -10206, -6540, 7606, -18710, -14971, 6929, -14140, -4215, -3382, };
 const TfArray<16, float> quant20_scale = { 16, { 0.00013252675125841051, 0.0001308176142629236, 0.00013721955474466085, 0.00014721066690981388, 9.1170753876212984e-05, 0.00012068940850440413, 8.2693484728224576e-05, 0.00012429888010956347, 9.9876277090515941e-05, 8.1537131336517632e-05, 0.00015753839397802949, 0.00012331598554737866, 0.00011758824985008687, 6.8680077674798667e-05, 0.0001332748361164704, 0.00011930633627343923, } };
 const TfLiteAffineQuantization quant20 = { (TfLiteFloatArray*)&quant20_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data21[16*1*1*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data21[16*1*1*48] = { 
   /* [0][0][][] */ 29,39,22,-38,71,67,-43,57,-14,112,3,45,-33,37,-12,42,36,83,41,-66,-74,79,-4,54,61,43,38,54,-47,-53,-7,88,-24,11,-72,55,51,-127,-38,14,13,-32,66,-4,-9,-56,-64,-14, 
   /* [1][0][][] */ -50,1,-82,-45,13,93,-53,19,-14,-37,-41,37,61,-16,-29,-27,-25,-29,-2,16,-68,48,-102,-43,-49,-37,50,70,-27,-31,45,-39,15,-56,-33,52,14,-56,127,-34,-20,32,-44,-12,35,55,30,22, 
   /* [2][0][][] */ 1,0,60,-32,-21,-81,19,21,106,81,-70,11,109,-47,127,82,-73,-26,-35,35,87,-84,-37,-103,9,-34,33,-71,44,49,-47,10,30,-31,57,40,-68,9,4,-30,30,26,63,-18,19,-89,94,-61, 
@@ -626,12 +661,12 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data21[16*1*1*48]
 const TfArray<4, int> tensor_dimension21 = { 4, { 16,1,1,48 } };
 const TfArray<16, float> quant21_scale = { 16, { 0.0064223860390484333, 0.0063395597971975803, 0.0066498047672212124, 0.0071339844726026058, 0.0044182310812175274, 0.0058487360365688801, 0.0040074135176837444, 0.00602365517988801, 0.0048401099629700184, 0.0039513753727078438, 0.007634477224200964, 0.0059760231524705887, 0.0056984508410096169, 0.0033283091615885496, 0.0064586391672492027, 0.0057817110791802406, } };
 const TfLiteAffineQuantization quant21 = { (TfLiteFloatArray*)&quant21_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data22[48] = { 14760, -1039, 21920, -68, 16557, -2405, 35131, 255, 10932, 32242, 2634, 22868, 4220, 11243, 32815, 23733, 149, 294, 4749, 49416, -212, 20373, -726, 16506, 19496, 33713, -1016, -1135, -1085, 14241, 22837, -26, -918, 380, 614, 17041, 10351, 34833, 2528, 18317, 29949, 827, 582, 17889, -421, 958, 42869, 26042, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data22[48] = { 14760, -1039, 21920, -68, 16557, -2405, 35131, 255, 10932, 32242, 2634, 22868, 4220, 11243, 32815, 23733, 149, 294, 4749, 49416, -212, 20373, -726, 16506, 19496, 33713, -1016, -1135, -1085, 14241, 22837, -26, -918, 380, 614, 17041, 10351, 34833, 2528, 18317, 29949, 827, 582, 17889, -421, 958, 42869, 26042, };
 const TfArray<1, int> tensor_dimension22 = { 1, { 48 } };
 const TfArray<48, float> quant22_scale = { 48, { 7.7740915003232658e-05, 0.00011657027062028646, 5.8362355048302561e-05, 0.00013087299885228276, 9.1970199719071388e-05, 7.818057929398492e-05, 5.9153564507141709e-05, 0.00024212578136939555, 0.0001015684028971009, 7.0649519329890609e-05, 6.4153929997701198e-05, 0.00010717514669522643, 5.5958782468223944e-05, 0.00012305799464229494, 5.2224222599761561e-05, 7.7549033449031413e-05, 9.4982962764333934e-05, 6.5610758611001074e-05, 0.00014097796520218253, 4.4536904169945046e-05, 7.9710494901519269e-05, 6.152005516923964e-05, 0.00013145619595889002, 8.5053485236130655e-05, 5.9257246903143823e-05, 7.4279785621911287e-05, 6.8739303969778121e-05, 4.210078259347938e-05, 0.00023895825142972171, 0.00010018936882261187, 7.015636219875887e-05, 0.00036108362837694585, 0.00015636254101991653, 0.00018885415920522064, 9.1370413429103792e-05, 7.5110219768248498e-05, 9.482145105721429e-05, 4.883256769971922e-05, 8.2956539699807763e-05, 9.5419454737566411e-05, 4.9285121349385008e-05, 0.00017442496027797461, 0.00034276754013262689, 7.4208306614309549e-05, 0.00015694089233875275, 6.1358085076790303e-05, 4.6042463509365916e-05, 6.1168291722424328e-05, } };
 const TfArray<48, int> quant22_zero = { 48, { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } };
 const TfLiteAffineQuantization quant22 = { (TfLiteFloatArray*)&quant22_scale, (TfLiteIntArray*)&quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data23[1*3*3*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data23[1*3*3*48] = { 
   /* [0][0][][] */ -98,60,-127,97,-94,64,-47,84,-72,-66,60,-50,61,-78,-37,-49,71,68,83,-106,93,-119,75,-87,-104,-54,64,120,-100,-59,-87,47,78,-91,63,-98,-80,-117,84,-53,-8,-84,119,-93,101,56,-84,-50, -115,85,-66,115,-77,114,-47,108,-112,-97,102,-71,92,-107,-57,-75,94,104,127,-127,120,-127,90,-127,-112,-87,76,127,24,-89,-104,98,104,-127,92,-115,-95,-127,110,-77,-96,104,125,-104,-30,99,-98,-96, -65,47,-6,35,-22,59,-29,33,-53,-40,42,-21,41,-47,-24,-14,36,49,61,-38,38,-60,29,-47,-85,-30,29,32,96,-35,-67,17,32,-82,30,-40,-20,-29,47,-46,-110,-32,30,-54,-65,63,-29,-70, 
   /* [0][1][][] */ -101,88,-67,111,-75,103,-112,97,-103,-90,81,-85,91,-104,-88,-103,97,86,-54,-97,98,-118,101,-82,-122,-91,101,113,-127,-82,-105,90,98,27,94,-111,-100,-119,101,-88,-125,-107,114,-123,127,68,-123,-91, -127,127,-113,127,-127,127,-127,127,-127,-127,127,-127,127,-127,-127,-127,127,127,-62,-122,127,-122,127,-124,-127,-127,127,117,11,-127,-127,127,127,38,127,-127,-127,-104,127,-127,-127,127,127,-127,-52,127,-127,-127, -80,80,-100,37,-54,38,-61,72,-57,-40,56,-47,51,-58,-53,-16,67,55,-49,-35,31,-57,39,-52,-124,-52,51,51,96,-54,-71,60,40,7,50,-44,-31,-16,61,-64,-49,-62,38,-70,-86,78,-30,-77, 
   /* [0][2][][] */ -46,51,4,49,-39,53,-61,26,-47,-39,26,-41,38,-46,-33,-58,58,37,-82,-27,18,-29,34,-40,-63,-37,42,9,-69,-45,-42,44,34,50,49,-55,-47,-48,27,-44,-120,-50,45,-89,74,32,-56,-42, -66,66,-95,59,-74,42,-72,34,-55,-49,42,-62,49,-58,-48,-54,73,52,-102,-25,20,-30,40,-53,-60,-53,50,39,1,-86,-68,50,38,65,61,-67,-57,-46,32,-56,-69,66,50,-104,-29,56,-58,-64, -30,42,-85,16,-41,3,-38,23,-10,-11,25,-21,19,-14,-22,1,37,21,-73,-1,7,3,9,-14,-43,-22,28,19,52,-19,-26,22,9,37,29,-18,-13,6,19,-16,4,-27,3,-40,-47,42,-4,-46, 
@@ -639,10 +674,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data23[1*3*3*48] =
 const TfArray<4, int> tensor_dimension23 = { 4, { 1,3,3,48 } };
 const TfArray<48, float> quant23_scale = { 48, { 0.0034614000469446182, 0.0051902700215578079, 0.0025985732208937407, 0.0058270967565476894, 0.0040949564427137375, 0.0034809759818017483, 0.0026338016614317894, 0.010780606418848038, 0.0045223147608339787, 0.0031456570141017437, 0.0028564422391355038, 0.0047719539143145084, 0.0024915547110140324, 0.0054791350848972797, 0.0023252740502357483, 0.0034528567921370268, 0.0042290990240871906, 0.0029213069938123226, 0.0062770182266831398, 0.0019829976372420788, 0.0035490952432155609, 0.0027391691692173481, 0.0058530634269118309, 0.0037869908846914768, 0.0026384182274341583, 0.003307294100522995, 0.0030606051441282034, 0.0018745297566056252, 0.010639572516083717, 0.0044609135948121548, 0.0031236994545906782, 0.016077183187007904, 0.0069620138965547085, 0.008408697322010994, 0.0040682512335479259, 0.0033442687708884478, 0.0042219078168272972, 0.0021742612589150667, 0.0036936248652637005, 0.0042485338635742664, 0.0021944111213088036, 0.0077662398107349873, 0.015261662192642689, 0.0033041115384548903, 0.0069877645000815392, 0.0027319574728608131, 0.0020500323735177517, 0.0027235071174800396, } };
 const TfLiteAffineQuantization quant23 = { (TfLiteFloatArray*)&quant23_scale, (TfLiteIntArray*)&g0::quant22_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data24[48] = { 2536, -1054, 879, -2079, 4478, -862, 3783, -4554, 1185, 664, 2561, 4466, 538, -510, 606, 4743, -1895, 4487, 6612, 739, -914, 2628, -877, 5559, 2349, 2420, 1261, -1020, 8555, -494, 2726, -2425, -1006, 4500, -1039, 2279, 2029, 1156, 391, 4579, 2047, 9967, -4850, 1695, 8753, 19, 2776, 3068, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data24[48] = { 2536, -1054, 879, -2079, 4478, -862, 3783, -4554, 1185, 664, 2561, 4466, 538, -510, 606, 4743, -1895, 4487, 6612, 739, -914, 2628, -877, 5559, 2349, 2420, 1261, -1020, 8555, -494, 2726, -2425, -1006, 4500, -1039, 2279, 2029, 1156, 391, 4579, 2047, 9967, -4850, 1695, 8753, 19, 2776, 3068, };
 const TfArray<48, float> quant24_scale = { 48, { 0.00016683027206454426, 0.00030702329240739346, 0.00024579011369496584, 0.00023138384858611971, 0.00017178078996948898, 0.00017030049639288336, 0.00019607228750828654, 0.00011839738726848736, 0.00024327129358425736, 0.0002734000445343554, 0.00016739979037083685, 0.00017326753004454076, 0.00025325722526758909, 0.00027643825160339475, 0.00024527785717509687, 0.00015960686141625047, 0.00022642756812274456, 0.00017037942598108202, 0.00013573812611866742, 0.00029510751483030617, 0.0002643076004460454, 0.00021590941469185054, 0.00018504961917642504, 0.00014535291120409966, 0.000185396071174182, 0.00017172578372992575, 0.00025348833878524601, 0.00023901165695860982, 0.00010444819054100662, 0.00026289987727068365, 0.00016683143621776253, 0.00014577308320440352, 0.00016738097474444658, 0.00016868971579242498, 0.00020871074229944497, 0.00024020287673920393, 0.00021435943199321628, 0.00018926167103927583, 0.00019273856014478952, 0.00016897906607482582, 0.00024131436657626182, 9.0230038040317595e-05, 0.00011636726412689313, 0.00024120489251799881, 0.0001000896081677638, 0.00022149978030938655, 0.00019229731697123498, 0.00019664107821881771, } };
 const TfLiteAffineQuantization quant24 = { (TfLiteFloatArray*)&quant24_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data25[48*1*1*8] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data25[48*1*1*8] = { 
   /* [0][0][][] */ 69,35,127,-38,71,112,-76,-55, 
   /* [1][0][][] */ 8,-81,-127,5,46,25,27,1, 
   /* [2][0][][] */ -127,-2,-47,-23,58,25,-70,-43, 
@@ -695,12 +730,12 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data25[48*1*1*8] =
 const TfArray<4, int> tensor_dimension25 = { 4, { 48,1,1,8 } };
 const TfArray<48, float> quant25_scale = { 48, { 0.0021738230716437101, 0.0040005589835345745, 0.0032026816625148058, 0.0030149656813591719, 0.0022383290342986584, 0.0022190406452864408, 0.0025548508856445551, 0.0015427354956045747, 0.0031698609236627817, 0.00356244295835495, 0.0021812440827488899, 0.0022577014751732349, 0.0032999790273606777, 0.0036020311526954174, 0.0031960068736225367, 0.0020797010511159897, 0.0029503847472369671, 0.00222006905823946, 0.0017686878563836217, 0.0038452947046607733, 0.0034439670853316784, 0.0028133315499871969, 0.0024112239480018616, 0.001893969951197505, 0.0024157383013516665, 0.0022376123815774918, 0.0033029906917363405, 0.0031143571250140667, 0.0013609753223136067, 0.0034256242215633392, 0.0021738382056355476, 0.0018994447309523821, 0.0021809989120811224, 0.0021980518940836191, 0.0027195317670702934, 0.0031298790127038956, 0.0027931351214647293, 0.0024661074858158827, 0.0025114119052886963, 0.0022018221206963062, 0.0031443617772310972, 0.0011757106985896826, 0.0015162826748564839, 0.0031429354567080736, 0.0013041823403909802, 0.0028861749451607466, 0.0025056623853743076, 0.0025622623506933451, } };
 const TfLiteAffineQuantization quant25 = { (TfLiteFloatArray*)&quant25_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data26[8] = { 1420, 423, 22506, -5864, 4912, -14082, 1744, -13311, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data26[8] = { 1420, 423, 22506, -5864, 4912, -14082, 1744, -13311, };
 const TfArray<1, int> tensor_dimension26 = { 1, { 8 } };
 const TfArray<8, float> quant26_scale = { 8, { 7.9641467891633511e-05, 0.00010188281157752499, 0.00013978041533846408, 0.00010646350710885599, 0.00012213195441290736, 0.00014390167780220509, 8.2508318882901222e-05, 8.4620005509350449e-05, } };
 const TfArray<8, int> quant26_zero = { 8, { 0,0,0,0,0,0,0,0 } };
 const TfLiteAffineQuantization quant26 = { (TfLiteFloatArray*)&quant26_scale, (TfLiteIntArray*)&quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data27[8*1*1*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data27[8*1*1*48] = { 
   /* [0][0][][] */ -39,-46,-17,-65,5,-14,90,87,-96,-83,-33,5,-53,-7,-64,38,-87,15,15,127,55,-23,17,95,74,78,30,0,-88,-53,-77,-60,-55,103,29,-45,30,-29,96,-3,27,10,3,-103,43,-35,-30,-84, 
   /* [1][0][][] */ -16,52,-19,-25,-74,65,-21,-50,-36,76,-17,18,56,48,-49,-8,-21,-120,77,-51,127,13,-66,21,57,1,-83,64,38,-14,66,36,-29,-15,0,-11,3,113,-14,-26,63,46,-9,12,107,19,-32,56, 
   /* [2][0][][] */ -23,-34,115,6,86,-41,-12,24,-31,2,-10,44,11,-43,-45,-127,-52,-96,-26,15,-97,24,-39,-36,-46,20,1,-44,-41,8,-31,-13,0,-3,23,-2,27,-27,-47,10,34,-29,29,-45,-44,-41,-60,-51, 
@@ -713,20 +748,20 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data27[8*1*1*48] =
 const TfArray<4, int> tensor_dimension27 = { 4, { 8,1,1,48 } };
 const TfArray<8, float> quant27_scale = { 8, { 0.0033847622107714415, 0.0043300194665789604, 0.0059406673535704613, 0.0045246989466249943, 0.0051906080916523933, 0.0061158211901783943, 0.0035066034179180861, 0.0035963503178209066, } };
 const TfLiteAffineQuantization quant27 = { (TfLiteFloatArray*)&quant27_scale, (TfLiteIntArray*)&g0::quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data28[48] = { 279, 9663, -438, -151, 524, -1427, 3260, -1534, -4568, 208, -6664, -70, -313, -789, -2251, 4627, 6047, 3399, -249, -4419, -7555, 404, 14762, -5283, -2727, -1077, 5335, -7579, -466, -126, -8821, 9541, 4114, -234, 3812, -539, 26, -537, 10444, 146, 6070, -3109, 2920, 6773, -602, 10438, 565, 488, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data28[48] = { 279, 9663, -438, -151, 524, -1427, 3260, -1534, -4568, 208, -6664, -70, -313, -789, -2251, 4627, 6047, 3399, -249, -4419, -7555, 404, 14762, -5283, -2727, -1077, 5335, -7579, -466, -126, -8821, 9541, 4114, -234, 3812, -539, 26, -537, 10444, 146, 6070, -3109, 2920, 6773, -602, 10438, 565, 488, };
 const TfArray<48, float> quant28_scale = { 48, { 0.00030531940865330398, 0.00017770694103091955, 0.00069354294100776315, 0.00024823821149766445, 0.00025218594237230718, 0.00030224042711779475, 0.00020419667998794466, 0.00030859143589623272, 9.4234099378809333e-05, 0.00033670736593194306, 0.00021072238450869918, 0.0016069230623543262, 0.00043732326594181359, 0.00062737520784139633, 0.00043813552474603057, 0.00060133921215310693, 0.00018860747513826936, 5.9413614508230239e-05, 0.00023315424914471805, 0.00031672167824581265, 0.0002223771734861657, 0.00023823115043342113, 0.0001033278094837442, 0.00043773354263976216, 0.00017718909657560289, 0.00035803811624646187, 0.00052121735643595457, 0.00018804801220539957, 0.00022149216965772212, 0.00033874259679578245, 0.00012593096471391618, 0.00012316514039412141, 0.00015991191321518272, 0.00020298348681535572, 0.00015056143456604332, 0.00032011349685490131, 0.0019937185570597649, 0.00038544824928976595, 0.00015299856022465974, 0.00016061055066529661, 0.00018492118397261947, 0.00013427149679046124, 0.0003024785837624222, 0.00018173344142269343, 0.00030938905547372997, 8.2794344052672386e-05, 6.249466969165951e-05, 0.00018102295871358365, } };
 const TfLiteAffineQuantization quant28 = { (TfLiteFloatArray*)&quant28_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data29[1*3*3*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data29[1*3*3*48] = { 
   /* [0][0][][] */ 5,-36,8,5,-19,-88,-47,52,-33,-3,-7,7,45,-4,-14,3,96,18,29,3,2,-28,-75,20,1,-15,-3,-20,-62,72,-9,-111,59,-4,-48,-49,-11,-29,6,-12,-15,41,9,-1,-13,62,127,-18, -127,-83,-23,127,-65,79,-105,127,30,15,11,-5,51,20,-4,-44,-30,66,31,6,12,127,8,127,127,-28,-44,44,72,-119,-5,-65,75,-2,-37,-117,23,14,-57,-55,-127,0,-92,-127,32,50,48,119, -11,2,11,6,-24,38,35,43,7,-37,-2,1,-22,-1,-4,5,-58,34,-64,-25,-3,-30,127,23,-47,5,9,5,18,41,11,11,1,-13,-36,75,5,5,12,66,22,-17,27,-36,-12,31,-23,-22, 
   /* [0][1][][] */ -15,-18,-28,-3,32,-97,127,-75,-8,11,19,36,127,17,0,-33,-27,-26,27,47,65,-68,39,11,-59,127,-77,-12,127,-96,46,-127,-39,6,-83,20,9,-59,-43,9,114,127,7,-127,-69,-57,-5,89, 90,-127,127,-2,127,75,-77,-46,34,127,127,-127,-92,127,127,127,127,127,124,127,127,123,0,7,114,-99,-127,127,37,127,127,4,-127,127,127,127,-127,127,-127,-124,35,38,-127,-40,127,-127,-16,82, 22,30,-40,-8,-49,127,-126,101,109,-77,18,60,-38,9,12,-64,17,6,-127,20,22,-114,-41,-1,74,-14,-24,123,-80,-33,22,-34,-24,19,93,-19,37,-5,-4,-93,105,4,32,40,-61,84,88,-91, 
   /* [0][2][][] */ -6,23,6,-34,2,-55,-21,-13,6,-1,0,3,-13,-14,-1,-1,-54,15,9,-35,3,-25,82,-10,-99,4,39,-16,9,-3,-1,26,-6,-9,-71,35,-1,-10,16,51,-27,3,13,2,-18,21,-14,13, 35,-19,-35,-39,29,42,116,-105,127,-32,2,6,-69,-22,-21,-72,-21,101,7,28,10,28,-29,-30,-69,60,76,0,-95,14,-34,-17,-19,-4,-39,7,53,-23,-2,127,-114,2,-7,52,33,54,6,-127, -10,27,4,-23,-13,4,-12,-51,-27,-23,-5,3,18,-13,-11,14,47,31,-26,-13,-4,-23,-55,-14,26,-23,23,-9,-16,4,-12,9,35,-13,-27,-46,-7,5,26,13,-7,-9,10,8,-17,14,56,-57, 
 };
 const TfArray<48, float> quant29_scale = { 48, { 0.013532517477869987, 0.0078764148056507111, 0.030739553272724152, 0.011002536863088608, 0.011177510023117065, 0.013396049849689007, 0.009050506167113781, 0.013677541166543961, 0.0041766902431845665, 0.014923710376024246, 0.0093397414311766624, 0.071222834289073944, 0.019383257254958153, 0.027806833386421204, 0.019419258460402489, 0.026652852073311806, 0.0083595532923936844, 0.0026333595160394907, 0.01033397763967514, 0.014037895016372204, 0.009856310673058033, 0.010558998212218285, 0.0045797461643815041, 0.019401442259550095, 0.0078534623607993126, 0.015869142487645149, 0.023101653903722763, 0.0083347568288445473, 0.0098170852288603783, 0.015013916417956352, 0.0055815740488469601, 0.0054589859209954739, 0.0070876944810152054, 0.0089967343956232071, 0.006673258263617754, 0.01418822817504406, 0.088366575539112091, 0.017084026709198952, 0.0067812777124345303, 0.0071186600252985954, 0.0081961676478385925, 0.0059512476436793804, 0.013406604528427124, 0.0080548794940114021, 0.013712894171476364, 0.0036696516908705235, 0.002769919577986002, 0.008023388683795929, } };
 const TfLiteAffineQuantization quant29 = { (TfLiteFloatArray*)&quant29_scale, (TfLiteIntArray*)&g0::quant22_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data30[48] = { 3241, 5112, 19078, 2103, 2926, -2094, 6928, 18458, 4763, -1006, 4322, -2555, 24246, -2119, 2519, 21855, -372, 2542, 116, 3616, 3997, 4070, 740, 29248, 6643, 4518, 20204, 1709, 8472, 6264, 780, 1314, 1104, 1924, -338, 223, -3498, -645, 3154, 2447, 5013, 2826, 4774, 5820, 5354, 3985, 2050, 6887, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data30[48] = { 3241, 5112, 19078, 2103, 2926, -2094, 6928, 18458, 4763, -1006, 4322, -2555, 24246, -2119, 2519, 21855, -372, 2542, 116, 3616, 3997, 4070, 740, 29248, 6643, 4518, 20204, 1709, 8472, 6264, 780, 1314, 1104, 1924, -338, 223, -3498, -645, 3154, 2447, 5013, 2826, 4774, 5820, 5354, 3985, 2050, 6887, };
 const TfArray<48, float> quant30_scale = { 48, { 0.00018219920457340777, 0.00016182461695279926, 5.1699200412258506e-05, 0.00014676577120553702, 0.00017822055087890476, 0.00020279378804843873, 0.00011118536349385977, 5.319472256815061e-05, 0.00011760065535781905, 0.0001926502154674381, 0.00018525004270486534, 0.00018354317580815405, 4.0536320739192888e-05, 0.00019991313456557691, 0.00019038103346247226, 4.7898567572701722e-05, 0.00025458770687691867, 0.00017021171515807509, 0.00024293491151183844, 0.00016837897419463843, 0.000171933468664065, 0.00018004309094976634, 0.00026833382435142994, 3.720182940014638e-05, 0.00012452340160962194, 0.00012632487050723284, 5.1513852667994797e-05, 0.00022561769583262503, 9.3981863756198436e-05, 0.00012144369247835129, 0.0003773168136831373, 0.0003311670443508774, 0.00017513195052742958, 0.00019544630777090788, 0.00022186337446328253, 0.00024933915119618177, 0.00015909603098407388, 0.00022815489501226693, 0.00018273293972015381, 0.00020937624503858387, 0.00015276753401849419, 0.00017693598056212068, 0.00017238711006939411, 0.00013796264829579741, 0.00013729593774769455, 0.00017792840662878007, 0.00031999588827602565, 0.00011877117503900081, } };
 const TfLiteAffineQuantization quant30 = { (TfLiteFloatArray*)&quant30_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data31[48*1*1*8] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data31[48*1*1*8] = { 
   /* [0][0][][] */ 63,127,-79,-83,15,78,13,65, 
   /* [1][0][][] */ 58,-75,43,-127,-59,73,-84,-44, 
   /* [2][0][][] */ -27,127,124,47,117,8,54,9, 
@@ -778,10 +813,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data31[48*1*1*8] =
 };
 const TfArray<48, float> quant31_scale = { 48, { 0.0031631288584321737, 0.0028094092849642038, 0.000897540885489434, 0.0025479751639068127, 0.0030940561555325985, 0.0035206680186092854, 0.0019302698783576488, 0.00092350441263988614, 0.002041644649580121, 0.0033445670269429684, 0.0032160941045731306, 0.0031864612828940153, 0.00070374406641349196, 0.0034706573933362961, 0.0033051723148673773, 0.00083155877655372024, 0.0044198529794812202, 0.0029550162144005299, 0.004217551089823246, 0.002923198277130723, 0.0029849072452634573, 0.0031256969086825848, 0.004658497404307127, 0.00064585451036691666, 0.0021618292666971684, 0.0021931042429059744, 0.00089432310778647661, 0.0039169099181890488, 0.0016316028777509928, 0.0021083629690110683, 0.0065505318343639374, 0.0057493336498737335, 0.003040435491129756, 0.00339310965500772, 0.0038517317734658718, 0.0043287337757647038, 0.0027620387263596058, 0.0039609577506780624, 0.0031723950523883104, 0.0036349447909742594, 0.0026521708350628614, 0.0030717549379914999, 0.0029927829746156931, 0.0023951458279043436, 0.0023835711181163788, 0.0030889844056218863, 0.005555393174290657, 0.0020619658753275871, } };
 const TfLiteAffineQuantization quant31 = { (TfLiteFloatArray*)&quant31_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data32[8] = { 7359, 15624, -4701, 7513, -791, 4072, -12037, -18229, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data32[8] = { 7359, 15624, -4701, 7513, -791, 4072, -12037, -18229, };
 const TfArray<8, float> quant32_scale = { 8, { 0.00020740245236083865, 0.00010937973274849355, 0.00014766270760446787, 0.00014533512876369059, 0.00020252194372005761, 0.00020704300550278276, 0.00024301855592057109, 0.00014460322563536465, } };
 const TfLiteAffineQuantization quant32 = { (TfLiteFloatArray*)&quant32_scale, (TfLiteIntArray*)&g0::quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data33[8*1*1*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data33[8*1*1*48] = { 
   /* [0][0][][] */ -43,-4,34,13,-33,-14,11,9,-42,-5,-63,-57,-25,-62,-11,-30,47,-41,40,40,-15,30,-39,12,1,-37,54,-15,-4,-18,17,9,83,37,38,-127,18,0,-15,-35,5,-16,43,49,36,5,28,4, 
   /* [1][0][][] */ -1,41,68,-27,-13,44,-50,-28,5,27,-15,-93,10,89,-17,59,-21,19,-24,-58,13,-82,-26,23,-74,-10,-3,-117,-26,-19,33,-57,51,82,-38,3,127,-33,0,49,-31,38,-85,-32,118,-19,-34,-28, 
   /* [2][0][][] */ -4,-21,-61,15,-3,47,24,3,-10,41,0,24,62,-90,18,-59,37,-91,24,34,-22,52,-2,25,-17,61,-21,-69,15,6,19,-68,-44,-86,36,-29,105,24,-9,-59,1,29,80,30,127,16,22,27, 
@@ -793,20 +828,20 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data33[8*1*1*48] =
 };
 const TfArray<8, float> quant33_scale = { 8, { 0.0088146040216088295, 0.0046486384235322475, 0.0062756650149822235, 0.0061767427250742912, 0.008607182651758194, 0.0087993275374174118, 0.010328288190066814, 0.0061456370167434216, } };
 const TfLiteAffineQuantization quant33 = { (TfLiteFloatArray*)&quant33_scale, (TfLiteIntArray*)&g0::quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data34[48] = { 14627, 5050, 4456, 79, 1862, -1069, -537, 30978, -810, 1770, 6837, 56553, 1566, 6293, 178, 11353, -1618, 13804, 121, 6469, 11715, 322, 3118, -9639, 13299, 852, 2859, 14411, 1152, -1102, -9972, 13207, 3948, 2203, -5, 8298, -8785, 12948, -1377, 18296, -571, -1163, 4968, 3819, 1137, -407, 1840, -600, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data34[48] = { 14627, 5050, 4456, 79, 1862, -1069, -537, 30978, -810, 1770, 6837, 56553, 1566, 6293, 178, 11353, -1618, 13804, 121, 6469, 11715, 322, 3118, -9639, 13299, 852, 2859, 14411, 1152, -1102, -9972, 13207, 3948, 2203, -5, 8298, -8785, 12948, -1377, 18296, -571, -1163, 4968, 3819, 1137, -407, 1840, -600, };
 const TfArray<48, float> quant34_scale = { 48, { 8.8267363025806844e-05, 9.2181995569262654e-05, 0.00016368692740797997, 0.00013732163642998785, 0.00064899231074377894, 0.00017336408200208098, 0.00016828607476782054, 0.00010182274854741991, 9.9675969977397472e-05, 8.5914063674863428e-05, 7.3726230766624212e-05, 5.2290448365965858e-05, 8.4283623436931521e-05, 5.8620145864551887e-05, 0.00029132884810678661, 0.00019381107995286584, 0.00011617516429396346, 0.00033901009010151029, 0.00013160335947759449, 0.00016066103125922382, 8.7568267190363258e-05, 0.00049403839511796832, 9.8300115496385843e-05, 0.00022859396995045245, 0.00010284183372277766, 0.00010832013504114002, 5.5569234973518178e-05, 8.0320671258959919e-05, 0.00021174155699554831, 0.00087018986232578754, 0.00022850588720757514, 7.1483082138001919e-05, 8.7710868683643639e-05, 0.00013402245531324297, 0.00017803361697588116, 4.9056372517952695e-05, 8.1024685641750693e-05, 3.9847203879617155e-05, 0.00011252663534833118, 7.3842566052917391e-05, 0.00014313613064587116, 0.00016565037367399782, 7.4996045441366732e-05, 6.5397180151194334e-05, 7.7069133112672716e-05, 0.00034405660699121654, 6.9903791882097721e-05, 0.00016535045870114118, } };
 const TfLiteAffineQuantization quant34 = { (TfLiteFloatArray*)&quant34_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data35[1*3*3*48] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data35[1*3*3*48] = { 
   /* [0][0][][] */ -49,-100,-16,-21,127,-53,64,-53,-86,-82,-27,-47,108,35,57,-127,58,-27,5,-34,-86,117,-7,18,-19,73,65,-39,71,-69,17,-49,-114,-93,45,75,23,76,104,-66,-125,-15,32,73,51,-127,86,80, -69,-122,-79,47,-91,110,61,-67,-67,40,78,-108,127,91,103,-78,-78,-87,36,-52,-91,99,-66,116,-87,96,90,-126,86,-48,8,-123,-53,-89,74,127,114,111,127,-67,-127,-65,65,83,82,108,92,73, 2,-63,-69,91,-50,-28,21,-7,96,26,58,-62,24,54,-41,-4,-75,-21,35,-31,-33,11,-89,-1,-74,37,15,-88,31,55,123,-77,11,12,-12,49,78,67,52,-4,-25,94,54,29,44,27,18,-114, 
   /* [0][1][][] */ -120,-98,-18,-77,-87,-74,96,-106,-127,-127,83,-78,90,45,-127,-83,127,-127,-60,-72,-87,122,-51,13,-15,98,104,-53,-105,-76,3,-59,-99,-127,-127,69,42,88,7,-95,53,-15,78,119,84,109,120,-127, -127,-127,-127,-105,-34,127,127,-127,98,65,127,-127,113,127,58,-119,57,-94,-127,-127,-127,127,-127,127,-127,127,127,-127,-127,127,-12,-127,-127,-115,46,126,127,127,-11,-127,91,-98,127,127,127,-2,127,109, -57,-72,-122,127,72,-46,46,-26,73,30,18,-50,14,64,69,-50,-13,-1,-14,-67,-60,4,-74,-16,-112,48,26,-89,-52,36,127,-95,-55,10,59,76,84,77,-25,-38,39,127,70,21,55,-50,23,25, 
   /* [0][2][][] */ -115,-37,20,15,-50,-29,18,-36,29,-46,12,-36,0,16,-49,-18,-79,-25,97,-26,-21,46,-75,-10,-4,59,72,-21,30,56,-4,-9,5,-83,-44,43,14,7,-54,-43,15,-2,37,43,29,54,18,-68, -95,-50,-31,-75,87,38,49,-57,100,23,-46,-57,-4,39,-126,-81,32,6,51,-61,-49,38,-63,54,-68,65,75,-36,31,4,-26,-34,-63,-27,-66,60,30,14,-99,-69,25,-42,79,67,42,-107,28,-1, -39,-37,-51,-23,-27,-18,10,-19,-69,16,-19,-9,-11,13,32,-27,27,35,1,-45,-38,-8,-11,-28,-53,13,22,-24,6,-65,55,-31,-80,19,17,51,21,20,-50,-37,4,46,20,22,19,-6,10,36, 
 };
 const TfArray<48, float> quant35_scale = { 48, { 0.003751362906768918, 0.0039177346043288708, 0.0069566941820085049, 0.0058361692354083061, 0.027582172304391861, 0.0073679732158780098, 0.0071521583013236523, 0.0043274667114019394, 0.0042362287640571594, 0.0036513477098196745, 0.0031333647202700377, 0.002222344046458602, 0.0035820538178086281, 0.0024913561064749956, 0.012381475418806076, 0.0082369707524776459, 0.0049374443478882313, 0.014407928101718426, 0.0055931424722075462, 0.0068280939012765884, 0.0037216513883322477, 0.020996630191802979, 0.004177754744887352, 0.0097152432426810265, 0.0043707778677344322, 0.004603605717420578, 0.002361692488193512, 0.0034136285539716482, 0.008999016135931015, 0.036983069032430649, 0.0097115002572536469, 0.0030380310490727425, 0.003727711969986558, 0.0056959544308483601, 0.0075664287433028221, 0.0020848957356065512, 0.003443548921495676, 0.0016935061430558562, 0.004782381933182478, 0.0031383088789880276, 0.0060832854360342026, 0.0070401406846940517, 0.0031873318366706371, 0.0027793801855295897, 0.0032754379790276289, 0.014622405171394348, 0.0029709110967814922, 0.0070273946039378643, } };
 const TfLiteAffineQuantization quant35 = { (TfLiteFloatArray*)&quant35_scale, (TfLiteIntArray*)&g0::quant22_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data36[48] = { 1632, -673, -563, 1535, 19135, 2842, -717, 6688, 1828, 1707, 360, 4022, 1680, 861, -1336, 606, 4586, 15739, 4715, -959, 1299, -1856, -124, 2954, -391, -998, 2356, -48, 4130, 24902, 2950, -19, 625, -90, 4047, 69, 626, -271, 1281, 1637, 2547, 3036, 253, -370, 816, 3361, 1969, -246, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data36[48] = { 1632, -673, -563, 1535, 19135, 2842, -717, 6688, 1828, 1707, 360, 4022, 1680, 861, -1336, 606, 4586, 15739, 4715, -959, 1299, -1856, -124, 2954, -391, -998, 2356, -48, 4130, 24902, 2950, -19, 625, -90, 4047, 69, 626, -271, 1281, 1637, 2547, 3036, 253, -370, 816, 3361, 1969, -246, };
 const TfArray<48, float> quant36_scale = { 48, { 0.0003160089545417577, 0.00028867486980743706, 0.00019622626132331789, 0.00026586861349642277, 5.1903381972806528e-05, 0.00021895166719332337, 0.0003311538603156805, 0.00013580235827248544, 0.00022694579092785716, 0.0003937564033549279, 0.00023113322095014155, 0.00021772121544927359, 0.00015838957915548235, 0.00024958618450909853, 0.00020069185120519251, 0.00023064213746692985, 0.00015681755030527711, 5.9181682445341721e-05, 0.00016076925385277718, 0.00025522138457745314, 0.00032828329131007195, 0.00013584212865680456, 0.0003444119356572628, 0.00025245998403988779, 0.00035897447378374636, 0.00054396840278059244, 0.00022340506257023662, 0.00075935292989015579, 0.00019694589718710631, 3.9711194403935224e-05, 0.00024994154227897525, 0.00055248301941901445, 0.00028308838955126703, 0.00028589140856638551, 0.00018645678937900811, 0.00025570517755113542, 0.00035120893153361976, 0.00043843724415637553, 0.00032937474315986037, 0.00035905218101106584, 0.00022174438345246017, 0.00021223550720605999, 0.00022995461768005043, 0.00036281844950281084, 0.00033723391243256629, 0.00015057116979733109, 0.00019021947809960693, 0.0002586949267424643, } };
 const TfLiteAffineQuantization quant36 = { (TfLiteFloatArray*)&quant36_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data37[48*1*1*8] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data37[48*1*1*8] = { 
   /* [0][0][][] */ -41,30,2,-19,-82,-38,-127,31, 
   /* [1][0][][] */ 80,-76,-56,-54,127,-84,98,26, 
   /* [2][0][][] */ -100,123,-46,-127,54,-23,-26,38, 
@@ -858,10 +893,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data37[48*1*1*8] =
 };
 const TfArray<48, float> quant37_scale = { 48, { 0.0045755030587315559, 0.0041797319427132607, 0.0028411659877747297, 0.0038495196495205164, 0.00075151061173528433, 0.003170207841321826, 0.0047947866842150688, 0.0019662864506244659, 0.0032859549392014742, 0.0057012108154594898, 0.0033465849701315165, 0.0031523921061307192, 0.0022933275904506445, 0.0036137658171355724, 0.002905823290348053, 0.0033394745551049709, 0.0022705660667270422, 0.00085689336992800236, 0.0023277828004211187, 0.0036953582894057035, 0.0047532236203551292, 0.001966862240806222, 0.0049867508932948112, 0.0036553756799548864, 0.0051976023241877556, 0.0078761344775557518, 0.0032346886582672596, 0.010994694195687771, 0.0028515856247395277, 0.00057497958187013865, 0.0036189111415296793, 0.0079994183033704758, 0.0040988451801240444, 0.0041394303552806377, 0.0026997134555131197, 0.0037023629993200302, 0.0050851646810770035, 0.0063481461256742477, 0.004769026767462492, 0.0051987273618578911, 0.0032106435392051935, 0.0030729642603546381, 0.0033295198809355497, 0.0052532590925693512, 0.0048828199505805969, 0.0021801244001835585, 0.0027541934978216887, 0.0037456518039107323, } };
 const TfLiteAffineQuantization quant37 = { (TfLiteFloatArray*)&quant37_scale, (TfLiteIntArray*)&g0::quant22_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data38[8] = { -7350, -2879, 12011, -9850, 22630, 7832, -9428, 11149, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data38[8] = { -7350, -2879, 12011, -9850, 22630, 7832, -9428, 11149, };
 const TfArray<8, float> quant38_scale = { 8, { 0.00016685402079019696, 0.00024138471053447574, 0.00018330202146898955, 0.00023772107670083642, 0.00023587285249959677, 0.00016318079724442214, 0.00017161868163384497, 0.00027115471311844885, } };
 const TfLiteAffineQuantization quant38 = { (TfLiteFloatArray*)&quant38_scale, (TfLiteIntArray*)&g0::quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data39[8*1*1*16] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data39[8*1*1*16] = { 
   /* [0][0][][] */ -12,-13,-21,-68,-27,-34,19,-19,38,9,-31,-7,110,127,-21,-107, 
   /* [1][0][][] */ 127,-60,-42,15,-46,71,-68,-44,-38,82,-35,-53,-7,3,-65,-19, 
   /* [2][0][][] */ -34,-95,44,40,48,-56,-80,-23,31,-90,26,-127,45,-23,-76,22, 
@@ -874,10 +909,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data39[8*1*1*16] =
 const TfArray<4, int> tensor_dimension39 = { 4, { 8,1,1,16 } };
 const TfArray<8, float> quant39_scale = { 8, { 0.0070912959054112434, 0.010258849710226059, 0.0077903354540467262, 0.010103145614266396, 0.010024596005678177, 0.0069351838901638985, 0.0072937938384711742, 0.011524075642228127, } };
 const TfLiteAffineQuantization quant39 = { (TfLiteFloatArray*)&quant39_scale, (TfLiteIntArray*)&g0::quant26_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data40[16] = { 15645, -574, 271, 2688, -1093, 379, 10946, 1046, -705, -5, -2376, 2113, 2322, -593, -289, -986, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data40[16] = { 15645, -574, 271, 2688, -1093, 379, 10946, 1046, -705, -5, -2376, 2113, 2322, -593, -289, -986, };
 const TfArray<16, float> quant40_scale = { 16, { 0.00015022671141196042, 0.00024010331253521144, 0.00015330714813899249, 0.00016226930893026292, 0.001119456603191793, 0.00087947235442698002, 0.00014961211127229035, 0.0010637880768626928, 0.00030752349994145334, 0.0015242882072925568, 0.00031473493436351418, 0.00023090044851414859, 9.531499381409958e-05, 0.00025223317788913846, 0.00025639371597208083, 0.00068542035296559334, } };
 const TfLiteAffineQuantization quant40 = { (TfLiteFloatArray*)&quant40_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data41[1*3*3*16] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data41[1*3*3*16] = { 
   /* [0][0][][] */ 1,-5,5,4,-18,11,5,16,-4,-11,-1,-9,-1,-9,1,0, 5,-4,3,5,14,-2,10,-26,-6,9,-5,88,-9,19,6,0, 1,-4,-4,4,3,-14,-4,11,3,3,-4,-8,-1,-6,-3,-1, 
   /* [0][1][][] */ 11,-9,2,5,127,-24,-127,-21,127,127,-1,-5,111,-23,0,-18, -127,127,127,0,-85,-92,-17,-101,19,-105,127,127,127,127,127,127, 18,-2,-5,1,-9,127,3,-10,-1,-12,-3,-4,8,-3,-12,-8, 
   /* [0][2][][] */ -1,-3,1,-14,-17,15,52,7,-8,-7,-1,-1,-6,2,-6,-10, 20,-14,-4,-127,7,-16,-10,127,-4,2,2,-14,-12,-56,-8,-35, 1,-3,-4,-3,2,-5,-1,-2,1,2,-2,2,-2,-4,-7,-11, 
@@ -885,10 +920,10 @@ const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data41[1*3*3*16] =
 const TfArray<4, int> tensor_dimension41 = { 4, { 1,3,3,16 } };
 const TfArray<16, float> quant41_scale = { 16, { 0.0063846348784863949, 0.010204390622675419, 0.0065155536867678165, 0.0068964455276727676, 0.047576904296875, 0.037377573549747467, 0.0063585145398974419, 0.045210991054773331, 0.013069747947156429, 0.064782246947288513, 0.013376234099268913, 0.009813268668949604, 0.0040508871898055077, 0.010719910264015198, 0.010896732099354267, 0.029130363836884499, } };
 const TfLiteAffineQuantization quant41 = { (TfLiteFloatArray*)&quant41_scale, (TfLiteIntArray*)&g0::quant8_zero, 3 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data42[16] = { 1052, 91, -703, 470, 65840, 58037, 4832, 7458, 4269, 8564, 1209, 369, 5398, -5538, 214, 40574, };
+const FAST_MODEL_SECTION ALIGN(16) int32_t tensor_data42[16] = { 1052, 91, -703, 470, 65840, 58037, 4832, 7458, 4269, 8564, 1209, 369, 5398, -5538, 214, 40574, };
 const TfArray<16, float> quant42_scale = { 16, { 0.00022916789748705924, 0.00060924247372895479, 0.00024486146867275238, 0.00017853312601801008, 2.2463753339252435e-05, 2.6982535928254947e-05, 0.0001482216757722199, 2.5271312551922165e-05, 0.00017580323037691414, 3.0896597309038043e-05, 0.0004339680599514395, 0.00046840662253089249, 0.00030526926275342703, 1.5319521480705589e-05, 0.00047472614096477628, 3.0949489882914349e-05, } };
 const TfLiteAffineQuantization quant42 = { (TfLiteFloatArray*)&quant42_scale, (TfLiteIntArray*)&g0::quant8_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t tensor_data43[16*3*3*1] = { 
+const FAST_MODEL_SECTION ALIGN(16) int8_t tensor_data43[16*3*3*1] = { 
   /* [0][0][][] */ -84, -108, -29, 
   /* [0][1][][] */ 67, -36, 17, 
   /* [0][2][][] */ 32, 127, 20, 
@@ -1129,33 +1164,33 @@ TensorInfo_t tensorData[] = {
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data41, (TfLiteIntArray*)&g0::tensor_dimension41, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant41))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data42, (TfLiteIntArray*)&g0::tensor_dimension8, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant42))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data43, (TfLiteIntArray*)&g0::tensor_dimension43, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant43))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36864), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36864), (TfLiteIntArray*)&g0::tensor_dimension46, 18432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant46))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 115248), (TfLiteIntArray*)&g0::tensor_dimension47, 110592, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension48, 115248, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 115248), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 55296), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant50))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant51))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 36864), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension46, 18432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant46))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 4656), (TfLiteIntArray*)&g0::tensor_dimension47, 110592, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension48, 115248, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant53))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant54))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant55))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension56, 30000, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant55))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension57, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant57))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36912), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant58))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant59))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant60))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant61))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant62))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant63))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 16128), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant65))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant66))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant67))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension68, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant68))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 432), (TfLiteIntArray*)&g0::tensor_dimension69, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant69))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension69, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant70))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 27648), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant50))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant51))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant53))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 27648), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant54))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant55))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension56, 30000, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant55))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension57, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant57))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant58))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant59))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant60))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant61))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena_slow + 0), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant62))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant63))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant65))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant66))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 2304), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant67))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 16128), (TfLiteIntArray*)&g0::tensor_dimension68, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant68))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension69, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant69))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 432), (TfLiteIntArray*)&g0::tensor_dimension69, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant70))}, },
 };
 
 #ifndef TF_LITE_STATIC_MEMORY
@@ -1240,30 +1275,45 @@ static const int out_tensor_indices[] = {
 
 size_t current_subgraph_index = 0;
 
-static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
-  tensor->type = tensorData[i].type;
-  tensor->is_variable = false;
-
+// Arena of tensor i: 0 tensor_arena, 1 tensor_arena_slow, -1 none (weights).
+// Integer compares, the arenas are separate objects.
+static int tensor_tier(size_t i) {
 #if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  tensor->allocation_type = tensorData[i].allocation_type;
+  if (tensorData[i].allocation_type != kTfLiteArenaRw) {
+    return -1;
+  }
+  return (uintptr_t)tensorData[i].data < (uintptr_t)kTensorArenaSize ? 0 : 1;
 #else
-  tensor->allocation_type = (tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize) ? kTfLiteArenaRw : kTfLiteMmapRo;
+  uintptr_t p = (uintptr_t)tensorData[i].data;
+  if (p - (uintptr_t)tensor_arena < (uintptr_t)kTensorArenaSize) {
+    return 0;
+  }
+  if (p - (uintptr_t)tensor_arena_slow < (uintptr_t)kTensorArenaSlowSize) {
+    return 1;
+  }
+  return -1;
 #endif
-  tensor->bytes = tensorData[i].bytes;
-  tensor->dims = tensorData[i].dims;
+}
 
+static void* tensor_address(size_t i) {
 #if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  if(tensor->allocation_type == kTfLiteArenaRw){
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
-
-    tensor->data.data =  start;
-  }
-  else {
-      tensor->data.data = tensorData[i].data;
+  uintptr_t offset = (uintptr_t)tensorData[i].data;
+  switch (tensor_tier(i)) {
+    case 0: return tensor_arena + offset;
+    case 1: return tensor_arena_slow + (offset - kTensorArenaSize);
+    default: break;
   }
-#else
-  tensor->data.data = tensorData[i].data;
 #endif // EI_CLASSIFIER_ALLOCATION_HEAP
+  return tensorData[i].data;
+}
+
+static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
+  tensor->type = tensorData[i].type;
+  tensor->is_variable = false;
+  tensor->allocation_type = tensor_tier(i) >= 0 ? kTfLiteArenaRw : kTfLiteMmapRo;
+  tensor->bytes = tensorData[i].bytes;
+  tensor->dims = tensorData[i].dims;
+  tensor->data.data = tensor_address(i);
   tensor->quantization = tensorData[i].quantization;
   if (tensor->quantization.type == kTfLiteAffineQuantization) {
     TfLiteAffineQuantization const* quant = ((TfLiteAffineQuantization const*)(tensorData[i].quantization.params));
@@ -1279,19 +1329,7 @@ static void init_tflite_eval_tensor(int i, TfLiteEvalTensor *tensor) {
 
   tensor->dims = tensorData[i].dims;
 
-#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  auto allocation_type = tensorData[i].allocation_type;
-  if(allocation_type == kTfLiteArenaRw) {
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
-
-    tensor->data.data =  start;
-  }
-  else {
-    tensor->data.data = tensorData[i].data;
-  }
-#else
-  tensor->data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
+  tensor->data.data = tensor_address(i);
 }
 
 static void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
@@ -1315,6 +1353,9 @@ static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx,
       ei_printf("ERR: Failed to allocate persistent buffer of size %d\n", (int)bytes);
       return NULL;
     }
+#if EIDSP_TRACK_ALLOCATIONS
+    ei_alloc_profile_alloc(__func__, __FILE__, __LINE__, NULL, bytes, ptr);
+#endif
     overflow_buffers[overflow_buffers_ix++] = ptr;
     return ptr;
   }
@@ -1470,16 +1511,28 @@ class EonMicroContext : public MicroContext {
 
 TfLiteStatus tflite_learn_854371_3_init( void*(*alloc_fnc)(size_t,size_t) ) {
 #ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
+  if (kTierPlanned) {
+    tensor_arena = (uint8_t*) ei_arena_calloc(EI_ARENA_FAST, kTensorArenaSize);
+    tensor_arena_slow = kTensorArenaSlowSize ? (uint8_t*) ei_arena_calloc(EI_ARENA_SLOW, kTensorArenaSlowSize) : NULL;
+    if (tensor_arena && kTensorArenaSlowSize && !tensor_arena_slow) {
+      ei_arena_free(EI_ARENA_FAST, tensor_arena);
+      tensor_arena = NULL;
+    }
+  } else {
+    tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
+  }
   if (!tensor_arena) {
     ei_printf("ERR: failed to allocate tensor arena\n");
     return kTfLiteError;
   }
 #else
   memset(tensor_arena, 0, kTensorArenaSize);
+  memset(tensor_arena_slow, 0, kTensorArenaSlowSize);
 #endif
-  tensor_boundary = tensor_arena;
-  current_location = tensor_arena + kTensorArenaSize;
+  // persistent and scratch buffers are carved from the top of their tier's arena
+  uint8_t *persistent_arena = kTierScratchSlow ? tensor_arena_slow : tensor_arena;
+  tensor_boundary = persistent_arena;
+  current_location = persistent_arena + (kTierScratchSlow ? kTensorArenaSlowSize : kTensorArenaSize);
 
   EonMicroContext micro_context_;
   
@@ -1497,7 +1550,7 @@ TfLiteStatus tflite_learn_854371_3_init( void*(*alloc_fnc)(size_t,size_t) ) {
   for (size_t i = 0; i < 71; ++i) {
     TfLiteTensor tensor;
     init_tflite_tensor(i, &tensor);
-    if (tensor.allocation_type == kTfLiteArenaRw) {
+    if (tensor_tier(i) == (kTierScratchSlow ? 1 : 0)) {
       auto data_end_ptr = (uint8_t*)tensor.data.data + tensorData[i].bytes;
       if (data_end_ptr > tensor_boundary) {
         tensor_boundary = data_end_ptr;
@@ -1553,7 +1606,58 @@ TfLiteStatus tflite_learn_854371_3_output(int index, TfLiteTensor *tensor) {
   return kTfLiteOk;
 }
 
+size_t tflite_learn_854371_3_free_regions(ei_arena_region_t *regions, size_t max_regions) {
+  if (!current_location) {
+    return 0;
+  }
+  // tensors live in both arenas, persistent and scratch buffers at the top of
+  // one of them (from current_location); before the first layer only the
+  // graph inputs hold data. Each arena is scanned by offsets into itself.
+  const size_t inputs = sizeof(in_tensor_indices) / sizeof(in_tensor_indices[0]);
+  size_t n = 0;
+  for (int tier = 0; tier < 2; tier++) {
+    uint8_t *base = tier ? tensor_arena_slow : tensor_arena;
+    size_t size = tier ? kTensorArenaSlowSize : kTensorArenaSize;
+    if (!base || !size) {
+      continue;
+    }
+    if (tier == (kTierScratchSlow ? 1 : 0)) {
+      size = (size_t)(current_location - base);
+    }
+    size_t start = 0;
+    while (n < max_regions && start < size) {
+      size_t next = size, next_end = size;
+      for (size_t i = 0; i < inputs; i++) {
+        size_t t = in_tensor_indices[i];
+        if (tensor_tier(t) != tier) {
+          continue;
+        }
+        size_t begin = (size_t)((uint8_t*)tensor_address(t) - base), end = begin + tensorData[t].bytes;
+        if (end > start && begin < next) {
+          next = begin;
+          next_end = end;
+        }
+      }
+      if (next > start) {
+        regions[n].ptr = base + start;
+        regions[n].bytes = next - start;
+        n++;
+      }
+      start = next_end;
+    }
+  }
+  return n;
+}
+
+#if EI_CLASSIFIER_EON_SPECIALIZED
+#include "tflite_learn_854371_3_specialized.h"
+#endif
+
 TfLiteStatus tflite_learn_854371_3_invoke() {
+#if EI_CLASSIFIER_EON_SPECIALIZED
+  return tflite_learn_854371_3_invoke_specialized();
+#endif
+
   for (size_t i = 0; i < 27; ++i) {
     ResetTensors();
 
@@ -1565,11 +1669,7 @@ TfLiteStatus tflite_learn_854371_3_invoke() {
     for (size_t ix = 0; ix < tflNodes[i].inputs->size; ix++) {
       auto d = tensorData[tflNodes[i].inputs->data[ix]];
 
-      size_t data_ptr = (size_t)d.data;
-
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+      size_t data_ptr = (size_t)tensor_address(tflNodes[i].inputs->data[ix]);
 
       if (d.type == TfLiteType::kTfLiteInt8) {
         int8_t* data = (int8_t*)data_ptr;
@@ -1593,11 +1693,7 @@ TfLiteStatus tflite_learn_854371_3_invoke() {
     for (size_t ix = 0; ix < tflNodes[i].outputs->size; ix++) {
       auto d = tensorData[tflNodes[i].outputs->data[ix]];
 
-      size_t data_ptr = (size_t)d.data;
-
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+      size_t data_ptr = (size_t)tensor_address(tflNodes[i].outputs->data[ix]);
 
       if (d.type == TfLiteType::kTfLiteInt8) {
         int8_t* data = (int8_t*)data_ptr;
@@ -1627,8 +1723,18 @@ TfLiteStatus tflite_learn_854371_3_invoke() {
 
 TfLiteStatus tflite_learn_854371_3_reset( void (*free_fnc)(void* ptr) ) {
 #ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  free_fnc(tensor_arena);
+  if (kTierPlanned) {
+    ei_arena_free(EI_ARENA_FAST, tensor_arena);
+    if (tensor_arena_slow) {
+      ei_arena_free(EI_ARENA_SLOW, tensor_arena_slow);
+    }
+    tensor_arena_slow = NULL;
+  } else {
+    free_fnc(tensor_arena);
+  }
+  tensor_arena = NULL;
 #endif
+  current_location = NULL;
 
   // scratch buffers are allocated within the arena, so just reset the counter so memory can be reused
   scratch_buffers_ix = 0;
@@ -1636,6 +1742,9 @@ TfLiteStatus tflite_learn_854371_3_reset( void (*free_fnc)(void* ptr) ) {
   // overflow buffers are on the heap, so free them first
   for (size_t ix = 0; ix < overflow_buffers_ix; ix++) {
     ei_free(overflow_buffers[ix]);
+#if EIDSP_TRACK_ALLOCATIONS
+    ei_alloc_profile_free(overflow_buffers[ix]);
+#endif
   }
   overflow_buffers_ix = 0;
   return kTfLiteOk;
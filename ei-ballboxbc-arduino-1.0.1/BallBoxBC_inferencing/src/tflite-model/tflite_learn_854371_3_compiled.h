@@ -34,6 +34,7 @@
 #define tflite_learn_854371_3_GEN_H
 
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/classifier/ei_arena_regions.h"
 
 // Sets up the model with init and prepare steps.
 TfLiteStatus tflite_learn_854371_3_init( void*(*alloc_fnc)(size_t,size_t) );
@@ -45,6 +46,9 @@ TfLiteStatus tflite_learn_854371_3_output(int index, TfLiteTensor* tensor);
 TfLiteStatus tflite_learn_854371_3_invoke();
 //Frees memory allocated
 TfLiteStatus tflite_learn_854371_3_reset( void (*free)(void* ptr) );
+// Arena spans unused until the first layer runs (after init, before invoke),
+// in address order; returns how many were written, 0 if not initialized.
+size_t tflite_learn_854371_3_free_regions(ei_arena_region_t *regions, size_t max_regions);
 
 
 // Returns the number of input tensors.
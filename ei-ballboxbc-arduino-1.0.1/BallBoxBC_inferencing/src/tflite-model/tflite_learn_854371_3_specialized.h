@@ -0,0 +1,322 @@
+// Generated by host/eon_specialize from tflite_learn_854371_3_compiled.cpp, do not edit.
+// Included by that file when EI_CLASSIFIER_EON_SPECIALIZED is set: a
+// straight-line invoke with the shape of every conv fixed at compile time.
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/fixed_shape_kernels.h"
+
+namespace eon_shapes {
+struct Node0 {
+  static const int in_h = 96, in_w = 96, in_c = 1;
+  static const int out_h = 48, out_w = 48, out_c = 16;
+  static const int filter_h = 3, filter_w = 3, stride_h = 2, stride_w = 2;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node1 {
+  static const int in_h = 48, in_w = 48, in_c = 16;
+  static const int out_h = 48, out_w = 48, out_c = 16;
+  static const int filter_h = 3, filter_w = 3, stride_h = 1, stride_w = 1;
+  static const int pad_h = 1, pad_w = 1;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node2 {
+  static const int in_h = 48, in_w = 48, in_c = 16;
+  static const int out_h = 48, out_w = 48, out_c = 8;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = 4;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node3 {
+  static const int in_h = 48, in_w = 48, in_c = 8;
+  static const int out_h = 48, out_w = 48, out_c = 48;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = -4, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node5 {
+  static const int in_h = 49, in_w = 49, in_c = 48;
+  static const int out_h = 24, out_w = 24, out_c = 48;
+  static const int filter_h = 3, filter_w = 3, stride_h = 2, stride_w = 2;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node6 {
+  static const int in_h = 24, in_w = 24, in_c = 48;
+  static const int out_h = 24, out_w = 24, out_c = 8;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -5;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node7 {
+  static const int in_h = 24, in_w = 24, in_c = 8;
+  static const int out_h = 24, out_w = 24, out_c = 48;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 5, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node8 {
+  static const int in_h = 24, in_w = 24, in_c = 48;
+  static const int out_h = 24, out_w = 24, out_c = 48;
+  static const int filter_h = 3, filter_w = 3, stride_h = 1, stride_w = 1;
+  static const int pad_h = 1, pad_w = 1;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node9 {
+  static const int in_h = 24, in_w = 24, in_c = 48;
+  static const int out_h = 24, out_w = 24, out_c = 8;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -6;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node11 {
+  static const int in_h = 24, in_w = 24, in_c = 8;
+  static const int out_h = 24, out_w = 24, out_c = 48;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 22, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node13 {
+  static const int in_h = 25, in_w = 25, in_c = 48;
+  static const int out_h = 12, out_w = 12, out_c = 48;
+  static const int filter_h = 3, filter_w = 3, stride_h = 2, stride_w = 2;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node14 {
+  static const int in_h = 12, in_w = 12, in_c = 48;
+  static const int out_h = 12, out_w = 12, out_c = 16;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = 7;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node15 {
+  static const int in_h = 12, in_w = 12, in_c = 16;
+  static const int out_h = 12, out_w = 12, out_c = 96;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = -7, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node16 {
+  static const int in_h = 12, in_w = 12, in_c = 96;
+  static const int out_h = 12, out_w = 12, out_c = 96;
+  static const int filter_h = 3, filter_w = 3, stride_h = 1, stride_w = 1;
+  static const int pad_h = 1, pad_w = 1;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node17 {
+  static const int in_h = 12, in_w = 12, in_c = 96;
+  static const int out_h = 12, out_w = 12, out_c = 16;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -21;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node19 {
+  static const int in_h = 12, in_w = 12, in_c = 16;
+  static const int out_h = 12, out_w = 12, out_c = 96;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 10, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node20 {
+  static const int in_h = 12, in_w = 12, in_c = 96;
+  static const int out_h = 12, out_w = 12, out_c = 96;
+  static const int filter_h = 3, filter_w = 3, stride_h = 1, stride_w = 1;
+  static const int pad_h = 1, pad_w = 1;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node21 {
+  static const int in_h = 12, in_w = 12, in_c = 96;
+  static const int out_h = 12, out_w = 12, out_c = 16;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = 5;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node23 {
+  static const int in_h = 12, in_w = 12, in_c = 16;
+  static const int out_h = 12, out_w = 12, out_c = 96;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = -3, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node24 {
+  static const int in_h = 12, in_w = 12, in_c = 96;
+  static const int out_h = 12, out_w = 12, out_c = 32;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -128;
+  static const int act_min = -128, act_max = 127;
+};
+struct Node25 {
+  static const int in_h = 12, in_w = 12, in_c = 32;
+  static const int out_h = 12, out_w = 12, out_c = 3;
+  static const int filter_h = 1, filter_w = 1, stride_h = 1, stride_w = 1;
+  static const int pad_h = 0, pad_w = 0;
+  static const int input_offset = 128, output_offset = -13;
+  static const int act_min = -128, act_max = 127;
+};
+}  // namespace eon_shapes
+
+// Conv node data (OpDataConv first in every backend) as Prepare left it
+static inline const tflite::OpDataConv& specialized_op_data(size_t i) {
+  return *static_cast<const tflite::OpDataConv*>(tflNodes[i].user_data);
+}
+
+static TfLiteStatus tflite_learn_854371_3_invoke_specialized() {
+  TfLiteStatus status;
+  (void)status;
+
+  // 0: CONV_2D 96x96x1 -> 48x48x16, 3x3 stride 2
+  tflite::fixed_shape::Conv<eon_shapes::Node0>(
+      specialized_op_data(0), (const int8_t*)(tensor_address(0)), (const int8_t*)(g0::tensor_data43),
+      (const int32_t*)g0::tensor_data42, (int8_t*)(tensor_address(44)));
+
+  // 1: DEPTHWISE_CONV_2D 48x48x16 -> 48x48x16, 3x3 stride 1
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node1>(
+      specialized_op_data(1), (const int8_t*)(tensor_address(44)), (const int8_t*)(g0::tensor_data41),
+      (const int32_t*)g0::tensor_data40, (int8_t*)(tensor_address(45)));
+
+  // 2: CONV_2D 48x48x16 -> 48x48x8, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node2>(
+      specialized_op_data(2), (const int8_t*)(tensor_address(45)), (const int8_t*)(g0::tensor_data39),
+      (const int32_t*)g0::tensor_data38, (int8_t*)(tensor_address(46)));
+
+  // 3: CONV_2D 48x48x8 -> 48x48x48, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node3>(
+      specialized_op_data(3), (const int8_t*)(tensor_address(46)), (const int8_t*)(g0::tensor_data37),
+      (const int32_t*)g0::tensor_data36, (int8_t*)(tensor_address(47)));
+
+  // 4: PAD
+  ResetTensors();
+  status = registrations[OP_PAD].invoke(&ctx, &tflNodes[4]);
+  if (status != kTfLiteOk) return status;
+
+  // 5: DEPTHWISE_CONV_2D 49x49x48 -> 24x24x48, 3x3 stride 2
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node5>(
+      specialized_op_data(5), (const int8_t*)(tensor_address(48)), (const int8_t*)(g0::tensor_data35),
+      (const int32_t*)g0::tensor_data34, (int8_t*)(tensor_address(49)));
+
+  // 6: CONV_2D 24x24x48 -> 24x24x8, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node6>(
+      specialized_op_data(6), (const int8_t*)(tensor_address(49)), (const int8_t*)(g0::tensor_data33),
+      (const int32_t*)g0::tensor_data32, (int8_t*)(tensor_address(50)));
+
+  // 7: CONV_2D 24x24x8 -> 24x24x48, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node7>(
+      specialized_op_data(7), (const int8_t*)(tensor_address(50)), (const int8_t*)(g0::tensor_data31),
+      (const int32_t*)g0::tensor_data30, (int8_t*)(tensor_address(51)));
+
+  // 8: DEPTHWISE_CONV_2D 24x24x48 -> 24x24x48, 3x3 stride 1
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node8>(
+      specialized_op_data(8), (const int8_t*)(tensor_address(51)), (const int8_t*)(g0::tensor_data29),
+      (const int32_t*)g0::tensor_data28, (int8_t*)(tensor_address(52)));
+
+  // 9: CONV_2D 24x24x48 -> 24x24x8, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node9>(
+      specialized_op_data(9), (const int8_t*)(tensor_address(52)), (const int8_t*)(g0::tensor_data27),
+      (const int32_t*)g0::tensor_data26, (int8_t*)(tensor_address(53)));
+
+  // 10: ADD
+  ResetTensors();
+  status = registrations[OP_ADD].invoke(&ctx, &tflNodes[10]);
+  if (status != kTfLiteOk) return status;
+
+  // 11: CONV_2D 24x24x8 -> 24x24x48, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node11>(
+      specialized_op_data(11), (const int8_t*)(tensor_address(54)), (const int8_t*)(g0::tensor_data25),
+      (const int32_t*)g0::tensor_data24, (int8_t*)(tensor_address(55)));
+
+  // 12: PAD
+  ResetTensors();
+  status = registrations[OP_PAD].invoke(&ctx, &tflNodes[12]);
+  if (status != kTfLiteOk) return status;
+
+  // 13: DEPTHWISE_CONV_2D 25x25x48 -> 12x12x48, 3x3 stride 2
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node13>(
+      specialized_op_data(13), (const int8_t*)(tensor_address(56)), (const int8_t*)(g0::tensor_data23),
+      (const int32_t*)g0::tensor_data22, (int8_t*)(tensor_address(57)));
+
+  // 14: CONV_2D 12x12x48 -> 12x12x16, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node14>(
+      specialized_op_data(14), (const int8_t*)(tensor_address(57)), (const int8_t*)(g0::tensor_data21),
+      (const int32_t*)g0::tensor_data20, (int8_t*)(tensor_address(58)));
+
+  // 15: CONV_2D 12x12x16 -> 12x12x96, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node15>(
+      specialized_op_data(15), (const int8_t*)(tensor_address(58)), (const int8_t*)(g0::tensor_data19),
+      (const int32_t*)g0::tensor_data18, (int8_t*)(tensor_address(59)));
+
+  // 16: DEPTHWISE_CONV_2D 12x12x96 -> 12x12x96, 3x3 stride 1
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node16>(
+      specialized_op_data(16), (const int8_t*)(tensor_address(59)), (const int8_t*)(g0::tensor_data17),
+      (const int32_t*)g0::tensor_data16, (int8_t*)(tensor_address(60)));
+
+  // 17: CONV_2D 12x12x96 -> 12x12x16, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node17>(
+      specialized_op_data(17), (const int8_t*)(tensor_address(60)), (const int8_t*)(g0::tensor_data15),
+      (const int32_t*)g0::tensor_data14, (int8_t*)(tensor_address(61)));
+
+  // 18: ADD
+  ResetTensors();
+  status = registrations[OP_ADD].invoke(&ctx, &tflNodes[18]);
+  if (status != kTfLiteOk) return status;
+
+  // 19: CONV_2D 12x12x16 -> 12x12x96, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node19>(
+      specialized_op_data(19), (const int8_t*)(tensor_address(62)), (const int8_t*)(g0::tensor_data13),
+      (const int32_t*)g0::tensor_data12, (int8_t*)(tensor_address(63)));
+
+  // 20: DEPTHWISE_CONV_2D 12x12x96 -> 12x12x96, 3x3 stride 1
+  tflite::fixed_shape::DepthwiseConv<eon_shapes::Node20>(
+      specialized_op_data(20), (const int8_t*)(tensor_address(63)), (const int8_t*)(g0::tensor_data11),
+      (const int32_t*)g0::tensor_data10, (int8_t*)(tensor_address(64)));
+
+  // 21: CONV_2D 12x12x96 -> 12x12x16, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node21>(
+      specialized_op_data(21), (const int8_t*)(tensor_address(64)), (const int8_t*)(g0::tensor_data9),
+      (const int32_t*)g0::tensor_data8, (int8_t*)(tensor_address(65)));
+
+  // 22: ADD
+  ResetTensors();
+  status = registrations[OP_ADD].invoke(&ctx, &tflNodes[22]);
+  if (status != kTfLiteOk) return status;
+
+  // 23: CONV_2D 12x12x16 -> 12x12x96, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node23>(
+      specialized_op_data(23), (const int8_t*)(tensor_address(66)), (const int8_t*)(g0::tensor_data7),
+      (const int32_t*)g0::tensor_data6, (int8_t*)(tensor_address(67)));
+
+  // 24: CONV_2D 12x12x96 -> 12x12x32, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node24>(
+      specialized_op_data(24), (const int8_t*)(tensor_address(67)), (const int8_t*)(g0::tensor_data5),
+      (const int32_t*)g0::tensor_data4, (int8_t*)(tensor_address(68)));
+
+  // 25: CONV_2D 12x12x32 -> 12x12x3, 1x1 stride 1
+  tflite::fixed_shape::Conv<eon_shapes::Node25>(
+      specialized_op_data(25), (const int8_t*)(tensor_address(68)), (const int8_t*)(g0::tensor_data3),
+      (const int32_t*)g0::tensor_data2, (int8_t*)(tensor_address(69)));
+
+  // 26: SOFTMAX
+  ResetTensors();
+  status = registrations[OP_SOFTMAX].invoke(&ctx, &tflNodes[26]);
+  if (status != kTfLiteOk) return status;
+  return kTfLiteOk;
+}
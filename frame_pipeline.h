@@ -0,0 +1,157 @@
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+// Two-task frame pipeline: a capture task fills pool slots with preprocessed
+// frames and hands them through a lock-free SPSC ring to a processing task on
+// the other core, so capture/decode of frame N+1 overlaps inference of frame N.
+//
+// Slot ownership: capture task acquires a slot from the FramePool, the
+// processing task releases it once done. When the consumer falls behind it
+// skips to the newest queued frame and returns the stale ones to the pool.
+
+#include <atomic>
+#include "frame_pool.h"
+#include "frame_scheduler.h"
+#include "spsc_ring.h"
+#include "sorter_hal.h"
+
+#define FRAME_PIPELINE_DEPTH 4   // ring entries, >= pool slots
+
+struct PipelineFrame {
+    int slot = -1;
+    uint32_t seq = 0;
+    uint32_t t_capture_us = 0;   // hal_micros() when the frame was ready
+    uint32_t capture_us = 0;     // time spent in the capture callback
+    uint32_t grab_us = 0;        // part of capture_us waiting for the camera (set by the callback)
+};
+
+// Fill `frame` (one pool slot) with the next preprocessed frame; may set f.grab_us.
+typedef bool (*pipeline_capture_fn)(uint8_t *frame, PipelineFrame &f, void *ctx);
+// Consume a frame and fill in the stage times it measured (dsp, classification,
+// post, actuate). The slot is returned to the pool after this returns.
+typedef void (*pipeline_process_fn)(uint8_t *frame, const PipelineFrame &f, FrameTiming &t, void *ctx);
+
+class FramePipeline {
+public:
+    struct Config {
+        int capture_core = 0;
+        int process_core = 1;
+        int capture_prio = 1;
+        int process_prio = 1;
+        uint32_t capture_stack = 8 * 1024;
+        uint32_t process_stack = 16 * 1024;
+    };
+
+    // `sched` paces capture and drops late frames; nullptr runs free.
+    bool start(FramePool *pool, pipeline_capture_fn capture, pipeline_process_fn process,
+               void *ctx, FrameScheduler *sched, const Config &cfg) {
+        if (!pool || !capture || !process || pool->slots() > FRAME_PIPELINE_DEPTH) return false;
+        pool_ = pool;
+        sched_ = sched;
+        capture_ = capture;
+        process_ = process;
+        ctx_ = ctx;
+        return hal_task_start(&FramePipeline::capture_task, this, "capture",
+                              cfg.capture_stack, cfg.capture_prio, cfg.capture_core)
+            && hal_task_start(&FramePipeline::process_task, this, "process",
+                              cfg.process_stack, cfg.process_prio, cfg.process_core);
+    }
+
+    void set_paused(bool paused) { paused_.store(paused); }
+    bool paused() const { return paused_.load(); }
+
+    uint32_t captured() const { return captured_.load(); }
+    uint32_t processed() const { return processed_.load(); }
+    uint32_t skipped() const { return skipped_.load(); }
+    uint32_t capture_errors() const { return capture_errors_.load(); }
+
+private:
+    static void capture_task(void *arg) { static_cast<FramePipeline *>(arg)->capture_loop(); }
+    static void process_task(void *arg) { static_cast<FramePipeline *>(arg)->process_loop(); }
+
+    void capture_loop() {
+        uint32_t last_start = hal_micros();
+        uint32_t seq = 0;
+        for (;;) {
+            if (paused_.load()) { hal_delay_ms(50); continue; }
+
+            uint32_t wait_us = sched_ ? sched_->capture_delay_us(hal_micros() - last_start) : 0;
+            if (wait_us) { hal_delay_ms((wait_us + 999u) / 1000u); continue; }
+
+            int slot = pool_->acquire();
+            if (slot < 0) { slot_freed_.take(100); continue; }
+
+            PipelineFrame f;
+            last_start = hal_micros();
+            if (!capture_(pool_->data(slot), f, ctx_)) {
+                pool_->release(slot);
+                capture_errors_.fetch_add(1);
+                hal_delay_ms(10);
+                continue;
+            }
+
+            f.slot = slot;
+            f.seq = seq++;
+            f.t_capture_us = hal_micros();
+            f.capture_us = f.t_capture_us - last_start;
+            if (!ring_.push(f)) { pool_->release(slot); skipped_.fetch_add(1); continue; }
+            captured_.fetch_add(1);
+            frame_ready_.give();
+        }
+    }
+
+    void process_loop() {
+        for (;;) {
+            PipelineFrame f;
+            if (!ring_.pop(f)) { frame_ready_.take(100); continue; }
+
+            // only the newest frame matters for sorting, recycle older ones
+            PipelineFrame newer;
+            while (ring_.pop(newer)) {
+                pool_->release(f.slot);
+                skipped_.fetch_add(1);
+                slot_freed_.give();
+                f = newer;
+            }
+
+            if (sched_ && sched_->is_stale(f.t_capture_us, hal_micros())) {
+                pool_->release(f.slot);
+                sched_->record_stale();
+                skipped_.fetch_add(1);
+                slot_freed_.give();
+                continue;
+            }
+
+            FrameTiming t;
+            t.capture_us = f.capture_us;
+            uint32_t t0 = hal_micros();
+            process_(pool_->data(f.slot), f, t, ctx_);
+            uint32_t t1 = hal_micros();
+            pool_->release(f.slot);
+            processed_.fetch_add(1);
+            slot_freed_.give();
+
+            t.process_us = t1 - t0;
+            t.latency_us = t1 - f.t_capture_us;
+            if (sched_) sched_->record(t);
+        }
+    }
+
+    FramePool *pool_ = nullptr;
+    pipeline_capture_fn capture_ = nullptr;
+    pipeline_process_fn process_ = nullptr;
+    void *ctx_ = nullptr;
+    FrameScheduler *sched_ = nullptr;
+
+    SpscRing<PipelineFrame, FRAME_PIPELINE_DEPTH> ring_;
+    HalSignal frame_ready_;     // capture -> process
+    HalSignal slot_freed_;      // process -> capture
+
+    std::atomic<bool> paused_{false};
+    std::atomic<uint32_t> captured_{0};
+    std::atomic<uint32_t> processed_{0};
+    std::atomic<uint32_t> skipped_{0};
+    std::atomic<uint32_t> capture_errors_{0};
+};
+
+#endif // FRAME_PIPELINE_H
@@ -0,0 +1,67 @@
+#ifndef FRAME_POOL_H
+#define FRAME_POOL_H
+
+// Fixed set of equally sized frame buffers, allocated once in setup() and
+// recycled for the lifetime of the firmware. Keeps malloc/free (and the heap
+// fragmentation they cause with 230 KB blocks) out of the per-frame path.
+//
+// acquire()/release() are lock-free, so a slot may be acquired by one task and
+// released by another.
+
+#include <atomic>
+#include "sorter_hal.h"
+
+#define FRAME_POOL_MAX_SLOTS 8
+
+class FramePool {
+public:
+    // Allocate `slots` buffers of `slot_bytes` each. All-or-nothing.
+    bool init(size_t slot_bytes, int slots) {
+        if (slots < 1 || slots > FRAME_POOL_MAX_SLOTS) return false;
+        for (int i = 0; i < slots; i++) {
+            buf_[i] = hal_alloc_frame(slot_bytes);
+            if (!buf_[i]) { deinit(); return false; }
+        }
+        slot_bytes_ = slot_bytes;
+        slots_ = slots;
+        free_mask_.store((1u << slots) - 1u);
+        return true;
+    }
+
+    void deinit() {
+        for (int i = 0; i < FRAME_POOL_MAX_SLOTS; i++) {
+            if (buf_[i]) hal_free_frame(buf_[i]);
+            buf_[i] = nullptr;
+        }
+        slots_ = 0;
+        free_mask_.store(0);
+    }
+
+    // Returns a free slot index, or -1 when every slot is in use.
+    int acquire() {
+        uint32_t mask = free_mask_.load();
+        while (mask) {
+            int ix = __builtin_ctz(mask);
+            if (free_mask_.compare_exchange_weak(mask, mask & ~(1u << ix))) return ix;
+        }
+        return -1;
+    }
+
+    void release(int ix) {
+        if (ix < 0 || ix >= slots_) return;
+        free_mask_.fetch_or(1u << ix);
+    }
+
+    uint8_t *data(int ix) const { return (ix >= 0 && ix < slots_) ? buf_[ix] : nullptr; }
+    size_t slot_bytes() const { return slot_bytes_; }
+    int slots() const { return slots_; }
+    int available() const { return __builtin_popcount(free_mask_.load()); }
+
+private:
+    uint8_t *buf_[FRAME_POOL_MAX_SLOTS] = {nullptr};
+    size_t slot_bytes_ = 0;
+    int slots_ = 0;
+    std::atomic<uint32_t> free_mask_{0};
+};
+
+#endif // FRAME_POOL_H
@@ -0,0 +1,133 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+// Deadline-driven pacing for the capture/classify pipeline, replacing the
+// fixed delay(detection_delay) after every frame.
+//
+//  - target period: desired time between frames (0 = as fast as possible)
+//  - deadline:      max age of a frame (capture -> servo written); 0 = none
+//
+// Stage times are tracked as moving averages. The capture rate is never
+// pushed above what the slowest stage can sustain, queued frames that could no
+// longer make the deadline are dropped, and the period backs off while the
+// measured latency is over budget (AIMD). A deadline the classify step alone
+// cannot meet neither stops classification (every kMaxStaleRun-th frame is
+// processed anyway, which also refreshes the estimate) nor backs off.
+
+#include <atomic>
+#include <stdint.h>
+#include "moving_average.h"
+
+// Per-frame measurements, microseconds. dsp/classification come from
+// ei_impulse_result_t::timing, post is the rest of run_classifier().
+struct FrameTiming {
+    uint32_t capture_us = 0;     // grab + decode + resize
+    uint32_t dsp_us = 0;
+    uint32_t classification_us = 0;
+    uint32_t post_us = 0;
+    uint32_t actuate_us = 0;
+    uint32_t process_us = 0;     // whole classify callback
+    uint32_t latency_us = 0;     // capture done -> classify done
+};
+
+class FrameScheduler {
+public:
+    void configure(uint32_t period_ms, uint32_t deadline_ms) {
+        target_period_us_.store(period_ms * 1000u);
+        deadline_us_.store(deadline_ms * 1000u);
+        period_us_.store(period_ms * 1000u);
+        // estimates start over with the new settings
+        est_capture_us_.store(0);
+        est_dsp_us_.store(0);
+        est_classification_us_.store(0);
+        est_post_us_.store(0);
+        est_actuate_us_.store(0);
+        est_process_us_.store(0);
+        est_latency_us_.store(0);
+        stale_run_.store(0);
+    }
+
+    // Capture side: how long to wait before starting the next capture.
+    uint32_t capture_delay_us(uint32_t since_last_capture_us) const {
+        uint32_t period = period_us_.load();
+        return since_last_capture_us < period ? period - since_last_capture_us : 0;
+    }
+
+    // Classify side: true when the frame can no longer be acted on in time.
+    // Without an estimate yet, or after kMaxStaleRun drops in a row, the
+    // frame is processed regardless.
+    bool is_stale(uint32_t t_capture_us, uint32_t now_us) const {
+        uint32_t deadline = deadline_us_.load();
+        uint32_t process = est_process_us_.load();
+        if (!deadline || !process || stale_run_.load() >= kMaxStaleRun) return false;
+        return (now_us - t_capture_us) + process > deadline;
+    }
+
+    void record_stale() {
+        stale_.fetch_add(1);
+        stale_run_.fetch_add(1);
+    }
+
+    // Classify side, after each processed frame.
+    void record(const FrameTiming &t) {
+        uint32_t capture = ewma(est_capture_us_.load(), t.capture_us);
+        uint32_t process = ewma(est_process_us_.load(), t.process_us);
+        uint32_t latency = ewma(est_latency_us_.load(), t.latency_us);
+        est_capture_us_.store(capture);
+        est_dsp_us_.store(ewma(est_dsp_us_.load(), t.dsp_us));
+        est_classification_us_.store(ewma(est_classification_us_.load(), t.classification_us));
+        est_post_us_.store(ewma(est_post_us_.load(), t.post_us));
+        est_actuate_us_.store(ewma(est_actuate_us_.load(), t.actuate_us));
+        est_process_us_.store(process);
+        est_latency_us_.store(latency);
+        stale_run_.store(0);
+
+        // the pipeline cannot run faster than its slowest stage
+        uint32_t floor = capture > process ? capture : process;
+        uint32_t target = target_period_us_.load();
+        if (target < floor) target = floor;
+
+        uint32_t period = period_us_.load();
+        uint32_t deadline = deadline_us_.load();
+        if (deadline && t.latency_us > deadline && process < deadline) {
+            period += period / 8 + 1000u;             // over budget: back off
+        } else if (period > target) {
+            period -= (period - target) / 4 + 1;      // converge back to the target
+        }
+        if (period < target) period = target;
+        if (period > kMaxPeriodUs) period = kMaxPeriodUs;
+        period_us_.store(period);
+        frames_.fetch_add(1);
+    }
+
+    uint32_t period_us() const { return period_us_.load(); }
+    uint32_t est_capture_us() const { return est_capture_us_.load(); }
+    uint32_t est_dsp_us() const { return est_dsp_us_.load(); }
+    uint32_t est_classification_us() const { return est_classification_us_.load(); }
+    uint32_t est_post_us() const { return est_post_us_.load(); }
+    uint32_t est_actuate_us() const { return est_actuate_us_.load(); }
+    uint32_t est_process_us() const { return est_process_us_.load(); }
+    uint32_t est_latency_us() const { return est_latency_us_.load(); }
+    uint32_t frames() const { return frames_.load(); }
+    uint32_t stale() const { return stale_.load(); }
+
+private:
+    static const uint32_t kMaxPeriodUs = 5000000u;
+    static const uint32_t kMaxStaleRun = 8;
+
+    std::atomic<uint32_t> target_period_us_{0};
+    std::atomic<uint32_t> deadline_us_{0};
+    std::atomic<uint32_t> period_us_{0};
+    std::atomic<uint32_t> est_capture_us_{0};
+    std::atomic<uint32_t> est_dsp_us_{0};
+    std::atomic<uint32_t> est_classification_us_{0};
+    std::atomic<uint32_t> est_post_us_{0};
+    std::atomic<uint32_t> est_actuate_us_{0};
+    std::atomic<uint32_t> est_process_us_{0};
+    std::atomic<uint32_t> est_latency_us_{0};
+    std::atomic<uint32_t> frames_{0};
+    std::atomic<uint32_t> stale_{0};
+    std::atomic<uint32_t> stale_run_{0};   // frames dropped since the last processed one
+};
+
+#endif // FRAME_SCHEDULER_H
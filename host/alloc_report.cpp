@@ -0,0 +1,166 @@
+// Reads an allocation profile (/allocs of a firmware built with
+// EIDSP_TRACK_ALLOCATIONS=1, or esp32cam_sim --allocs) and prints one row per
+// call site: allocations per run, bytes per run, largest block, what is still
+// live, how many came out of the inference region, the stage that allocated
+// and the lifetime histogram. Sites that allocate on every run are the hot
+// path and are marked with '*'.
+//
+//   curl -o allocs.json http://<esp32-ip>/allocs
+//   g++ -std=c++17 -O2 alloc_report.cpp -o alloc_report
+//   ./alloc_report allocs.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+// Just enough JSON for the profile: objects, arrays, strings, numbers
+struct Json {
+    enum Type { NUL, NUM, STR, ARR, OBJ } type = NUL;
+    double num = 0;
+    std::string str;
+    std::vector<Json> arr;
+    std::map<std::string, Json> obj;
+
+    const Json &operator[](const char *key) const {
+        static const Json none;
+        auto it = obj.find(key);
+        return it == obj.end() ? none : it->second;
+    }
+    double n(size_t i) const { return i < arr.size() ? arr[i].num : 0; }
+};
+
+static void skip_ws(const char *&p) {
+    while (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t') p++;
+}
+
+static bool parse(const char *&p, Json &out) {
+    skip_ws(p);
+    if (*p == '{' || *p == '[') {
+        bool obj = *p++ == '{';
+        out.type = obj ? Json::OBJ : Json::ARR;
+        skip_ws(p);
+        if (*p == (obj ? '}' : ']')) { p++; return true; }
+        for (;;) {
+            std::string key;
+            if (obj) {
+                Json k;
+                if (!parse(p, k) || k.type != Json::STR) return false;
+                key = k.str;
+                skip_ws(p);
+                if (*p++ != ':') return false;
+            }
+            Json v;
+            if (!parse(p, v)) return false;
+            if (obj) out.obj[key] = v;
+            else out.arr.push_back(v);
+            skip_ws(p);
+            if (*p == ',') { p++; continue; }
+            return *p++ == (obj ? '}' : ']');
+        }
+    }
+    if (*p == '"') {
+        out.type = Json::STR;
+        for (p++; *p && *p != '"'; p++) {
+            if (*p == '\\' && p[1]) p++;
+            out.str += *p;
+        }
+        return *p++ == '"';
+    }
+    if (!strncmp(p, "null", 4)) { p += 4; return true; }
+    char *end;
+    out.num = strtod(p, &end);
+    if (end == p) return false;
+    out.type = Json::NUM;
+    p = end;
+    return true;
+}
+
+struct Site {
+    std::string name;
+    double count, bytes, max_bytes, live, live_bytes, in_region;
+    int stage;                      // the stage with the most allocations
+    std::vector<double> lifetime;
+};
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s allocs.json\n", argv[0]);
+        return 1;
+    }
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 1; }
+    std::string text;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) text.append(chunk, n);
+    fclose(f);
+
+    Json doc;
+    const char *p = text.c_str();
+    if (!parse(p, doc) || doc.type != Json::OBJ || doc["sites"].type != Json::ARR) {
+        fprintf(stderr, "%s: not an allocation profile\n", argv[1]);
+        return 1;
+    }
+
+    const Json &stages = doc["stages"];
+    double runs = doc["runs"].num;
+    double per = runs > 0 ? runs : 1;
+    printf("%.0f runs, peak %.0f bytes in %.0f blocks, %.0f bytes in %.0f blocks still live, %.0f unmatched frees\n",
+           runs, doc["peak"].num, doc["peak_live"].num, doc["in_use"].num, doc["live"].num,
+           doc["unmatched_frees"].num);
+    printf("peak by stage:");
+    for (size_t i = 0; i < stages.arr.size(); i++) {
+        printf(" %s %.0f", stages.arr[i].str.c_str(), doc["stage_peak"].n(i));
+    }
+    printf("\n\n");
+
+    std::vector<Site> sites;
+    for (const Json &s : doc["sites"].arr) {
+        Site site;
+        std::string file = s["file"].str;
+        size_t slash = file.find_last_of('/');
+        site.name = s["fn"].str + " " + file.substr(slash == std::string::npos ? 0 : slash + 1) + ":"
+                  + std::to_string((long)s["line"].num);
+        if (s["caller"].str != "0x0") site.name += " from " + s["caller"].str;
+        site.count = s["count"].num;
+        site.bytes = s["bytes"].num;
+        site.max_bytes = s["max_bytes"].num;
+        site.live = s["live"].num;
+        site.live_bytes = s["live_bytes"].num;
+        site.in_region = s["in_region"].num;
+        site.stage = 0;
+        for (size_t i = 1; i < s["stages"].arr.size(); i++) {
+            if (s["stages"].n(i) > s["stages"].n(site.stage)) site.stage = (int)i;
+        }
+        for (size_t i = 0; i < s["lifetime"].arr.size(); i++) site.lifetime.push_back(s["lifetime"].n(i));
+        sites.push_back(site);
+    }
+    std::sort(sites.begin(), sites.end(), [](const Site &a, const Site &b) {
+        return a.count != b.count ? a.count > b.count : a.bytes > b.bytes;
+    });
+
+    printf("  %8s %10s %8s %6s %7s %-5s %-35s site\n", "per run", "bytes/run", "max", "live", "region", "stage",
+           "lifetime <10us <100us <1ms <10ms <100ms >=");
+    double hot_count = 0, hot_bytes = 0;
+    int hot_sites = 0;
+    for (const Site &s : sites) {
+        bool hot = runs > 0 && s.count >= runs;
+        if (hot) {
+            hot_sites++;
+            hot_count += s.count / per;
+            hot_bytes += s.bytes / per;
+        }
+        std::string hist;
+        for (double v : s.lifetime) hist += (hist.empty() ? "" : " ") + std::to_string((long)v);
+        const char *stage = s.stage < (int)stages.arr.size() ? stages.arr[s.stage].str.c_str() : "?";
+        printf("%c %8.2f %10.0f %8.0f %6.0f %7.0f %-5s %-35s %s\n", hot ? '*' : ' ', s.count / per, s.bytes / per,
+               s.max_bytes, s.live, s.in_region, stage, hist.c_str(), s.name.c_str());
+    }
+    printf("\n%d site(s) allocate on every run: %.1f allocations, %.0f bytes per run\n", hot_sites, hot_count,
+           hot_bytes);
+    return 0;
+}
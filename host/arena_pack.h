@@ -0,0 +1,374 @@
+// Arena packing for EON-compiled models, shared by arena_plan and tier_plan.
+//
+// A tensor lives from the node that writes it (0 for graph inputs) to the
+// last node that reads it (the end for graph outputs); tensors whose
+// lifetimes meet must not overlap. On top of that, an operator may write its
+// output over an input that dies at that node:
+//   ADD  elementwise, same shape: output at the input's offset
+//   PAD  the kernel walks output and input forward, so the input can sit
+//        inside the output as long as no write lands on an unread input
+//        byte; checked element by element against the paddings
+// Tensors tied this way form blocks with fixed relative offsets, and only
+// when both sit in the same arena. Search starts from a few greedy first-fit
+// orders, then runs a branch and bound over placement orders (each block
+// rests on the floor or on a tensor it conflicts with) until it meets the
+// lower bound (the most bytes live at any node) or the time budget runs out.
+
+#ifndef ARENA_PACK_H
+#define ARENA_PACK_H
+
+#include <chrono>
+#include <set>
+#include <algorithm>
+#include "eon_source.h"
+
+#define ARENA_ALIGN 16
+
+static inline int align_up(int x) { return (x + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1); }
+
+struct Buf {
+    int tensor;
+    int first, last;    // node range, inclusive
+    int bytes;
+    int block, rel;     // block and offset inside it
+};
+
+struct Block {
+    std::vector<int> members;
+    int span = 0;       // max rel + bytes
+};
+
+struct Planner {
+    std::vector<Buf> bufs;
+    std::vector<Block> blocks;
+    std::set<std::pair<int, int>> alias;    // buf pairs an operator runs in place on
+    std::vector<std::vector<bool>> conflict;
+    std::vector<int> buf_of;                // per tensor, -1 when not in this arena
+    int nodes = 0;
+
+    bool conflicts(int a, int b) const {
+        if (bufs[a].last < bufs[b].first || bufs[b].last < bufs[a].first) return false;
+        return !alias.count(std::make_pair(std::min(a, b), std::max(a, b)));
+    }
+
+    void build_conflicts() {
+        conflict.assign(bufs.size(), std::vector<bool>(bufs.size(), false));
+        for (size_t a = 0; a < bufs.size(); a++)
+            for (size_t b = 0; b < bufs.size(); b++)
+                conflict[a][b] = a != b && bufs[a].block != bufs[b].block && conflicts((int)a, (int)b);
+    }
+
+    // Ties buf `b` to `a` at a's offset + `delta`; undone if two members of
+    // the merged block would then collide
+    bool tie(int a, int b, int delta) {
+        int ba = bufs[a].block, bb = bufs[b].block;
+        if (ba == bb) return false;
+        int shift = bufs[a].rel + delta - bufs[b].rel;
+        std::vector<Buf> saved = bufs;
+        alias.insert(std::make_pair(std::min(a, b), std::max(a, b)));
+        for (int m : blocks[bb].members) {
+            bufs[m].block = ba;
+            bufs[m].rel += shift;
+        }
+        std::vector<int> members = blocks[ba].members;
+        members.insert(members.end(), blocks[bb].members.begin(), blocks[bb].members.end());
+        bool ok = true;
+        for (size_t i = 0; i < members.size() && ok; i++) {
+            for (size_t j = i + 1; j < members.size() && ok; j++) {
+                const Buf &x = bufs[members[i]], &y = bufs[members[j]];
+                ok = !conflicts(members[i], members[j])
+                  || x.rel + x.bytes <= y.rel || y.rel + y.bytes <= x.rel;
+            }
+        }
+        if (!ok) {
+            bufs = saved;
+            alias.erase(std::make_pair(std::min(a, b), std::max(a, b)));
+            return false;
+        }
+        int lo = 0;
+        for (int m : members) lo = std::min(lo, bufs[m].rel);
+        Block &blk = blocks[ba];
+        blk.members = members;
+        blk.span = 0;
+        for (int m : members) {
+            bufs[m].rel -= lo;
+            blk.span = std::max(blk.span, bufs[m].rel + bufs[m].bytes);
+        }
+        blocks[bb].members.clear();
+        blocks[bb].span = 0;
+        return true;
+    }
+
+    // most bytes live at any node, blocks counted by the span of their live members
+    int lower_bound() const {
+        int best = 0;
+        for (int s = 0; s < nodes; s++) {
+            int live = 0;
+            for (const Block &blk : blocks) {
+                int lo = -1, hi = 0;
+                for (int m : blk.members) {
+                    const Buf &b = bufs[m];
+                    if (b.first > s || b.last < s) continue;
+                    lo = lo < 0 ? b.rel : std::min(lo, b.rel);
+                    hi = std::max(hi, b.rel + b.bytes);
+                }
+                if (lo >= 0) live += hi - lo;
+            }
+            best = std::max(best, live);
+        }
+        return best;
+    }
+};
+
+struct Search {
+    const Planner &p;
+    std::vector<int> order;         // live blocks, largest first
+    std::vector<int> offset;        // per buf, -1 unplaced
+    std::vector<int> placed;        // bufs placed so far
+    std::vector<int> best_offset;
+    int best = 0, bound = 0;
+    long visited = 0;
+    bool timed_out = false;
+    std::chrono::steady_clock::time_point deadline;
+
+    explicit Search(const Planner &planner) : p(planner), offset(planner.bufs.size(), -1) {
+        for (size_t b = 0; b < p.blocks.size(); b++)
+            if (!p.blocks[b].members.empty()) order.push_back((int)b);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return p.blocks[a].span > p.blocks[b].span; });
+    }
+
+    bool fits(int blk, int base) const {
+        for (int m : p.blocks[blk].members) {
+            int lo = base + p.bufs[m].rel, hi = lo + p.bufs[m].bytes;
+            for (int t : placed) {
+                if (!p.conflict[m][t]) continue;
+                if (lo < offset[t] + p.bufs[t].bytes && offset[t] < hi) return false;
+            }
+        }
+        return true;
+    }
+
+    // floor, or one member right on top of a tensor it conflicts with
+    std::vector<int> candidates(int blk) const {
+        std::vector<int> c(1, 0);
+        for (int m : p.blocks[blk].members) {
+            for (int t : placed) {
+                if (!p.conflict[m][t]) continue;
+                int base = align_up(offset[t] + p.bufs[t].bytes) - p.bufs[m].rel;
+                if (base >= 0) c.push_back(base);
+            }
+        }
+        std::sort(c.begin(), c.end());
+        c.erase(std::unique(c.begin(), c.end()), c.end());
+        return c;
+    }
+
+    void place(int blk, int base) {
+        for (int m : p.blocks[blk].members) {
+            offset[m] = base + p.bufs[m].rel;
+            placed.push_back(m);
+        }
+    }
+
+    void unplace(int blk) {
+        for (size_t i = 0; i < p.blocks[blk].members.size(); i++) {
+            offset[placed.back()] = -1;
+            placed.pop_back();
+        }
+    }
+
+    int height() const {
+        int h = 0;
+        for (int t : placed) h = std::max(h, offset[t] + p.bufs[t].bytes);
+        return h;
+    }
+
+    void keep_if_better() {
+        int h = height();
+        if (best_offset.empty() || h < best) {
+            best = h;
+            best_offset = offset;
+        }
+    }
+
+    // first fit: each block at its lowest feasible offset, in `seq` order
+    void first_fit(const std::vector<int> &seq) {
+        for (int blk : seq) {
+            for (int base : candidates(blk)) {
+                if (fits(blk, base)) { place(blk, base); break; }
+            }
+        }
+        keep_if_better();
+        for (size_t i = seq.size(); i-- > 0;) unplace(seq[i]);
+    }
+
+    void branch(std::vector<bool> &done, size_t depth, int h) {
+        if (best <= bound || timed_out) return;
+        if ((++visited & 1023) == 0 && std::chrono::steady_clock::now() > deadline) { timed_out = true; return; }
+        if (depth == order.size()) { keep_if_better(); return; }
+        for (int blk : order) {
+            if (done[blk]) continue;
+            done[blk] = true;
+            for (int base : candidates(blk)) {
+                int nh = std::max(h, base + p.blocks[blk].span);
+                if (std::max(nh, bound) >= best) break;     // candidates ascend
+                if (!fits(blk, base)) continue;
+                place(blk, base);
+                branch(done, depth + 1, nh);
+                unplace(blk);
+                if (best <= bound || timed_out) break;
+            }
+            done[blk] = false;
+            if (best <= bound || timed_out) return;
+        }
+    }
+
+    // greedy incumbents: by size, by first use, by size x lifetime
+    void greedy() {
+        bound = p.lower_bound();
+        std::vector<int> seq = order;
+        first_fit(seq);
+        std::stable_sort(seq.begin(), seq.end(), [&](int a, int b) {
+            return p.bufs[p.blocks[a].members[0]].first < p.bufs[p.blocks[b].members[0]].first;
+        });
+        first_fit(seq);
+        auto area = [&](int blk) {
+            long s = 0;
+            for (int m : p.blocks[blk].members) s += (long)p.bufs[m].bytes * (p.bufs[m].last - p.bufs[m].first + 1);
+            return s;
+        };
+        std::stable_sort(seq.begin(), seq.end(), [&](int a, int b) { return area(a) > area(b); });
+        first_fit(seq);
+    }
+
+    void run(int budget_ms) {
+        greedy();
+        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget_ms);
+        std::vector<bool> done(p.blocks.size(), false);
+        branch(done, 0, 0);
+    }
+};
+
+// PadImpl order: output elements front to back, each either the pad value or
+// the next input element. With the input `delta` bytes into the output, a
+// write must stay below the first input byte not read yet.
+static inline bool pad_in_place_ok(const std::vector<int> &in_dims, const std::vector<int> &paddings,
+                                   int elem_bytes, long delta) {
+    size_t rank = in_dims.size();
+    if (paddings.size() != rank * 2 || rank == 0) return false;
+    std::vector<int> out_dims(rank), idx(rank, 0);
+    long n_in = 1, n_out = 1;
+    for (size_t d = 0; d < rank; d++) {
+        out_dims[d] = in_dims[d] + paddings[2 * d] + paddings[2 * d + 1];
+        n_in *= in_dims[d];
+        n_out *= out_dims[d];
+    }
+    long q = 0;
+    for (long p = 0; p < n_out; p++) {
+        bool inside = true;
+        for (size_t d = 0; d < rank; d++) {
+            inside = inside && idx[d] >= paddings[2 * d] && idx[d] < paddings[2 * d] + in_dims[d];
+        }
+        if (inside) q++;
+        if (q < n_in && (p + 1) * elem_bytes > delta + q * elem_bytes) return false;
+        for (size_t d = rank; d-- > 0;) {
+            if (++idx[d] < out_dims[d]) break;
+            idx[d] = 0;
+        }
+    }
+    return q == n_in;
+}
+
+// The tensors `member` selects, each with its lifetime, and with `in_place`
+// the ADD / PAD ties between two of them; `verbose` prints the ties.
+static inline Planner arena_planner(const EonModel &model, const std::vector<bool> &member, bool in_place,
+                                    bool verbose) {
+    Planner p;
+    p.nodes = (int)model.nodes.size();
+    p.buf_of.assign(model.tensors.size(), -1);
+    for (size_t t = 0; t < model.tensors.size(); t++) {
+        if (!member[t]) continue;
+        p.buf_of[t] = (int)p.bufs.size();
+        p.bufs.push_back(Buf{(int)t, -1, -1, model.tensors[t].bytes, (int)p.blocks.size(), 0});
+        p.blocks.push_back(Block());
+        p.blocks.back().members.push_back(p.buf_of[t]);
+        p.blocks.back().span = model.tensors[t].bytes;
+    }
+    const std::vector<int> &buf_of = p.buf_of;
+    for (int t : model.inputs) if (buf_of[t] >= 0) p.bufs[buf_of[t]].first = 0;
+    for (int t : model.outputs) if (buf_of[t] >= 0) p.bufs[buf_of[t]].last = p.nodes - 1;
+    for (int i = 0; i < p.nodes; i++) {
+        for (int t : model.nodes[i].outputs) {
+            Buf *b = t >= 0 && buf_of[t] >= 0 ? &p.bufs[buf_of[t]] : nullptr;
+            if (b && b->first < 0) b->first = i;
+        }
+        for (int t : model.nodes[i].inputs) {
+            Buf *b = t >= 0 && buf_of[t] >= 0 ? &p.bufs[buf_of[t]] : nullptr;
+            if (b) b->last = std::max(b->last, i);
+        }
+    }
+    for (Buf &b : p.bufs) {
+        if (b.first < 0) b.first = 0;
+        if (b.last < b.first) b.last = b.first;
+    }
+    p.build_conflicts();
+    if (!in_place) return p;
+
+    auto external = [&](int t) {
+        return std::count(model.inputs.begin(), model.inputs.end(), t)
+            || std::count(model.outputs.begin(), model.outputs.end(), t);
+    };
+    for (int i = 0; i < p.nodes; i++) {
+        const EonNode &n = model.nodes[i];
+        if (n.outputs.size() != 1 || n.inputs.empty()) continue;
+        int out = n.outputs[0];
+        if (out < 0 || buf_of[out] < 0 || external(out)) continue;
+        const EonTensor &o = model.tensors[out];
+        if (n.op == "OP_ADD" && n.inputs.size() == 2) {
+            for (int in : n.inputs) {
+                if (in < 0 || buf_of[in] < 0 || external(in) || p.bufs[buf_of[in]].last != i) continue;
+                const EonTensor &a = model.tensors[n.inputs[0]], &b = model.tensors[n.inputs[1]];
+                if (a.dims != o.dims || b.dims != o.dims || a.type != o.type || b.type != o.type) break;
+                if (p.tie(buf_of[in], buf_of[out], 0)) {
+                    if (verbose) printf("in place: node %d ADD, t%d over t%d\n", i, out, in);
+                    break;
+                }
+            }
+        } else if (n.op == "OP_PAD" && n.inputs.size() >= 2) {
+            int in = n.inputs[0];
+            if (in < 0 || buf_of[in] < 0 || external(in) || p.bufs[buf_of[in]].last != i) continue;
+            const EonTensor &x = model.tensors[in];
+            auto pads = model.int_data.find(model.tensors[n.inputs[1]].data);
+            long elems = 1;
+            for (int d : x.dims) elems *= d;
+            if (pads == model.int_data.end() || x.type != o.type || !elems || x.bytes % elems) continue;
+            int delta = (o.bytes - x.bytes) & ~(ARENA_ALIGN - 1);
+            if (delta < 0 || !pad_in_place_ok(x.dims, pads->second, (int)(x.bytes / elems), delta)) continue;
+            if (p.tie(buf_of[out], buf_of[in], delta) && verbose) {
+                printf("in place: node %d PAD, t%d at +%d inside t%d\n", i, in, delta, out);
+            }
+        }
+    }
+    p.build_conflicts();
+    return p;
+}
+
+// the offsets on their own terms: aligned, and no two conflicting tensors overlap
+static inline bool arena_offsets_ok(const Planner &p, const std::vector<int> &offset) {
+    for (size_t a = 0; a < p.bufs.size(); a++) {
+        if (offset[a] < 0 || offset[a] % ARENA_ALIGN) {
+            fprintf(stderr, "t%d: bad offset %d\n", p.bufs[a].tensor, offset[a]);
+            return false;
+        }
+        for (size_t b = a + 1; b < p.bufs.size(); b++) {
+            if (p.conflicts((int)a, (int)b) && offset[a] < offset[b] + p.bufs[b].bytes
+             && offset[b] < offset[a] + p.bufs[a].bytes) {
+                fprintf(stderr, "t%d and t%d overlap\n", p.bufs[a].tensor, p.bufs[b].tensor);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#endif // ARENA_PACK_H
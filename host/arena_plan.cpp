@@ -0,0 +1,112 @@
+// Offline tensor arena planner for an EON-compiled model: reads
+// tflite-model/<name>_compiled.cpp, searches for a tighter packing of the
+// arena tensors than the greedy plan the EON compiler emitted, and with
+// --write rewrites the tensorData offsets and kTensorArenaSize in place. A
+// two-tier model (host/tier_plan) gets each arena planned on its own, the
+// tensor_arena_slow rows and kTensorArenaSlowSize likewise.
+// eon_specialize's header reads the rows at run time and needs no rerun.
+//
+//   g++ -std=c++17 -O2 arena_plan.cpp -o arena_plan
+//   ./arena_plan ../ei-ballboxbc-arduino-1.0.1/BallBoxBC_inferencing/src/tflite-model/tflite_learn_854371_3_compiled.cpp
+//                [--budget-ms N] [--no-inplace] [--write]
+//
+// Lifetimes, in-place ADD / PAD and the search: arena_pack.h.
+//
+// Persistent and scratch buffers are carved from the top of the arena at
+// init (from the slow arena when kTierScratchSlow), so the arena size shrinks
+// by exactly what its tensor region does.
+
+
+#include "arena_pack.h"
+
+static int region(const Planner &p, const std::vector<int> &offset) {
+    int h = 0;
+    for (size_t i = 0; i < p.bufs.size(); i++) h = std::max(h, offset[i] + p.bufs[i].bytes);
+    return h;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <name>_compiled.cpp [--budget-ms N] [--no-inplace] [--write]\n", argv[0]);
+        return 1;
+    }
+    int budget_ms = 2000;
+    bool in_place = true, write = false;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--budget-ms") && i + 1 < argc) budget_ms = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--no-inplace")) in_place = false;
+        else if (!strcmp(argv[i], "--write")) write = true;
+        else { fprintf(stderr, "%s: unknown option %s\n", argv[0], argv[i]); return 1; }
+    }
+
+    EonModel model;
+    if (!eon_read(argv[1], model)) return 1;
+
+    bool changed = false;
+    for (int tier = 0; tier < 2; tier++) {
+        const char *arena = tier ? "tensor_arena_slow" : "tensor_arena";
+        const char *size_name = tier ? "kTensorArenaSlowSize" : "kTensorArenaSize";
+        std::vector<bool> member(model.tensors.size(), false);
+        bool any = false;
+        for (size_t t = 0; t < model.tensors.size(); t++) {
+            member[t] = (tier ? model.tensors[t].slow_offset : model.tensors[t].arena_offset) >= 0;
+            any = any || member[t];
+        }
+        if (!any) continue;
+
+        Planner plain = arena_planner(model, member, false, false);
+        Planner tied = arena_planner(model, member, in_place, true);
+        std::vector<int> greedy(plain.bufs.size());
+        for (size_t i = 0; i < plain.bufs.size(); i++) {
+            const EonTensor &t = model.tensors[plain.bufs[i].tensor];
+            greedy[i] = tier ? t.slow_offset : t.arena_offset;
+        }
+
+        Search plain_search(plain);
+        plain_search.run(budget_ms);
+        Search search(tied);
+        search.run(budget_ms);
+
+        int old_region = region(plain, greedy), new_region = search.best;
+        auto verdict = [](const Search &s) { return s.best <= s.bound ? "optimal" : s.timed_out ? "budget spent" : "search complete"; };
+        printf("%s: %zu tensors, %d nodes\n", arena, plain.bufs.size(), plain.nodes);
+        printf("current plan:             %7d bytes\n", old_region);
+        printf("no in-place: best %7d, lower bound %7d (%s, %ld nodes)\n", plain_search.best, plain_search.bound,
+               verdict(plain_search), plain_search.visited);
+        if (in_place) {
+            printf("in-place:    best %7d, lower bound %7d (%s, %ld nodes)\n", search.best, search.bound,
+                   verdict(search), search.visited);
+        }
+        printf("gap current - best:       %7d bytes (%.1f%%)\n", old_region - new_region,
+               old_region ? 100.0 * (old_region - new_region) / old_region : 0.0);
+
+        int saved = align_up(old_region) - align_up(new_region);
+        const std::regex re_size(std::string("constexpr int ") + size_name + R"( = (\d+);)");
+        for (std::string &line : model.lines) {
+            std::smatch m;
+            if (!std::regex_search(line, m, re_size)) continue;
+            int size = atoi(m[1].str().c_str());
+            printf("%s %d -> %d\n", size_name, size, size - saved);
+            if (write && saved > 0) {
+                line = m.prefix().str() + "constexpr int " + size_name + " = " + std::to_string(size - saved) + ";"
+                     + m.suffix().str();
+            }
+        }
+        if (!write) continue;
+        if (saved <= 0) { printf("%s: nothing to gain, left as is\n", arena); continue; }
+
+        // the plan on its own terms, before anything is written
+        if (!arena_offsets_ok(tied, search.best_offset)) return 1;
+        const std::regex re_offset(std::string(arena) + R"( \+ \d+)");
+        for (size_t i = 0; i < tied.bufs.size(); i++) {
+            std::string &line = model.lines[model.tensors[tied.bufs[i].tensor].line];
+            line = std::regex_replace(line, re_offset, std::string(arena) + " + " + std::to_string(search.best_offset[i]),
+                                      std::regex_constants::format_first_only);
+        }
+        changed = true;
+    }
+    if (!changed) return 0;
+    if (!eon_write(model, argv[1])) return 1;
+    printf("%s: offsets rewritten\n", argv[1]);
+    return 0;
+}
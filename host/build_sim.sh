@@ -0,0 +1,51 @@
+#!/bin/sh
+# Builds the host firmware simulator (host/sim): Esp32CAM.cpp + the Edge
+# Impulse library, compiled against the mocks in host/sim/.
+# Usage: ./build_sim.sh [build_dir]   (default: host/sim_build; SDK objects are
+#        reused, delete the directory after changing SDK or model headers)
+#        ./sim_build/esp32cam_sim <jpeg_dir> [options]
+#        ./sim_build/model_pack ...     (model images for /model, see model_pack.cpp)
+#        ./sim_build/x86_nn_check       (X86-NN vs reference kernels, see x86_nn_check.cpp)
+set -e
+HOST=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(dirname "$HOST")
+LIB="$ROOT/ei-ballboxbc-arduino-1.0.1/BallBoxBC_inferencing/src"
+OUT=${1:-$HOST/sim_build}
+CFLAGS=${CFLAGS:--O2}
+DEFS="-DARDUINO=10819 -DEI_SIM=1"
+INC="-I$HOST/sim -I$LIB -I$ROOT"
+
+mkdir -p "$OUT/obj"
+objs=""
+for src in $(cd "$LIB" && find . \( -name '*.c' -o -name '*.cc' -o -name '*.cpp' \) | sort); do
+    case "$src" in
+        ./edge-impulse-sdk/porting/*) case "$src" in ./edge-impulse-sdk/porting/arduino/*|./edge-impulse-sdk/porting/x86/*) ;; *) continue ;; esac ;;
+    esac
+    obj="$OUT/obj/$(echo "$src" | sed 's|^\./||; s|/|_|g').o"
+    objs="$objs $obj"
+    [ "$obj" -nt "$LIB/$src" ] && continue
+    case "$src" in
+        *.c) gcc $CFLAGS $DEFS $INC -c "$LIB/$src" -o "$obj" ;;
+        *)   g++ -std=gnu++17 $CFLAGS $DEFS $INC -c "$LIB/$src" -o "$obj" ;;
+    esac
+done
+
+for src in "$ROOT/Esp32CAM.cpp" "$HOST/sim/sim_mocks.cpp" "$HOST/sim/sim_main.cpp"; do
+    obj="$OUT/obj/$(basename "$src").o"
+    g++ -std=gnu++17 $CFLAGS $DEFS $INC -c "$src" -o "$obj"
+    objs="$objs $obj"
+done
+
+g++ $CFLAGS -o "$OUT/esp32cam_sim" $objs -ljpeg -pthread
+echo "built $OUT/esp32cam_sim"
+
+# model_pack: the same SDK objects and mocks, without the firmware
+sdk=$(echo "$objs" | tr ' ' '\n' | grep -v -e '/Esp32CAM.cpp.o$' -e '/sim_main.cpp.o$')
+g++ -std=gnu++17 $CFLAGS $DEFS $INC -c "$HOST/model_pack.cpp" -o "$OUT/obj/model_pack.cpp.o"
+g++ $CFLAGS -o "$OUT/model_pack" $sdk "$OUT/obj/model_pack.cpp.o" -ljpeg -pthread
+echo "built $OUT/model_pack"
+
+# x86_nn_check: the SDK objects against the reference kernels they replace
+g++ -std=gnu++17 $CFLAGS $DEFS $INC -c "$HOST/x86_nn_check.cpp" -o "$OUT/obj/x86_nn_check.cpp.o"
+g++ $CFLAGS -o "$OUT/x86_nn_check" $sdk "$OUT/obj/x86_nn_check.cpp.o" -ljpeg -pthread
+echo "built $OUT/x86_nn_check"
@@ -0,0 +1,212 @@
+// Reader for EON-compiled model sources (tflite-model/<name>_compiled.cpp),
+// shared by the host tools that post-process them (eon_specialize,
+// arena_plan, tier_plan). Parses the generated tables by regex: tensor dimensions,
+// quantization, the tensorData rows, conv / depthwise parameters, node
+// inputs and outputs, the operator list, the graph inputs / outputs and the
+// int32 constant tensors. Lines are kept so a tool can rewrite them.
+
+#ifndef EON_SOURCE_H
+#define EON_SOURCE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+struct EonTensor {
+    std::string alloc, type, data;  // kTfLiteArenaRw, kTfLiteInt8, "tensor_arena + 36864" / "g0::tensor_data43"
+    int arena_offset = -1;          // kTfLiteArenaRw: offset into tensor_arena
+    int slow_offset = -1;           // ... or into tensor_arena_slow (host/tier_plan)
+    int bytes = 0;
+    size_t line = 0;                // tensorData row in EonModel::lines
+    std::vector<int> dims;
+    float scale = 0;
+    int zero_point = 0;
+};
+
+struct EonNode {
+    std::string op;                 // OP_CONV_2D, ...
+    std::vector<int> inputs, outputs;
+    bool has_params = false, same = false;
+    int stride_w = 1, stride_h = 1, depth_multiplier = 1, dil_w = 1, dil_h = 1;
+    std::string activation;
+};
+
+struct EonModel {
+    std::string name;               // <name>_compiled.cpp
+    std::vector<std::string> lines;
+    std::vector<EonTensor> tensors;
+    std::vector<EonNode> nodes;     // execution order
+    std::vector<int> inputs, outputs;
+    std::map<std::string, std::vector<int>> int_data;  // "g0::tensor_data1" -> values
+};
+
+static inline std::vector<int> eon_parse_ints(const std::string &s) {
+    std::vector<int> v;
+    const char *p = s.c_str();
+    char *end;
+    for (;;) {
+        while (*p == ' ' || *p == ',' || *p == '\n' || *p == '\r') p++;
+        long x = strtol(p, &end, 10);
+        if (end == p) break;
+        v.push_back((int)x);
+        p = end;
+    }
+    return v;
+}
+
+static inline bool eon_read(const char *path, EonModel &model) {
+    std::string in_path = path;
+    if (in_path.rfind("_compiled.cpp") == std::string::npos) {
+        fprintf(stderr, "%s: expected <name>_compiled.cpp\n", path);
+        return false;
+    }
+    size_t slash = in_path.find_last_of('/');
+    model.name = in_path.substr(slash == std::string::npos ? 0 : slash + 1);
+    model.name = model.name.substr(0, model.name.size() - strlen("_compiled.cpp"));
+
+    FILE *f = fopen(path, "r");
+    if (!f) { perror(path); return false; }
+    char buf[1 << 16];
+    while (fgets(buf, sizeof(buf), f)) model.lines.push_back(buf);
+    fclose(f);
+
+    const std::regex re_dims(R"(const TfArray<\d+, int> (tensor_dimension\d+) = \{ \d+, \{ ([^}]*)\} \};)");
+    const std::regex re_scale(R"(const TfArray<\d+, float> (quant\d+)_scale = \{ \d+, \{ ([-0-9.e+]+))");
+    const std::regex re_zero(R"(const TfArray<\d+, int> (quant\d+)_zero = \{ \d+, \{ ([-0-9]+))");
+    const std::regex re_quant(R"(const TfLiteAffineQuantization (quant\d+) = \{ \(TfLiteFloatArray\*\)&(?:g0::)?(quant\d+)_scale, \(TfLiteIntArray\*\)&(?:g0::)?(quant\d+)_zero)");
+    const std::regex re_tensor(R"(^\{ (kTfLite\w+), (kTfLite\w+), \(int32_t\*\)\(?([^,]*?)\)?, \(TfLiteIntArray\*\)&g0::(tensor_dimension\d+), (\d+), \{\w+, (?:const_cast<void\*>\(static_cast<const void\*>\(&g0::(quant\d+)\)\)|nullptr)\})");
+    const std::regex re_arena(R"(^tensor_arena \+ (\d+)$)");
+    const std::regex re_slow(R"(^tensor_arena_slow \+ (\d+)$)");
+    const std::regex re_conv(R"(const TfLiteConvParams opdata(\d+) = \{ kTfLitePadding(\w+), (\d+),(\d+), (kTfLiteAct\w+), (\d+),(\d+) \};)");
+    const std::regex re_dw(R"(const TfLiteDepthwiseConvParams opdata(\d+) = \{ kTfLitePadding(\w+), (\d+),(\d+), (\d+), (kTfLiteAct\w+), (\d+),(\d+) \};)");
+    const std::regex re_io(R"(const TfArray<\d+, int> (inputs|outputs)(\d+) = \{ \d+, \{ ([^}]*)\} \};)");
+    const std::regex re_int_data(R"(int32_t (tensor_data\d+)\[[^\]]*\] = \{)");
+    const std::regex re_op(R"(OP_\w+)");
+
+    std::map<std::string, std::vector<int>> dims;
+    std::map<std::string, float> scales;
+    std::map<std::string, int> zeros;
+    std::map<std::string, std::pair<float, int>> quants;
+    std::map<int, EonNode> nodes;
+    std::vector<std::string> ops;
+    bool in_tensors = false, in_ops = false;
+    std::vector<int> *collect = nullptr;    // multi-line { ... } initializer
+    std::string collected;
+
+    for (size_t li = 0; li < model.lines.size(); li++) {
+        const std::string &line = model.lines[li];
+        std::smatch m;
+        if (collect) {
+            collected += line;
+            if (line.find('}') != std::string::npos) {
+                *collect = eon_parse_ints(collected.substr(0, collected.find('}')));
+                collect = nullptr;
+            }
+            continue;
+        }
+        if (line.rfind("TensorInfo_t tensorData[] =", 0) == 0) { in_tensors = true; continue; }
+        if (line.rfind("used_operators_e used_ops[] =", 0) == 0) { in_ops = true; continue; }
+        if (in_tensors) {
+            if (line.rfind("};", 0) == 0) { in_tensors = false; continue; }
+            if (!std::regex_search(line, m, re_tensor)) {
+                fprintf(stderr, "%s: unexpected tensorData row: %s", path, line.c_str());
+                return false;
+            }
+            EonTensor t;
+            t.alloc = m[1];
+            t.type = m[2];
+            t.data = m[3];
+            t.dims = dims[m[4]];
+            t.bytes = atoi(m[5].str().c_str());
+            t.line = li;
+            if (m[6].matched) {
+                t.scale = quants[m[6]].first;
+                t.zero_point = quants[m[6]].second;
+            }
+            std::smatch a;
+            if (t.alloc == "kTfLiteArenaRw" && std::regex_search(t.data, a, re_arena)) {
+                t.arena_offset = atoi(a[1].str().c_str());
+            } else if (t.alloc == "kTfLiteArenaRw" && std::regex_search(t.data, a, re_slow)) {
+                t.slow_offset = atoi(a[1].str().c_str());
+            }
+            model.tensors.push_back(t);
+            continue;
+        }
+        if (in_ops) {
+            for (std::sregex_iterator it(line.begin(), line.end(), re_op), end; it != end; ++it) ops.push_back(it->str());
+            if (line.find('}') != std::string::npos) in_ops = false;
+            continue;
+        }
+        if (line.rfind("static const int in_tensor_indices[] =", 0) == 0
+         || line.rfind("static const int out_tensor_indices[] =", 0) == 0) {
+            collect = line.find("in_tensor") != std::string::npos ? &model.inputs : &model.outputs;
+            collected = line.substr(line.find('{') + 1);
+            if (collected.find('}') != std::string::npos) {
+                *collect = eon_parse_ints(collected.substr(0, collected.find('}')));
+                collect = nullptr;
+            }
+        } else if (std::regex_search(line, m, re_int_data)) {
+            collect = &model.int_data["g0::" + m[1].str()];
+            collected = m.suffix();
+            if (collected.find('}') != std::string::npos) {
+                *collect = eon_parse_ints(collected.substr(0, collected.find('}')));
+                collect = nullptr;
+            }
+        } else if (std::regex_search(line, m, re_dims)) {
+            dims[m[1]] = eon_parse_ints(m[2]);
+        } else if (std::regex_search(line, m, re_scale)) {
+            scales[m[1]] = strtof(m[2].str().c_str(), nullptr);
+        } else if (std::regex_search(line, m, re_zero)) {
+            zeros[m[1]] = atoi(m[2].str().c_str());
+        } else if (std::regex_search(line, m, re_quant)) {
+            quants[m[1]] = std::make_pair(scales[m[2]], zeros[m[3]]);
+        } else if (std::regex_search(line, m, re_conv)) {
+            EonNode &n = nodes[atoi(m[1].str().c_str())];
+            n.has_params = true;
+            n.same = m[2] == "Same";
+            n.stride_w = atoi(m[3].str().c_str());
+            n.stride_h = atoi(m[4].str().c_str());
+            n.activation = m[5];
+            n.dil_w = atoi(m[6].str().c_str());
+            n.dil_h = atoi(m[7].str().c_str());
+        } else if (std::regex_search(line, m, re_dw)) {
+            EonNode &n = nodes[atoi(m[1].str().c_str())];
+            n.has_params = true;
+            n.same = m[2] == "Same";
+            n.stride_w = atoi(m[3].str().c_str());
+            n.stride_h = atoi(m[4].str().c_str());
+            n.depth_multiplier = atoi(m[5].str().c_str());
+            n.activation = m[6];
+            n.dil_w = atoi(m[7].str().c_str());
+            n.dil_h = atoi(m[8].str().c_str());
+        } else if (std::regex_search(line, m, re_io)) {
+            EonNode &n = nodes[atoi(m[2].str().c_str())];
+            (m[1] == "inputs" ? n.inputs : n.outputs) = eon_parse_ints(m[3]);
+        }
+    }
+    if (model.tensors.empty() || ops.empty() || ops.size() != nodes.size()) {
+        fprintf(stderr, "%s: %zu tensors, %zu operators, %zu nodes; not an EON model?\n", path,
+                model.tensors.size(), ops.size(), nodes.size());
+        return false;
+    }
+    for (size_t i = 0; i < ops.size(); i++) {
+        if (!nodes.count((int)i)) { fprintf(stderr, "%s: node %zu missing\n", path, i); return false; }
+        nodes[(int)i].op = ops[i];
+        model.nodes.push_back(nodes[(int)i]);
+    }
+    return true;
+}
+
+static inline bool eon_write(const EonModel &model, const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) { perror(path); return false; }
+    for (const std::string &line : model.lines) fputs(line.c_str(), f);
+    if (fclose(f) != 0) { perror(path); return false; }
+    return true;
+}
+
+#endif // EON_SOURCE_H
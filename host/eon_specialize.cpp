@@ -0,0 +1,148 @@
+// Generates the shape-specialized invoke for an EON-compiled model: reads
+// tflite-model/<name>_compiled.cpp and writes <name>_specialized.h next to it
+// (or to OUT). Every int8 CONV_2D / DEPTHWISE_CONV_2D becomes a call into
+// tflite::fixed_shape with its dimensions, strides, padding, zero points and
+// activation range as compile-time constants; other operators keep their
+// registration. Building with EI_CLASSIFIER_EON_SPECIALIZED=1 makes
+// <name>_invoke() run it. Rerun after every model export; arena replans
+// (arena_plan, tier_plan) do not need it.
+//
+//   g++ -std=c++17 -O2 eon_specialize.cpp -o eon_specialize
+//   ./eon_specialize ../ei-ballboxbc-arduino-1.0.1/BallBoxBC_inferencing/src/tflite-model/tflite_learn_854371_3_compiled.cpp [OUT]
+
+#include <math.h>
+#include "eon_source.h"
+
+// TFLite's ComputePaddingHeightWidth for one axis; returns the output size
+static int padded_size(bool same, int in, int filter, int stride, int dil, int *pad) {
+    int effective = (filter - 1) * dil + 1;
+    int out = same ? (in + stride - 1) / stride : (in - effective + stride) / stride;
+    int total = (out - 1) * stride + effective - in;
+    *pad = total > 0 ? total / 2 : 0;
+    return out;
+}
+
+// CalculateActivationRangeQuantized() for int8
+static void activation_range(const std::string &act, const EonTensor &out, int *lo, int *hi) {
+    auto quantize = [&](float f) { return out.zero_point + (int)roundf(f / out.scale); };
+    *lo = -128;
+    *hi = 127;
+    if (act == "kTfLiteActRelu" || act == "kTfLiteActRelu6") *lo = quantize(0.0f) > *lo ? quantize(0.0f) : *lo;
+    if (act == "kTfLiteActRelu6") *hi = quantize(6.0f) < *hi ? quantize(6.0f) : *hi;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <name>_compiled.cpp [out.h]\n", argv[0]);
+        return 1;
+    }
+    EonModel model;
+    if (!eon_read(argv[1], model)) return 1;
+    std::string in_path = argv[1];
+    std::string out_path = argc > 2 ? argv[2] : in_path.substr(0, in_path.rfind("_compiled.cpp")) + "_specialized.h";
+    const std::string &name = model.name;
+    const std::vector<EonTensor> &tensors = model.tensors;
+
+    // Activations by their tensorData[] row through the model's tensor_address(),
+    // not by the offset in it: arena_plan and tier_plan rewrite those rows, and
+    // a header holding copies of them would go stale without a rerun.
+    auto pointer = [&](int t) {
+        return tensors[t].alloc == "kTfLiteArenaRw" ? "tensor_address(" + std::to_string(t) + ")" : tensors[t].data;
+    };
+
+    std::string shapes, body;
+    int specialized = 0;
+    for (size_t i = 0; i < model.nodes.size(); i++) {
+        const EonNode &n = model.nodes[i];
+        bool conv = n.op == "OP_CONV_2D", dw = n.op == "OP_DEPTHWISE_CONV_2D";
+        char line[1024];
+
+        // shapes as NHWC / OHWI / 1HWC, batch 1, int8, no dilation
+        bool ok = (conv || dw) && n.has_params && n.inputs.size() >= 2 && n.outputs.size() == 1
+               && n.dil_w == 1 && n.dil_h == 1 && n.depth_multiplier == 1;
+        const EonTensor *in = nullptr, *filter = nullptr, *out = nullptr;
+        int pad_h = 0, pad_w = 0;
+        if (ok) {
+            in = &tensors[n.inputs[0]];
+            filter = &tensors[n.inputs[1]];
+            out = &tensors[n.outputs[0]];
+            ok = in->type == "kTfLiteInt8" && filter->type == "kTfLiteInt8" && out->type == "kTfLiteInt8"
+              && in->dims.size() == 4 && filter->dims.size() == 4 && out->dims.size() == 4
+              && in->dims[0] == 1 && out->dims[0] == 1
+              && (conv ? filter->dims[3] == in->dims[3] && filter->dims[0] == out->dims[3]
+                       : filter->dims[3] == in->dims[3] && out->dims[3] == in->dims[3])
+              && padded_size(n.same, in->dims[1], filter->dims[1], n.stride_h, 1, &pad_h) == out->dims[1]
+              && padded_size(n.same, in->dims[2], filter->dims[2], n.stride_w, 1, &pad_w) == out->dims[2];
+        }
+
+        if (!ok) {
+            snprintf(line, sizeof(line),
+                     "\n  // %zu: %s\n"
+                     "  ResetTensors();\n"
+                     "  status = registrations[%s].invoke(&ctx, &tflNodes[%zu]);\n"
+                     "  if (status != kTfLiteOk) return status;\n",
+                     i, n.op.c_str() + 3, n.op.c_str(), i);
+            body += line;
+            continue;
+        }
+
+        int act_min, act_max;
+        activation_range(n.activation, *out, &act_min, &act_max);
+        snprintf(line, sizeof(line),
+                 "struct Node%zu {\n"
+                 "  static const int in_h = %d, in_w = %d, in_c = %d;\n"
+                 "  static const int out_h = %d, out_w = %d, out_c = %d;\n"
+                 "  static const int filter_h = %d, filter_w = %d, stride_h = %d, stride_w = %d;\n"
+                 "  static const int pad_h = %d, pad_w = %d;\n"
+                 "  static const int input_offset = %d, output_offset = %d;\n"
+                 "  static const int act_min = %d, act_max = %d;\n"
+                 "};\n",
+                 i, in->dims[1], in->dims[2], in->dims[3], out->dims[1], out->dims[2], out->dims[3],
+                 filter->dims[1], filter->dims[2], n.stride_h, n.stride_w, pad_h, pad_w,
+                 -in->zero_point, out->zero_point, act_min, act_max);
+        shapes += line;
+
+        std::string bias = n.inputs.size() > 2 && n.inputs[2] >= 0
+                         ? "(const int32_t*)" + tensors[n.inputs[2]].data : std::string("nullptr");
+        snprintf(line, sizeof(line),
+                 "\n  // %zu: %s %dx%dx%d -> %dx%dx%d, %dx%d stride %d\n"
+                 "  tflite::fixed_shape::%s<eon_shapes::Node%zu>(\n"
+                 "      specialized_op_data(%zu), (const int8_t*)(%s), (const int8_t*)(%s),\n"
+                 "      %s, (int8_t*)(%s));\n",
+                 i, n.op.c_str() + 3, in->dims[1], in->dims[2], in->dims[3], out->dims[1], out->dims[2],
+                 out->dims[3], filter->dims[1], filter->dims[2], n.stride_h,
+                 conv ? "Conv" : "DepthwiseConv", i, i, pointer(n.inputs[0]).c_str(), filter->data.c_str(),
+                 bias.c_str(), pointer(n.outputs[0]).c_str());
+        body += line;
+        specialized++;
+    }
+
+    FILE *o = fopen(out_path.c_str(), "w");
+    if (!o) { perror(out_path.c_str()); return 1; }
+    fprintf(o,
+            "// Generated by host/eon_specialize from %s_compiled.cpp, do not edit.\n"
+            "// Included by that file when EI_CLASSIFIER_EON_SPECIALIZED is set: a\n"
+            "// straight-line invoke with the shape of every conv fixed at compile time.\n"
+            "\n"
+            "#include \"edge-impulse-sdk/tensorflow/lite/micro/kernels/fixed_shape_kernels.h\"\n"
+            "\n"
+            "namespace eon_shapes {\n"
+            "%s"
+            "}  // namespace eon_shapes\n"
+            "\n"
+            "// Conv node data (OpDataConv first in every backend) as Prepare left it\n"
+            "static inline const tflite::OpDataConv& specialized_op_data(size_t i) {\n"
+            "  return *static_cast<const tflite::OpDataConv*>(tflNodes[i].user_data);\n"
+            "}\n"
+            "\n"
+            "static TfLiteStatus %s_invoke_specialized() {\n"
+            "  TfLiteStatus status;\n"
+            "  (void)status;\n"
+            "%s"
+            "  return kTfLiteOk;\n"
+            "}\n",
+            name.c_str(), shapes.c_str(), name.c_str(), body.c_str());
+    if (fclose(o) != 0) { perror(out_path.c_str()); return 1; }
+    printf("%s: %d of %zu operators specialized\n", out_path.c_str(), specialized, model.nodes.size());
+    return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef HOST_FILE_CAMERA_H
+#define HOST_FILE_CAMERA_H
+
+// Host stand-in for the camera: replays the files of a directory (sorted by
+// name, looping) as frames. Binary PPM (P6, 8-bit RGB) is decoded straight to
+// RGB888; any other file is returned as raw bytes.
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class FileCamera {
+public:
+    bool open(const char *dir) {
+        files_.clear();
+        DIR *d = opendir(dir);
+        if (!d) return false;
+        while (struct dirent *e = readdir(d)) {
+            if (e->d_name[0] == '.') continue;
+            files_.push_back(std::string(dir) + "/" + e->d_name);
+        }
+        closedir(d);
+        std::sort(files_.begin(), files_.end());
+        next_ = 0;
+        return !files_.empty();
+    }
+
+    size_t count() const { return files_.size(); }
+    const std::string &current() const { return files_[(next_ + files_.size() - 1) % files_.size()]; }
+
+    // Raw bytes of the next file (e.g. a JPEG for the mocked esp_camera_fb_get()).
+    bool next_bytes(std::vector<uint8_t> &out) {
+        if (files_.empty()) return false;
+        FILE *f = fopen(files_[next_].c_str(), "rb");
+        next_ = (next_ + 1) % files_.size();
+        if (!f) return false;
+        fseek(f, 0, SEEK_END);
+        long n = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        out.resize(n > 0 ? (size_t)n : 0);
+        bool ok = n > 0 && fread(out.data(), 1, out.size(), f) == out.size();
+        fclose(f);
+        return ok;
+    }
+
+    // Next frame decoded to RGB888 into `dst` (at most `max` bytes).
+    bool next_rgb888(uint8_t *dst, size_t max, int *width, int *height) {
+        std::vector<uint8_t> raw;
+        if (!next_bytes(raw)) return false;
+        int w = 0, h = 0, maxval = 0, consumed = 0;
+        if (raw.size() > 2 && raw[0] == 'P' && raw[1] == '6' &&
+            sscanf((const char *)raw.data(), "P6 %d %d %d%n", &w, &h, &maxval, &consumed) == 3 &&
+            maxval == 255) {
+            size_t bytes = (size_t)w * h * 3;
+            size_t off = (size_t)consumed + 1;   // single whitespace after maxval
+            if (bytes > max || off + bytes > raw.size()) return false;
+            memcpy(dst, raw.data() + off, bytes);
+        } else {
+            if (raw.size() > max) return false;
+            memcpy(dst, raw.data(), raw.size());
+        }
+        if (width) *width = w;
+        if (height) *height = h;
+        return true;
+    }
+
+private:
+    std::vector<std::string> files_;
+    size_t next_ = 0;
+};
+
+#endif // HOST_FILE_CAMERA_H
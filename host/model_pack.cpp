@@ -0,0 +1,200 @@
+// Packs a TFLite flatbuffer into the model image /model accepts (see
+// model_store.h): plans the tensor arena with the interpreter and operator
+// set the firmware uses, checks the model against the built-in impulse, and
+// prepends the header.
+//
+//   ./model_pack pack  model.tflite model.eim [--id N]
+//   ./model_pack info  model.eim
+//   ./model_pack synth test.tflite            (FOMO-shaped test model that
+//                                              marks dark 8x8 cells as "ball")
+//   curl --data-binary @model.eim -H 'Content-Type: application/octet-stream' http://<esp32-ip>/model
+//
+// Built next to the simulator by build_sim.sh. The arena is measured on the
+// host, whose 64-bit interpreter structures are larger than the ESP32's, so
+// the planned size errs on the safe side.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <BallBoxBC_inferencing.h>
+#include "model_store.h"
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_utils.h"
+
+#define PACK_ARENA_BYTES (8u * 1024 * 1024)
+
+static bool read_file(const char *path, std::vector<uint8_t> &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) { perror(path); return false; }
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) out.insert(out.end(), chunk, chunk + n);
+    fclose(f);
+    return true;
+}
+
+static bool write_file(const char *path, const void *a, size_t na, const void *b = nullptr, size_t nb = 0) {
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror(path); return false; }
+    bool ok = fwrite(a, 1, na, f) == na && (!nb || fwrite(b, 1, nb, f) == nb);
+    return fclose(f) == 0 && ok;
+}
+
+static void print_tensor(const char *what, const TfLiteTensor *t) {
+    printf("%s: type %d, shape [", what, t->type);
+    for (int d = 0; d < t->dims->size; d++) printf(d ? ",%d" : "%d", t->dims->data[d]);
+    printf("], scale %g, zero point %d\n", t->params.scale, (int)t->params.zero_point);
+}
+
+static int pack(const char *in, const char *out, uint32_t id) {
+    std::vector<uint8_t> fb;
+    if (!read_file(in, fb)) return 1;
+    flatbuffers::Verifier verifier(fb.data(), fb.size());
+    if (!tflite::VerifyModelBuffer(verifier)) { fprintf(stderr, "%s: not a TFLite model\n", in); return 1; }
+
+    // plan with the reference kernels, the arena the device needs; the
+    // filters X86-NN packs live outside it (packed_weights.h)
+    x86_nn_set_max_level(X86_NN_LEVEL_NONE);
+    static ModelStoreResolver resolver;
+    model_store_add_ops(resolver);
+    std::vector<uint8_t> arena(PACK_ARENA_BYTES + 16);
+    uint8_t *aligned = (uint8_t *)(((uintptr_t)arena.data() + 15) & ~(uintptr_t)15);
+    tflite::MicroInterpreter interpreter(tflite::GetModel(fb.data()), resolver, aligned, PACK_ARENA_BYTES);
+    if (interpreter.AllocateTensors(true) != kTfLiteOk) {
+        fprintf(stderr, "%s: AllocateTensors failed (operator not in model_store_add_ops()?)\n", in);
+        return 1;
+    }
+    print_tensor("input", interpreter.input(0));
+    print_tensor("output", interpreter.output(0));
+
+    ModelImageHeader hdr = {};
+    hdr.magic = MODEL_IMAGE_MAGIC;
+    hdr.header_size = sizeof(hdr);
+    hdr.version = MODEL_IMAGE_VERSION;
+    hdr.model_bytes = (uint32_t)fb.size();
+    hdr.arena_bytes = (uint32_t)((interpreter.arena_used_bytes() + 16 + 15) & ~(size_t)15);
+    hdr.crc32 = model_crc32(0, fb.data(), fb.size());
+    hdr.model_id = id;
+    if (!write_file(out, &hdr, sizeof(hdr), fb.data(), fb.size())) return 1;
+    printf("%s: model %u bytes, arena %u bytes, crc %08x, id %u\n", out, hdr.model_bytes, hdr.arena_bytes,
+           hdr.crc32, hdr.model_id);
+    return 0;
+}
+
+static int info(const char *path) {
+    std::vector<uint8_t> img;
+    if (!read_file(path, img)) return 1;
+    ModelImageHeader hdr;
+    if (img.size() < sizeof(hdr)) { fprintf(stderr, "%s: too short\n", path); return 1; }
+    memcpy(&hdr, img.data(), sizeof(hdr));
+    bool ok = hdr.magic == MODEL_IMAGE_MAGIC && hdr.header_size == sizeof(hdr)
+           && hdr.header_size + hdr.model_bytes == img.size()
+           && model_crc32(0, img.data() + hdr.header_size, hdr.model_bytes) == hdr.crc32;
+    printf("%s: version %u, model %u bytes, arena %u bytes, crc %08x, id %u: %s\n", path, hdr.version,
+           hdr.model_bytes, hdr.arena_bytes, hdr.crc32, hdr.model_id, ok ? "ok" : "INVALID");
+    return ok ? 0 : 1;
+}
+
+// 96x96x1 int8 -> CONV_2D 8x8/8 (3 channels: background, ball, box) -> SOFTMAX
+// -> 12x12x3 int8, quantized like the built-in FOMO output. A cell whose mean
+// luma is below ~0.45 scores as "ball"; "box" never fires.
+static int synth(const char *out) {
+    using namespace tflite;
+    const float in_scale = 1.0f / 255, w_scale = 1.0f / 128, logit_scale = 1.0f / 16;
+
+    auto quant = [](std::vector<float> scale, std::vector<int64_t> zp, int dim = 0) {
+        std::unique_ptr<QuantizationParametersT> q(new QuantizationParametersT());
+        q->scale = scale;
+        q->zero_point = zp;
+        q->quantized_dimension = dim;
+        return q;
+    };
+    auto tensor = [](std::vector<int32_t> shape, TensorType type, uint32_t buffer, const char *name,
+                     std::unique_ptr<QuantizationParametersT> q) {
+        std::unique_ptr<TensorT> t(new TensorT());
+        t->shape = shape;
+        t->type = type;
+        t->buffer = buffer;
+        t->name = name;
+        t->quantization = std::move(q);
+        return t;
+    };
+
+    // filter [3,8,8,1]: per tap weight -0.625 for "ball" (sum -40 over the cell)
+    std::vector<uint8_t> filter(3 * 64, 0);
+    for (int k = 0; k < 64; k++) filter[64 + k] = (uint8_t)(int8_t)-80;
+    // logit = sum(w * x) + b, bias in units of in_scale * w_scale
+    const float bias_unit = in_scale * w_scale;
+    int32_t bias[3] = {0, (int32_t)(18.0f / bias_unit), (int32_t)(-8.0f / bias_unit)};
+
+    ModelT m;
+    m.version = TFLITE_SCHEMA_VERSION;
+    m.description = "model_pack synth: dark cell detector";
+    for (int i = 0; i < 6; i++) m.buffers.emplace_back(new BufferT());
+    m.buffers[1]->data = filter;
+    m.buffers[2]->data.assign((uint8_t *)bias, (uint8_t *)bias + sizeof(bias));
+
+    std::unique_ptr<SubGraphT> g(new SubGraphT());
+    g->tensors.push_back(tensor({1, 96, 96, 1}, TensorType_INT8, 3, "input", quant({in_scale}, {-128})));
+    g->tensors.push_back(tensor({3, 8, 8, 1}, TensorType_INT8, 1, "filter",
+                                quant({w_scale, w_scale, w_scale}, {0, 0, 0}, 0)));
+    g->tensors.push_back(tensor({3}, TensorType_INT32, 2, "bias",
+                                quant({bias_unit, bias_unit, bias_unit}, {0, 0, 0}, 0)));
+    g->tensors.push_back(tensor({1, 12, 12, 3}, TensorType_INT8, 4, "logits", quant({logit_scale}, {0})));
+    g->tensors.push_back(tensor({1, 12, 12, 3}, TensorType_INT8, 5, "output", quant({1.0f / 256}, {-128})));
+    g->inputs = {0};
+    g->outputs = {4};
+
+    std::unique_ptr<OperatorCodeT> conv_code(new OperatorCodeT());
+    conv_code->builtin_code = BuiltinOperator_CONV_2D;
+    conv_code->deprecated_builtin_code = BuiltinOperator_CONV_2D;
+    conv_code->version = 3;
+    std::unique_ptr<OperatorCodeT> softmax_code(new OperatorCodeT());
+    softmax_code->builtin_code = BuiltinOperator_SOFTMAX;
+    softmax_code->deprecated_builtin_code = BuiltinOperator_SOFTMAX;
+    softmax_code->version = 2;
+    m.operator_codes.push_back(std::move(conv_code));
+    m.operator_codes.push_back(std::move(softmax_code));
+
+    std::unique_ptr<OperatorT> conv(new OperatorT());
+    conv->opcode_index = 0;
+    conv->inputs = {0, 1, 2};
+    conv->outputs = {3};
+    Conv2DOptionsT conv_opt;
+    conv_opt.padding = Padding_VALID;
+    conv_opt.stride_w = conv_opt.stride_h = 8;
+    conv_opt.dilation_w_factor = conv_opt.dilation_h_factor = 1;
+    conv->builtin_options.Set(conv_opt);
+    g->operators.push_back(std::move(conv));
+
+    std::unique_ptr<OperatorT> softmax(new OperatorT());
+    softmax->opcode_index = 1;
+    softmax->inputs = {3};
+    softmax->outputs = {4};
+    SoftmaxOptionsT softmax_opt;
+    softmax_opt.beta = 1.0f;
+    softmax->builtin_options.Set(softmax_opt);
+    g->operators.push_back(std::move(softmax));
+    m.subgraphs.push_back(std::move(g));
+
+    // the SDK's trimmed flatbuffers has no fallback for a null allocator
+    flatbuffers::DefaultAllocator alloc;
+    flatbuffers::FlatBufferBuilder fbb(1024, &alloc);
+    FinishModelBuffer(fbb, Model::Pack(fbb, &m));
+    if (!write_file(out, fbb.GetBufferPointer(), fbb.GetSize())) return 1;
+    printf("%s: %u bytes\n", out, (unsigned)fbb.GetSize());
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 4 && !strcmp(argv[1], "pack")) {
+        uint32_t id = 1;
+        if (argc >= 6 && !strcmp(argv[4], "--id")) id = (uint32_t)strtoul(argv[5], nullptr, 0);
+        return pack(argv[2], argv[3], id);
+    }
+    if (argc == 3 && !strcmp(argv[1], "info")) return info(argv[2]);
+    if (argc == 3 && !strcmp(argv[1], "synth")) return synth(argv[2]);
+    fprintf(stderr, "usage: %s pack model.tflite model.eim [--id N] | info model.eim | synth test.tflite\n", argv[0]);
+    return 1;
+}
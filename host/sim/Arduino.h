@@ -0,0 +1,101 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Host stand-in for the Arduino core: time, Serial and String, just enough
+// for Esp32CAM.cpp and the Edge Impulse Arduino porting layer.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define PROGMEM
+#define HIGH 1
+#define LOW  0
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+class String {
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string &s) : s_(s) {}
+    String(int v) : s_(std::to_string(v)) {}
+
+    const char *c_str() const { return s_.c_str(); }
+    size_t length() const { return s_.size(); }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+    String operator+(const String &o) const { return String(s_ + o.s_); }
+    String &operator+=(const String &o) { s_ += o.s_; return *this; }
+    bool operator==(const char *o) const { return s_ == o; }
+    friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.s_); }
+
+private:
+    std::string s_;
+};
+
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+// Printable subset used by Serial and the LCD.
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t n) {
+        size_t w = 0;
+        while (n--) w += write(*buf++);
+        return w;
+    }
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    size_t print(const Printable &p) { return p.printTo(*this); }
+
+    template <typename T> size_t println(const T &v) { size_t n = print(v); return n + write("\r\n"); }
+    size_t println(double v, int digits) { size_t n = print(v, digits); return n + write("\r\n"); }
+    size_t println() { return write("\r\n"); }
+
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+        va_end(ap);
+        if (n < 0) return 0;
+        return write((const uint8_t *)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+    }
+};
+
+// Serial goes to stdout unless the simulator silences it.
+class HardwareSerial : public Print {
+public:
+    using Print::write;
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { if (!quiet) fputc(c, stdout); return 1; }
+    int available() { return 0; }
+    int read() { return -1; }
+    bool quiet = false;
+};
+extern HardwareSerial Serial;
+
+#endif // SIM_ARDUINO_H
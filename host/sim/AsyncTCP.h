@@ -0,0 +1,4 @@
+#ifndef SIM_ASYNCTCP_H
+#define SIM_ASYNCTCP_H
+// Host stand-in: ESPAsyncWebServer.h carries everything the firmware uses.
+#endif // SIM_ASYNCTCP_H
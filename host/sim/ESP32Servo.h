@@ -0,0 +1,38 @@
+#ifndef SIM_ESP32SERVO_H
+#define SIM_ESP32SERVO_H
+
+// Host stand-in for ESP32Servo: remembers the commanded angles so the
+// simulator can report the sorting decisions.
+
+#include <atomic>
+#include "Arduino.h"
+
+class Servo {
+public:
+    int attach(int pin, int min_us = 544, int max_us = 2400) {
+        (void)pin; (void)min_us; (void)max_us;
+        return 1;
+    }
+
+    void write(int angle) {
+        if (angle < 0) angle = 0;
+        if (angle > 180) angle = 180;
+        if (angle != angle_.exchange(angle)) moves_.fetch_add(1);
+        writes_.fetch_add(1);
+        hist_[angle].fetch_add(1);
+    }
+
+    int read() const { return angle_.load(); }
+
+    uint32_t writes() const { return writes_.load(); }
+    uint32_t moves() const { return moves_.load(); }          // writes that changed the angle
+    uint32_t writes_at(int angle) const { return hist_[angle].load(); }
+
+private:
+    std::atomic<int> angle_{-1};
+    std::atomic<uint32_t> writes_{0};
+    std::atomic<uint32_t> moves_{0};
+    std::atomic<uint32_t> hist_[181] = {};
+};
+
+#endif // SIM_ESP32SERVO_H
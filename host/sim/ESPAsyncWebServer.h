@@ -0,0 +1,268 @@
+#ifndef SIM_ESPASYNCWEBSERVER_H
+#define SIM_ESPASYNCWEBSERVER_H
+
+// Host stand-in for ESPAsyncWebServer. Nothing listens on a socket: the
+// simulator calls AsyncWebServer::sim_request() to run the same route
+// handlers the browser would hit, and gets the response back in memory.
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_ANY = 0x7f } WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+typedef std::function<size_t(uint8_t *buffer, size_t max_len, size_t index)> AwsResponseFiller;
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String &name, const String &value) : name_(name), value_(value) {}
+    const String &name() const { return name_; }
+    const String &value() const { return value_; }
+private:
+    String name_, value_;
+};
+
+class AsyncWebServerResponse {
+public:
+    virtual ~AsyncWebServerResponse() {}
+    void addHeader(const char *name, const char *value) { headers[name] = value; }
+
+    int code = 200;
+    std::string content_type;
+    std::string body;
+    std::map<std::string, std::string> headers;
+    AwsResponseFiller filler;       // chunked responses
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    using Print::write;
+    size_t write(uint8_t c) override { body.push_back((char)c); return 1; }
+    size_t write(const uint8_t *buf, size_t n) override { body.append((const char *)buf, n); return n; }
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethod method, const std::string &url) : method_(method) {
+        size_t q = url.find('?');
+        path_ = url.substr(0, q);
+        if (q != std::string::npos) parse(url.substr(q + 1), false);
+    }
+
+    void add_post(const std::string &body) { parse(body, true); }
+
+    bool hasParam(const char *name, bool post = false) const { return find(name, post) != nullptr; }
+    AsyncWebParameter *getParam(const char *name, bool post = false) const { return find(name, post); }
+
+    void send(int code, const char *type = "", const char *content = "") {
+        AsyncWebServerResponse *r = new AsyncWebServerResponse();
+        r->code = code;
+        r->content_type = type;
+        r->body = content;
+        send(r);
+    }
+    void send(int code, const char *type, const String &content) { send(code, type, content.c_str()); }
+    void send_P(int code, const char *type, const char *content) { send(code, type, content); }
+    void send(AsyncWebServerResponse *r) { response_.reset(r); }
+
+    AsyncResponseStream *beginResponseStream(const char *type) {
+        AsyncResponseStream *r = new AsyncResponseStream();
+        r->content_type = type;
+        return r;
+    }
+
+    AsyncWebServerResponse *beginChunkedResponse(const char *type, AwsResponseFiller filler) {
+        AsyncWebServerResponse *r = new AsyncWebServerResponse();
+        r->content_type = type;
+        r->filler = filler;
+        return r;
+    }
+
+    void redirect(const char *url) {
+        send(302, "text/plain", "");
+        response_->addHeader("Location", url);
+    }
+
+    const std::string &path() const { return path_; }
+    WebRequestMethod method() const { return method_; }
+    std::unique_ptr<AsyncWebServerResponse> &response() { return response_; }
+
+private:
+    void parse(const std::string &q, bool post) {
+        size_t pos = 0;
+        while (pos <= q.size() && !q.empty()) {
+            size_t amp = q.find('&', pos);
+            std::string kv = q.substr(pos, amp == std::string::npos ? std::string::npos : amp - pos);
+            size_t eq = kv.find('=');
+            if (!kv.empty()) {
+                params_.push_back({post, std::unique_ptr<AsyncWebParameter>(new AsyncWebParameter(
+                    String(kv.substr(0, eq)), String(eq == std::string::npos ? "" : kv.substr(eq + 1))))});
+            }
+            if (amp == std::string::npos) break;
+            pos = amp + 1;
+        }
+    }
+
+    AsyncWebParameter *find(const char *name, bool post) const {
+        for (auto &p : params_) {
+            if (p.post == post && p.param->name() == name) return p.param.get();
+        }
+        return nullptr;
+    }
+
+    struct Param {
+        bool post;
+        std::unique_ptr<AsyncWebParameter> param;
+    };
+
+    WebRequestMethod method_;
+    std::string path_;
+    std::vector<Param> params_;
+    std::unique_ptr<AsyncWebServerResponse> response_;
+};
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index,
+                           uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                           size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+};
+
+// Server-sent events. The simulator attaches virtual clients that only count
+// what they receive.
+class AsyncEventSourceClient {
+public:
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        (void)message; (void)event; (void)id; (void)reconnect;
+        messages++;
+    }
+    uint32_t messages = 0;
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+    typedef std::function<void(AsyncEventSourceClient *client)> ArEventHandlerFunction;
+
+    explicit AsyncEventSource(const char *url) : url_(url) {}
+
+    void onConnect(ArEventHandlerFunction fn) { on_connect_ = fn; }
+    size_t count() const { std::lock_guard<std::mutex> lock(mtx_); return clients_.size(); }
+
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        for (auto &c : clients_) c->send(message, event, id, reconnect);
+        sent_[event ? event : ""]++;
+    }
+
+    AsyncEventSourceClient *sim_connect() {
+        AsyncEventSourceClient *c;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            clients_.emplace_back(new AsyncEventSourceClient());
+            c = clients_.back().get();
+        }
+        if (on_connect_) on_connect_(c);
+        return c;
+    }
+
+    uint32_t sim_sent(const char *event) const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto it = sent_.find(event);
+        return it == sent_.end() ? 0 : it->second;
+    }
+
+    const char *url() const { return url_; }
+
+private:
+    const char *url_;
+    ArEventHandlerFunction on_connect_;
+    mutable std::mutex mtx_;
+    std::vector<std::unique_ptr<AsyncEventSourceClient>> clients_;
+    std::map<std::string, uint32_t> sent_;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) { (void)port; }
+
+    void on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn) {
+        routes_.push_back({uri, method, fn, nullptr});
+    }
+    // Raw request bodies go to `body` in TCP-sized chunks, then `fn` answers.
+    void on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn,
+            ArUploadHandlerFunction upload, ArBodyHandlerFunction body) {
+        (void)upload;
+        routes_.push_back({uri, method, fn, body});
+    }
+    void addHandler(AsyncWebHandler *h) { (void)h; }
+    void begin() { started_ = true; }
+
+    // Runs the handler for `url` (query string allowed) like a browser request.
+    // Chunked bodies are pulled until `max_body` bytes or `timeout_ms` passed.
+    std::unique_ptr<AsyncWebServerResponse> sim_request(WebRequestMethod method, const std::string &url,
+                                                        const std::string &post_body = "",
+                                                        size_t max_body = 0, uint32_t timeout_ms = 0) {
+        AsyncWebServerRequest req(method, url);
+        for (auto &r : routes_) {
+            if (r.uri == req.path() && (r.method & method)) {
+                if (method == HTTP_POST && r.body) {
+                    for (size_t i = 0; i < post_body.size(); i += 1436) {
+                        size_t n = post_body.size() - i < 1436 ? post_body.size() - i : 1436;
+                        r.body(&req, (uint8_t *)post_body.data() + i, n, i, post_body.size());
+                    }
+                } else if (method == HTTP_POST) {
+                    req.add_post(post_body);
+                }
+                r.fn(&req);
+                break;
+            }
+        }
+        std::unique_ptr<AsyncWebServerResponse> res = std::move(req.response());
+        if (!res) {
+            res.reset(new AsyncWebServerResponse());
+            res->code = 404;
+        }
+        if (res->filler) {
+            pull(*res, max_body, timeout_ms);
+            res->filler = nullptr;
+        }
+        return res;
+    }
+
+    bool started() const { return started_; }
+
+private:
+    static void pull(AsyncWebServerResponse &res, size_t max_body, uint32_t timeout_ms) {
+        uint8_t buf[1460];
+        unsigned long start = millis();
+        while (res.body.size() < max_body && millis() - start < timeout_ms) {
+            size_t n = res.filler(buf, sizeof(buf), res.body.size());
+            if (n == RESPONSE_TRY_AGAIN) { delay(1); continue; }
+            if (n == 0) break;
+            res.body.append((const char *)buf, n);
+        }
+    }
+
+    struct Route {
+        std::string uri;
+        WebRequestMethodComposite method;
+        ArRequestHandlerFunction fn;
+        ArBodyHandlerFunction body;
+    };
+    std::vector<Route> routes_;
+    bool started_ = false;
+};
+
+#endif // SIM_ESPASYNCWEBSERVER_H
@@ -0,0 +1,82 @@
+#ifndef SIM_LIQUIDCRYSTAL_I2C_H
+#define SIM_LIQUIDCRYSTAL_I2C_H
+
+// Host stand-in for a PCF8574-backed HD44780. Keeps the character grid and
+// charges roughly what the I2C transfers cost on the board (100 kHz, 4-bit
+// mode), so actuation time in the simulator is in the right range.
+// Set LiquidCrystal_I2C::sim_timing = false to make the display free.
+
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include "Arduino.h"
+
+class LiquidCrystal_I2C : public Print {
+public:
+    using Print::write;
+
+    static bool sim_timing;
+    static const uint32_t kByteUs = 450;       // one data/command byte on the bus
+    static const uint32_t kClearUs = 2000;     // clear/home execution time
+
+    LiquidCrystal_I2C(uint8_t addr, uint8_t cols, uint8_t rows) : cols_(cols), rows_(rows) {
+        (void)addr;
+        blank();
+    }
+
+    void init() { clear(); }
+    void begin() { clear(); }
+    void backlight() { bus(1, 0); }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        blank();
+        col_ = row_ = 0;
+        commands_++;
+        bus(1, kClearUs);
+    }
+
+    void setCursor(uint8_t col, uint8_t row) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        col_ = col;
+        row_ = row < rows_ ? row : rows_ - 1;
+        commands_++;
+        bus(1, 0);
+    }
+
+    size_t write(uint8_t c) override {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (col_ < cols_) grid_[row_][col_] = (char)c;
+        col_++;
+        chars_++;
+        bus(1, 0);
+        return 1;
+    }
+
+    // Snapshot of one row, NUL terminated.
+    void row_text(uint8_t row, char *out) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        memcpy(out, grid_[row], cols_);
+        out[cols_] = '\0';
+    }
+
+    uint32_t chars_written() const { return chars_; }
+    uint32_t commands() const { return commands_; }
+
+private:
+    void blank() { memset(grid_, ' ', sizeof(grid_)); }
+
+    static void bus(uint32_t bytes, uint32_t extra_us) {
+        if (!sim_timing) return;
+        std::this_thread::sleep_for(std::chrono::microseconds(bytes * kByteUs + extra_us));
+    }
+
+    uint8_t cols_, rows_;
+    uint8_t col_ = 0, row_ = 0;
+    char grid_[4][40];
+    uint32_t chars_ = 0;
+    uint32_t commands_ = 0;
+    std::mutex mtx_;
+};
+
+#endif // SIM_LIQUIDCRYSTAL_I2C_H
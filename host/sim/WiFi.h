@@ -0,0 +1,32 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+// Host stand-in for WiFi.h: always connected, on the loopback address.
+
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+
+class IPAddress : public Printable {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : b_{a, b, c, d} {}
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+        return String(buf);
+    }
+    size_t printTo(Print &p) const override { return p.print(toString()); }
+private:
+    uint8_t b_[4];
+};
+
+class WiFiClass {
+public:
+    void begin(const char *, const char *) {}
+    void setSleep(bool) {}
+    wl_status_t status() { return WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+};
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
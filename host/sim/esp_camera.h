@@ -0,0 +1,76 @@
+#ifndef SIM_ESP_CAMERA_H
+#define SIM_ESP_CAMERA_H
+
+// Host stand-in for esp32-camera. Frames come from the JPEG files of the
+// directory given to sim_camera_open(), re-encoded once to the configured
+// frame size, and are handed out as fast as they are asked for.
+// fmt2rgb888() decodes with libjpeg into BGR order, like the driver.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK      0
+#define ESP_FAIL    -1
+
+#define OV2640_PID  0x26
+#define OV3660_PID  0x3660
+
+typedef enum { PIXFORMAT_RGB565, PIXFORMAT_YUV422, PIXFORMAT_GRAYSCALE, PIXFORMAT_JPEG, PIXFORMAT_RGB888 } pixformat_t;
+typedef enum { FRAMESIZE_96X96, FRAMESIZE_QQVGA, FRAMESIZE_QVGA = 5, FRAMESIZE_VGA = 8 } framesize_t;
+typedef enum { LEDC_TIMER_0 } ledc_timer_t;
+typedef enum { LEDC_CHANNEL_0 } ledc_channel_t;
+typedef enum { CAMERA_FB_IN_PSRAM, CAMERA_FB_IN_DRAM } camera_fb_location_t;
+typedef enum { CAMERA_GRAB_WHEN_EMPTY, CAMERA_GRAB_LATEST } camera_grab_mode_t;
+
+typedef struct {
+    int pin_pwdn;
+    int pin_reset;
+    int pin_xclk;
+    int pin_sccb_sda;
+    int pin_sccb_scl;
+    int pin_d7, pin_d6, pin_d5, pin_d4, pin_d3, pin_d2, pin_d1, pin_d0;
+    int pin_vsync;
+    int pin_href;
+    int pin_pclk;
+    int xclk_freq_hz;
+    ledc_timer_t ledc_timer;
+    ledc_channel_t ledc_channel;
+    pixformat_t pixel_format;
+    framesize_t frame_size;
+    int jpeg_quality;
+    size_t fb_count;
+    camera_fb_location_t fb_location;
+    camera_grab_mode_t grab_mode;
+} camera_config_t;
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t width;
+    size_t height;
+    pixformat_t format;
+} camera_fb_t;
+
+typedef struct sensor {
+    struct { uint16_t PID; } id;
+    int (*set_vflip)(struct sensor *, int);
+    int (*set_brightness)(struct sensor *, int);
+    int (*set_saturation)(struct sensor *, int);
+    int (*set_framesize)(struct sensor *, framesize_t);
+} sensor_t;
+
+esp_err_t esp_camera_init(const camera_config_t *config);
+camera_fb_t *esp_camera_fb_get();
+void esp_camera_fb_return(camera_fb_t *fb);
+sensor_t *esp_camera_sensor_get();
+bool fmt2rgb888(const uint8_t *src, size_t src_len, pixformat_t format, uint8_t *rgb_buf);
+
+// Simulator controls
+bool sim_camera_open(const char *dir, unsigned loops);
+size_t sim_camera_files();
+uint32_t sim_camera_served();           // frames handed out so far
+bool sim_camera_done();                 // every file served `loops` times
+const char *sim_camera_file(uint32_t frame);    // source file of the n-th frame served
+
+#endif // SIM_ESP_CAMERA_H
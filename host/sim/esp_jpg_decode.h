@@ -0,0 +1,21 @@
+#ifndef SIM_ESP_JPG_DECODE_H
+#define SIM_ESP_JPG_DECODE_H
+
+// Host stand-in for esp32-camera's streaming JPEG decoder. Reads the whole
+// JPEG through `reader`, decodes it with libjpeg and hands the RGB888 pixels
+// to `writer` in 16x16 blocks, left to right and band by band like the
+// driver's MCUs, between a start (0, 0, w, h, NULL) and an end
+// (w, h, w, h, NULL) call.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+
+typedef enum { JPG_SCALE_NONE, JPG_SCALE_2X, JPG_SCALE_4X, JPG_SCALE_8X, JPG_SCALE_MAX = JPG_SCALE_8X } jpg_scale_t;
+
+typedef size_t (*jpg_reader_cb)(void *arg, size_t index, uint8_t *buf, size_t len);
+typedef bool (*jpg_writer_cb)(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data);
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void *arg);
+
+#endif // SIM_ESP_JPG_DECODE_H
@@ -0,0 +1,227 @@
+// Host firmware simulator: runs Esp32CAM.cpp's setup()/loop() and its
+// pipeline tasks against the mocks in this directory, replays a directory of
+// JPEGs through the camera as fast as the pipeline takes them, then reports
+// throughput, per-stage latency (from the firmware's own /telemetry) and the
+// servo decisions. Build with ../build_sim.sh.
+//
+//   esp32cam_sim <jpeg_dir> [--loops N] [--delay MS] [--deadline MS] [--keyframe N]
+//                [--gate LEVELS] [--model FILE.eim] [--swap-at FRAME]
+//                [--kernels reference|avx2|avx512] [--threads N] [--no-io-delays] [--csv] [--verbose]
+//                [--allocs FILE]
+//
+// --allocs writes the firmware's /allocs JSON (allocation profile) to FILE;
+// it needs a build with CFLAGS="-O2 -DEIDSP_TRACK_ALLOCATIONS=1
+// -DEIDSP_PRINT_ALLOCATIONS=0", see ../alloc_report.cpp.
+//
+// A build with CFLAGS="-O2 -DEI_EXTRA_IMPULSE=ei_default_impulse" runs the
+// built-in model a second time on every sorted frame (multi_impulse.h); the
+// report then has an "extra impulses" line from /data.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+#include "ESPAsyncWebServer.h"
+#include "ESP32Servo.h"
+#include "LiquidCrystal_I2C.h"
+#include "esp_camera.h"
+#include "../telemetry_stats.h"
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+#include "edge-impulse-sdk/porting/x86/ei_thread_pool.h"
+
+void setup();
+void loop();
+
+// firmware globals
+extern AsyncWebServer server;
+extern AsyncEventSource events;
+extern Servo myservo;
+extern LiquidCrystal_I2C lcd;
+
+struct SimOptions {
+    const char *dir = nullptr;
+    unsigned loops = 1;
+    int delay_ms = 0;           // firmware default is 1000; replay as fast as possible
+    int deadline_ms = 0;
+    int keyframe = 1;
+    int gate = 0;
+    const char *model = nullptr;  // model image POSTed to /model ...
+    long swap_at = 0;             // ... once this frame was classified
+    x86_nn_level_t kernels = X86_NN_LEVEL_AVX512_VNNI;   // cap on the SIMD kernels
+    int threads = 0;              // intra-op threads, 0 = one per core
+    bool io_delays = true;
+    bool csv = false;
+    bool verbose = false;
+    const char *allocs = nullptr;
+};
+
+static bool parse_args(int argc, char **argv, SimOptions &o) {
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_val = i + 1 < argc;
+        if (!strcmp(a, "--loops") && has_val) o.loops = atoi(argv[++i]);
+        else if (!strcmp(a, "--delay") && has_val) o.delay_ms = atoi(argv[++i]);
+        else if (!strcmp(a, "--deadline") && has_val) o.deadline_ms = atoi(argv[++i]);
+        else if (!strcmp(a, "--keyframe") && has_val) o.keyframe = atoi(argv[++i]);
+        else if (!strcmp(a, "--gate") && has_val) o.gate = atoi(argv[++i]);
+        else if (!strcmp(a, "--model") && has_val) o.model = argv[++i];
+        else if (!strcmp(a, "--swap-at") && has_val) o.swap_at = atol(argv[++i]);
+        else if (!strcmp(a, "--kernels") && has_val) {
+            const char *k = argv[++i];
+            if (!strcmp(k, "reference")) o.kernels = X86_NN_LEVEL_NONE;
+            else if (!strcmp(k, "avx2")) o.kernels = X86_NN_LEVEL_AVX2;
+            else if (!strcmp(k, "avx512")) o.kernels = X86_NN_LEVEL_AVX512_VNNI;
+            else return false;
+        }
+        else if (!strcmp(a, "--threads") && has_val) o.threads = atoi(argv[++i]);
+        else if (!strcmp(a, "--no-io-delays")) o.io_delays = false;
+        else if (!strcmp(a, "--csv")) o.csv = true;
+        else if (!strcmp(a, "--verbose")) o.verbose = true;
+        else if (!strcmp(a, "--allocs") && has_val) o.allocs = argv[++i];
+        else if (a[0] != '-' && !o.dir) o.dir = a;
+        else return false;
+    }
+    return o.dir != nullptr;
+}
+
+// "frame" of the latest detection, from /data
+static long current_frame() {
+    auto res = server.sim_request(HTTP_GET, "/data");
+    const char *p = strstr(res->body.c_str(), "\"frame\":");
+    return p ? atol(p + 8) : -1;
+}
+
+static const char *decision_name(uint8_t d) {
+    return d == TELEMETRY_BALL ? "ball" : d == TELEMETRY_BOX ? "box" : "none";
+}
+
+int main(int argc, char **argv) {
+    SimOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        fprintf(stderr, "usage: %s <jpeg_dir> [--loops N] [--delay MS] [--deadline MS] [--keyframe N] "
+                        "[--gate LEVELS] [--model FILE.eim] [--swap-at FRAME] [--kernels reference|avx2|avx512] "
+                        "[--threads N] [--no-io-delays] [--csv] [--verbose] [--allocs FILE]\n",
+                argv[0]);
+        return 1;
+    }
+    std::string model;
+    if (opt.model) {
+        FILE *f = fopen(opt.model, "rb");
+        if (!f) { perror(opt.model); return 1; }
+        char chunk[4096];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) model.append(chunk, n);
+        fclose(f);
+    }
+    if (!sim_camera_open(opt.dir, opt.loops)) {
+        fprintf(stderr, "%s: no JPEG files\n", opt.dir);
+        return 1;
+    }
+    Serial.quiet = !opt.verbose;
+    LiquidCrystal_I2C::sim_timing = opt.io_delays;
+    x86_nn_set_max_level(opt.kernels);
+    ei_thread_pool_set_size(opt.threads);
+
+    // the pipeline starts at the end of setup(), so apply the settings right away
+    uint32_t t_setup = micros();
+    setup();
+    uint32_t t_start = micros();
+    char form[96];
+    snprintf(form, sizeof(form), "delay=%d&deadline=%d&keyframe=%d&gate=%d",
+             opt.delay_ms, opt.deadline_ms, opt.keyframe, opt.gate);
+    server.sim_request(HTTP_POST, "/setup", form);
+    AsyncEventSourceClient *page = events.sim_connect();
+    std::thread([] { for (;;) loop(); }).detach();     // Arduino's loopTask
+
+    // done once the camera ran dry and the last frame stopped changing
+    long last = -1;
+    uint32_t t_last = t_start;
+    for (;;) {
+        delay(5);
+        long frame = current_frame();
+        if (opt.model && frame >= opt.swap_at) {
+            // upload while the pipeline keeps classifying, like a browser would
+            uint32_t t0 = micros();
+            auto up = server.sim_request(HTTP_POST, "/model", model);
+            printf("model upload at frame %ld: %d %s (%.1f ms)\n", frame, up->code, up->body.c_str(),
+                   (micros() - t0) / 1000.0);
+            opt.model = nullptr;
+        }
+        if (frame != last) { last = frame; t_last = micros(); continue; }
+        if (sim_camera_done() && micros() - t_last > 500000u) break;
+    }
+
+    auto res = server.sim_request(HTTP_GET, "/telemetry", "", sizeof(TelemetryHeader) + sizeof(TelemetryRecord) * TELEMETRY_RECORDS, 2000);
+    TelemetryHeader hdr;
+    std::vector<TelemetryRecord> recs;
+    if (!telemetry_parse((const uint8_t *)res->body.data(), res->body.size(), hdr, recs)) {
+        fprintf(stderr, "/telemetry: bad response (%d)\n", res->code);
+        return 1;
+    }
+
+    if (opt.allocs) {
+        auto profile = server.sim_request(HTTP_GET, "/allocs");
+        if (profile->code != 200) {
+            fprintf(stderr, "/allocs: %d, build with -DEIDSP_TRACK_ALLOCATIONS=1\n", profile->code);
+            return 1;
+        }
+        FILE *f = fopen(opt.allocs, "w");
+        if (!f || fwrite(profile->body.data(), 1, profile->body.size(), f) != profile->body.size()) {
+            perror(opt.allocs);
+            return 1;
+        }
+        fclose(f);
+    }
+
+    if (opt.csv) {
+        printf("frame,file,decision,confidence_pct,servo_angle,latency_us,tracked,gated\n");
+        for (const TelemetryRecord &r : recs) {
+            printf("%u,%s,%s,%u,%u,%u,%d,%d\n", r.frame_id, sim_camera_file(r.frame_id),
+                   decision_name(r.decision), r.confidence_pct, r.servo_angle, r.latency_us,
+                   (r.flags & TELEMETRY_FLAG_TRACKED) != 0, (r.flags & TELEMETRY_FLAG_GATED) != 0);
+        }
+        fflush(stdout);
+        _Exit(0);
+    }
+
+    uint32_t served = sim_camera_served();
+    uint32_t processed = hdr.count + hdr.dropped;
+    double run_s = (t_last - t_start) / 1e6;
+    printf("setup: %.1f ms\n", (t_start - t_setup) / 1000.0);
+    printf("kernels: %s, %d thread(s)\n", x86_nn_level_name(x86_nn_level()), ei_thread_pool_size());
+    printf("frames: %u served by the camera (%zu files x %u), %u classified, %u skipped\n",
+           served, sim_camera_files(), opt.loops, processed, served - processed);
+    printf("throughput: %.2f fps end to end over %.2f s\n", run_s > 0 ? processed / run_s : 0.0, run_s);
+    if (hdr.dropped) printf("stage table covers the last %zu frames\n", recs.size());
+    printf("\n");
+    telemetry_print_stages(recs);
+    printf("\n");
+    telemetry_print_decisions(recs);
+    if (opt.gate) {
+        auto data = server.sim_request(HTTP_GET, "/data");
+        const char *c = strstr(data->body.c_str(), "\"cascade\":");
+        if (c) printf("cascade: %.*s\n", (int)strcspn(c + 10, "}") + 1, c + 10);
+    }
+    {
+        auto data = server.sim_request(HTTP_GET, "/data");
+        const char *r = strstr(data->body.c_str(), "\"region\":");
+        if (r) printf("inference region: %.*s\n", (int)strcspn(r + 9, "}") + 1, r + 9);
+        const char *st = strstr(data->body.c_str(), "\"stage_ms\":");
+        if (st) printf("scheduler stage averages (ms): %.*s\n", (int)strcspn(st + 11, "}") + 1, st + 11);
+        const char *x = strstr(data->body.c_str(), "\"extra\":");
+        if (x) printf("extra impulses: %.*s\n", (int)strcspn(x + 8, "]") + 1, x + 8);
+    }
+    if (!model.empty()) printf("model: %s\n", server.sim_request(HTTP_GET, "/model")->body.c_str());
+    printf("servo: %u writes, %u moves (0 deg: %u, 45 deg: %u, 90 deg: %u)\n",
+           myservo.writes(), myservo.moves(), myservo.writes_at(0), myservo.writes_at(45), myservo.writes_at(90));
+    printf("lcd: %u chars, %u commands\n", lcd.chars_written(), lcd.commands());
+    printf("events: %u status, %u boxes (page received %u)\n",
+           events.sim_sent("status"), events.sim_sent("boxes"), page->messages);
+
+    // the pipeline tasks never return; leave without running destructors under them
+    fflush(stdout);
+    _Exit(0);
+}
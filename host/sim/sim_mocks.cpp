@@ -0,0 +1,281 @@
+// Runtime behind the host stand-ins: Arduino time base, Serial/WiFi/Wire
+// instances and the replaying camera (libjpeg).
+
+#include <stdio.h>
+#include <string.h>
+#include <jpeglib.h>
+#include <setjmp.h>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+#include "Wire.h"
+#include "LiquidCrystal_I2C.h"
+#include "esp_camera.h"
+#include "esp_jpg_decode.h"
+#include "../file_camera.h"
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+TwoWire Wire;
+bool LiquidCrystal_I2C::sim_timing = true;
+
+static const auto boot = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - boot).count();
+}
+
+// same clock as hal_micros() on the host, the firmware mixes the two
+unsigned long micros() {
+    return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ---- libjpeg helpers -------------------------------------------------------
+
+struct JpegError {
+    jpeg_error_mgr mgr;
+    jmp_buf jump;
+};
+
+static void jpeg_error_exit(j_common_ptr cinfo) {
+    longjmp(((JpegError *)cinfo->err)->jump, 1);
+}
+
+// Decodes to interleaved RGB. Returns false on a corrupt stream.
+static bool jpeg_decode(const uint8_t *src, size_t len, std::vector<uint8_t> &rgb, int *w, int *h) {
+    jpeg_decompress_struct cinfo;
+    JpegError err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = jpeg_error_exit;
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, (unsigned char *)src, (unsigned long)len);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    jpeg_start_decompress(&cinfo);
+    *w = cinfo.output_width;
+    *h = cinfo.output_height;
+    rgb.resize((size_t)*w * *h * 3);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW row = rgb.data() + (size_t)cinfo.output_scanline * *w * 3;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+static bool jpeg_encode(const uint8_t *rgb, int w, int h, int quality, std::vector<uint8_t> &out) {
+    jpeg_compress_struct cinfo;
+    JpegError err;
+    unsigned char *mem = nullptr;
+    unsigned long mem_len = 0;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = jpeg_error_exit;
+    if (setjmp(err.jump)) {
+        jpeg_destroy_compress(&cinfo);
+        free(mem);
+        return false;
+    }
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &mem, &mem_len);
+    cinfo.image_width = w;
+    cinfo.image_height = h;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        JSAMPROW row = (JSAMPROW)rgb + (size_t)cinfo.next_scanline * w * 3;
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    out.assign(mem, mem + mem_len);
+    jpeg_destroy_compress(&cinfo);
+    free(mem);
+    return true;
+}
+
+// Bilinear scale, standing in for the sensor's own windowing/scaling.
+static void scale_rgb(const std::vector<uint8_t> &src, int sw, int sh, std::vector<uint8_t> &dst, int dw, int dh) {
+    dst.resize((size_t)dw * dh * 3);
+    for (int y = 0; y < dh; y++) {
+        float fy = (y + 0.5f) * sh / dh - 0.5f;
+        int y0 = fy < 0 ? 0 : (int)fy;
+        int y1 = y0 + 1 < sh ? y0 + 1 : sh - 1;
+        float wy = fy - y0 < 0 ? 0 : fy - y0;
+        for (int x = 0; x < dw; x++) {
+            float fx = (x + 0.5f) * sw / dw - 0.5f;
+            int x0 = fx < 0 ? 0 : (int)fx;
+            int x1 = x0 + 1 < sw ? x0 + 1 : sw - 1;
+            float wx = fx - x0 < 0 ? 0 : fx - x0;
+            for (int c = 0; c < 3; c++) {
+                float a = src[((size_t)y0 * sw + x0) * 3 + c] * (1 - wx) + src[((size_t)y0 * sw + x1) * 3 + c] * wx;
+                float b = src[((size_t)y1 * sw + x0) * 3 + c] * (1 - wx) + src[((size_t)y1 * sw + x1) * 3 + c] * wx;
+                dst[((size_t)y * dw + x) * 3 + c] = (uint8_t)(a * (1 - wy) + b * wy + 0.5f);
+            }
+        }
+    }
+}
+
+// ---- camera ----------------------------------------------------------------
+
+#define SIM_CAMERA_MAX_FB 8
+
+static struct {
+    std::mutex mtx;
+    std::vector<std::vector<uint8_t>> jpegs;    // one QVGA JPEG per source file
+    std::vector<std::string> names;
+    std::vector<uint32_t> served_file;          // file index per served frame
+    unsigned loops = 1;
+    int width = 320, height = 240;
+    camera_fb_t fbs[SIM_CAMERA_MAX_FB];
+    bool fb_used[SIM_CAMERA_MAX_FB];
+    size_t fb_count = 1;
+    bool initialised = false;
+} cam;
+
+static int sim_noop(sensor_t *, int) { return 0; }
+static int sim_framesize(sensor_t *, framesize_t) { return 0; }
+static sensor_t sim_sensor = {{OV2640_PID}, sim_noop, sim_noop, sim_noop, sim_framesize};
+
+static bool frame_dims(framesize_t fs, int *w, int *h) {
+    switch (fs) {
+    case FRAMESIZE_96X96: *w = 96;  *h = 96;  return true;
+    case FRAMESIZE_QQVGA: *w = 160; *h = 120; return true;
+    case FRAMESIZE_QVGA:  *w = 320; *h = 240; return true;
+    case FRAMESIZE_VGA:   *w = 640; *h = 480; return true;
+    }
+    return false;
+}
+
+bool sim_camera_open(const char *dir, unsigned loops) {
+    FileCamera files;
+    if (!files.open(dir)) return false;
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    cam.loops = loops ? loops : 1;
+    for (size_t i = 0; i < files.count(); i++) {
+        std::vector<uint8_t> raw, rgb;
+        int w, h;
+        if (!files.next_bytes(raw)) continue;
+        if (!jpeg_decode(raw.data(), raw.size(), rgb, &w, &h)) {
+            fprintf(stderr, "camera: skipping %s (not a JPEG)\n", files.current().c_str());
+            continue;
+        }
+        if (w != 320 || h != 240) {
+            std::vector<uint8_t> scaled;
+            scale_rgb(rgb, w, h, scaled, 320, 240);
+            if (!jpeg_encode(scaled.data(), 320, 240, 80, raw)) continue;
+        }
+        cam.jpegs.push_back(raw);
+        cam.names.push_back(files.current());
+    }
+    return !cam.jpegs.empty();
+}
+
+size_t sim_camera_files() { return cam.jpegs.size(); }
+
+uint32_t sim_camera_served() {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    return cam.served_file.size();
+}
+
+bool sim_camera_done() {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    return cam.served_file.size() >= cam.jpegs.size() * cam.loops;
+}
+
+const char *sim_camera_file(uint32_t frame) {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    if (frame >= cam.served_file.size()) return "?";
+    return cam.names[cam.served_file[frame]].c_str();
+}
+
+esp_err_t esp_camera_init(const camera_config_t *config) {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    if (cam.jpegs.empty()) return ESP_FAIL;
+    if (config->pixel_format != PIXFORMAT_JPEG) return ESP_FAIL;
+    if (!frame_dims(config->frame_size, &cam.width, &cam.height)) return ESP_FAIL;
+    if (cam.width != 320 || cam.height != 240) return ESP_FAIL;    // frames are prepared as QVGA
+    cam.fb_count = config->fb_count < SIM_CAMERA_MAX_FB ? config->fb_count : SIM_CAMERA_MAX_FB;
+    if (!cam.fb_count) cam.fb_count = 1;
+    cam.initialised = true;
+    return ESP_OK;
+}
+
+camera_fb_t *esp_camera_fb_get() {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    if (!cam.initialised) return nullptr;
+    size_t n = cam.served_file.size();
+    if (n >= cam.jpegs.size() * cam.loops) return nullptr;
+    for (size_t i = 0; i < cam.fb_count; i++) {
+        if (cam.fb_used[i]) continue;
+        uint32_t file = (uint32_t)(n % cam.jpegs.size());
+        std::vector<uint8_t> &jpeg = cam.jpegs[file];
+        cam.fb_used[i] = true;
+        cam.fbs[i].buf = jpeg.data();
+        cam.fbs[i].len = jpeg.size();
+        cam.fbs[i].width = cam.width;
+        cam.fbs[i].height = cam.height;
+        cam.fbs[i].format = PIXFORMAT_JPEG;
+        cam.served_file.push_back(file);
+        return &cam.fbs[i];
+    }
+    return nullptr;     // every driver buffer is still held
+}
+
+void esp_camera_fb_return(camera_fb_t *fb) {
+    std::lock_guard<std::mutex> lock(cam.mtx);
+    if (fb >= cam.fbs && fb < cam.fbs + SIM_CAMERA_MAX_FB) cam.fb_used[fb - cam.fbs] = false;
+}
+
+sensor_t *esp_camera_sensor_get() { return &sim_sensor; }
+
+bool fmt2rgb888(const uint8_t *src, size_t src_len, pixformat_t format, uint8_t *rgb_buf) {
+    if (format != PIXFORMAT_JPEG) return false;
+    std::vector<uint8_t> rgb;
+    int w, h;
+    if (!jpeg_decode(src, src_len, rgb, &w, &h)) return false;
+    // the driver's decoder writes B, G, R
+    for (size_t i = 0; i < rgb.size(); i += 3) {
+        rgb_buf[i] = rgb[i + 2];
+        rgb_buf[i + 1] = rgb[i + 1];
+        rgb_buf[i + 2] = rgb[i];
+    }
+    return true;
+}
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void *arg) {
+    if (scale != JPG_SCALE_NONE) return ESP_FAIL;
+    std::vector<uint8_t> src(len);
+    if (reader(arg, 0, src.data(), len) != len) return ESP_FAIL;
+    std::vector<uint8_t> rgb;
+    int w, h;
+    if (!jpeg_decode(src.data(), len, rgb, &w, &h)) return ESP_FAIL;
+    if (!writer(arg, 0, 0, w, h, nullptr)) return ESP_FAIL;
+    uint8_t block[16 * 16 * 3];
+    for (int by = 0; by < h; by += 16) {
+        for (int bx = 0; bx < w; bx += 16) {
+            int bw = w - bx < 16 ? w - bx : 16, bh = h - by < 16 ? h - by : 16;
+            for (int y = 0; y < bh; y++) {
+                memcpy(block + y * bw * 3, rgb.data() + ((size_t)(by + y) * w + bx) * 3, bw * 3);
+            }
+            if (!writer(arg, bx, by, bw, bh, block)) return ESP_FAIL;
+        }
+    }
+    return writer(arg, w, h, w, h, nullptr) ? ESP_OK : ESP_FAIL;
+}
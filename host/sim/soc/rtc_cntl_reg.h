@@ -0,0 +1,7 @@
+#ifndef SIM_RTC_CNTL_REG_H
+#define SIM_RTC_CNTL_REG_H
+
+#define RTC_CNTL_BROWN_OUT_REG      0
+#define WRITE_PERI_REG(addr, val)   ((void)(addr), (void)(val))
+
+#endif // SIM_RTC_CNTL_REG_H
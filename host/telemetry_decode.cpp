@@ -0,0 +1,58 @@
+// Decodes a /telemetry dump from the sorter and prints per-stage percentiles.
+//
+//   curl -o telemetry.bin http://<esp32-ip>/telemetry
+//   g++ -std=c++17 -O2 -I.. telemetry_decode.cpp -o telemetry_decode
+//   ./telemetry_decode telemetry.bin [--csv]
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "telemetry_stats.h"
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s telemetry.bin [--csv]\n", argv[0]);
+        return 1;
+    }
+    bool csv = argc > 2 && strcmp(argv[2], "--csv") == 0;
+
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 1; }
+    std::vector<uint8_t> buf;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) buf.insert(buf.end(), chunk, chunk + n);
+    fclose(f);
+
+    TelemetryHeader hdr;
+    std::vector<TelemetryRecord> recs;
+    if (!telemetry_parse(buf.data(), buf.size(), hdr, recs)) {
+        fprintf(stderr, "%s: not a telemetry dump of this version\n", argv[1]);
+        return 1;
+    }
+
+    if (csv) {
+        printf("frame_id,t_ms");
+        for (const TelemetryField &fd : telemetry_fields) printf(",%s", fd.name);
+        printf(",decision,servo_angle,confidence_pct,flags\n");
+        for (const TelemetryRecord &r : recs) {
+            printf("%u,%u", r.frame_id, r.t_ms);
+            for (const TelemetryField &fd : telemetry_fields) printf(",%u", r.*fd.member);
+            printf(",%u,%u,%u,%u\n", r.decision, r.servo_angle, r.confidence_pct, r.flags);
+        }
+        return 0;
+    }
+
+    printf("records: %zu (older dropped: %u)\n", recs.size(), hdr.dropped);
+    if (recs.size() > 1) {
+        double span_s = (recs.back().t_ms - recs.front().t_ms) / 1000.0;
+        uint32_t frames = recs.back().frame_id - recs.front().frame_id;
+        if (span_s > 0) printf("span: %.1f s, %.2f fps recorded, %u frames captured\n",
+                               span_s, (recs.size() - 1) / span_s, frames);
+    }
+    printf("\n");
+    telemetry_print_stages(recs);
+    printf("\n");
+    telemetry_print_decisions(recs);
+    return 0;
+}
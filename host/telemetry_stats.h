@@ -0,0 +1,73 @@
+#ifndef HOST_TELEMETRY_STATS_H
+#define HOST_TELEMETRY_STATS_H
+
+// Per-stage percentile table over TelemetryRecords, shared by
+// telemetry_decode and the firmware simulator.
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "../telemetry.h"
+
+struct TelemetryField {
+    const char *name;
+    uint32_t TelemetryRecord::*member;
+};
+
+static const TelemetryField telemetry_fields[] = {
+    {"grab_us",           &TelemetryRecord::grab_us},
+    {"decode_us",         &TelemetryRecord::decode_us},
+    {"dsp_us",            &TelemetryRecord::dsp_us},
+    {"classification_us", &TelemetryRecord::classification_us},
+    {"post_us",           &TelemetryRecord::post_us},
+    {"actuate_us",        &TelemetryRecord::actuate_us},
+    {"latency_us",        &TelemetryRecord::latency_us},
+    {"heap_free",         &TelemetryRecord::heap_free},
+};
+
+static inline uint32_t telemetry_pct(const std::vector<uint32_t> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    return sorted[(size_t)(p * (sorted.size() - 1) + 0.5)];
+}
+
+static inline void telemetry_print_stages(const std::vector<TelemetryRecord> &recs) {
+    printf("%-18s %10s %10s %10s %10s %10s\n", "stage", "p50", "p90", "p99", "max", "mean");
+    for (const TelemetryField &fd : telemetry_fields) {
+        std::vector<uint32_t> v;
+        double sum = 0;
+        for (const TelemetryRecord &r : recs) { v.push_back(r.*fd.member); sum += r.*fd.member; }
+        std::sort(v.begin(), v.end());
+        printf("%-18s %10u %10u %10u %10u %10.0f\n", fd.name,
+               telemetry_pct(v, 0.50), telemetry_pct(v, 0.90), telemetry_pct(v, 0.99),
+               telemetry_pct(v, 1.0), v.empty() ? 0.0 : sum / v.size());
+    }
+}
+
+static inline void telemetry_print_decisions(const std::vector<TelemetryRecord> &recs) {
+    unsigned decisions[3] = {0, 0, 0};
+    unsigned tracked = 0, gated = 0;
+    for (const TelemetryRecord &r : recs) {
+        if (r.decision < 3) decisions[r.decision]++;
+        if (r.flags & TELEMETRY_FLAG_TRACKED) tracked++;
+        if (r.flags & TELEMETRY_FLAG_GATED) gated++;
+    }
+    printf("decisions: none %u, ball %u, box %u\n", decisions[0], decisions[1], decisions[2]);
+    printf("inference: %zu full, %u tracked between keyframes, %u gated as empty\n",
+           recs.size() - tracked - gated, tracked, gated);
+}
+
+// Parses a /telemetry body (header + records). False if it is not one.
+static inline bool telemetry_parse(const uint8_t *buf, size_t len, TelemetryHeader &hdr,
+                                   std::vector<TelemetryRecord> &recs) {
+    if (len < sizeof(hdr)) return false;
+    memcpy(&hdr, buf, sizeof(hdr));
+    if (hdr.magic != TELEMETRY_MAGIC || hdr.record_size != sizeof(TelemetryRecord)) return false;
+    size_t n = (len - sizeof(hdr)) / sizeof(TelemetryRecord);
+    if (n > hdr.count) n = hdr.count;
+    recs.resize(n);
+    if (n) memcpy(recs.data(), buf + sizeof(hdr), n * sizeof(TelemetryRecord));
+    return true;
+}
+
+#endif // HOST_TELEMETRY_STATS_H
@@ -0,0 +1,482 @@
+// Two-tier memory placement for an EON-compiled model: reads
+// tflite-model/<name>_compiled.cpp and decides, for a budget of fast internal
+// SRAM, which activations, which weights and whether the persistent / scratch
+// buffers go there; everything else goes to external RAM (activations,
+// scratch) or stays in flash (weights). Prints the plan with the simulated
+// memory time per inference against all-external and all-internal, and with
+// --write emits it into the model source:
+//   activations  tensorData rows point into tensor_arena (fast) or
+//                tensor_arena_slow, sized by kTensorArenaSize /
+//                kTensorArenaSlowSize
+//   scratch      kTierScratchSlow
+//   weights      FAST_MODEL_SECTION, placed by EI_WEIGHTS_FAST_LOCATION
+//                (".dram1" by default on the ESP32)
+// and sets kTierPlanned. In heap mode (the Arduino default) init then takes
+// each arena from ei_arena_calloc(tier, bytes), which the firmware maps to
+// internal RAM and PSRAM; static arenas are placed by EI_TENSOR_ARENA_LOCATION
+// / EI_TENSOR_ARENA_SLOW_LOCATION (ESP32: .ext_ram.bss, with
+// CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY).
+//
+//   g++ -std=c++17 -O2 tier_plan.cpp -o tier_plan
+//   ./tier_plan ../ei-ballboxbc-arduino-1.0.1/BallBoxBC_inferencing/src/tflite-model/tflite_learn_854371_3_compiled.cpp
+//               [--fast-bytes N] [--sram-ns X] [--psram-ns X] [--flash-ns X] [--cache-bytes N]
+//               [--max-total N] [--nodes] [--write]
+//
+// Cost model: every node touches each of its tensors some number of passes
+// (a KxK / stride s window reads its input K*K/(s*s) times, a conv reads its
+// filter and bias once per output pixel, ADD / PAD / SOFTMAX stream). In
+// SRAM every byte costs sram_ns. In external memory the first pass costs
+// psram_ns (flash_ns for weights) per byte, the rest sram_ns when the tensor
+// fits the cache and the external price when it does not. The persistent /
+// scratch buffers are written and read once per inference, spread over the
+// conv nodes.
+//
+// Each arena is packed the way arena_plan packs one (arena_pack.h: the same
+// lifetimes, ADD / PAD in place when input and output share the arena,
+// greedy first fit). Splitting the arena costs bytes where the fast and slow
+// peaks fall at different nodes, so the two tensor regions together may not
+// exceed --max-total, by default what the single-arena plan takes. The choice
+// starts greedy on saved time per byte, from all-external and from cuts
+// through the single-arena layout, and is improved by single swaps until
+// none helps; the simulator then checks the plan (budget, total, packing,
+// alignment) and that no single move improves it.
+
+#include "arena_pack.h"
+
+struct CostModel {
+    double sram_ns = 1.0;       // per byte, internal SRAM
+    double psram_ns = 25.0;     // external PSRAM through the cache, 40 MHz quad SPI
+    double flash_ns = 25.0;     // weights read from flash through the cache
+    int cache_bytes = 32768;    // flash / PSRAM cache
+};
+
+enum Kind { ACTIVATION, SCRATCH, WEIGHT };
+
+struct Access {
+    int node;
+    double passes;
+};
+
+struct Item {
+    Kind kind;
+    int tensor = -1;            // -1: the persistent / scratch buffers
+    int bytes = 0;
+    int first = 0, last = 0;    // activations: node range, inclusive
+    std::vector<Access> uses;
+    double cost[2] = { 0, 0 };  // ns per inference: [0] external, [1] SRAM
+};
+
+static double access_ns(const Item &it, const Access &a, bool fast, const CostModel &cm) {
+    double bytes = it.bytes;
+    if (fast) return a.passes * bytes * cm.sram_ns;
+    double ext = it.kind == WEIGHT ? cm.flash_ns : cm.psram_ns;
+    double cold = std::min(a.passes, 1.0);
+    double warm = a.passes - cold;
+    return cold * bytes * ext + warm * bytes * (it.bytes <= cm.cache_bytes ? cm.sram_ns : ext);
+}
+
+struct Packing {
+    std::vector<int> offset;    // per item, -1 when not in this arena
+    int region = 0;
+};
+
+// the activations `in` selects as one arena
+static Planner tier_planner(const EonModel &model, const std::vector<Item> &items, const std::vector<bool> &in) {
+    std::vector<bool> member(model.tensors.size(), false);
+    for (size_t i = 0; i < items.size(); i++) {
+        if (in[i] && items[i].kind == ACTIVATION) member[items[i].tensor] = true;
+    }
+    return arena_planner(model, member, true, false);
+}
+
+static Packing pack(const EonModel &model, const std::vector<Item> &items, const std::vector<bool> &in) {
+    Packing p;
+    p.offset.assign(items.size(), -1);
+    Planner planner = tier_planner(model, items, in);
+    Search search(planner);
+    search.greedy();
+    for (size_t i = 0; i < items.size(); i++) {
+        if (items[i].kind == ACTIVATION && planner.buf_of[items[i].tensor] >= 0) {
+            p.offset[i] = search.best_offset[planner.buf_of[items[i].tensor]];
+        }
+    }
+    p.region = search.best;
+    return p;
+}
+
+struct Plan {
+    std::vector<bool> fast;
+    Packing fast_pack, slow_pack;
+    int footprint = 0;          // SRAM bytes: fast arena + scratch + weights
+    int total = 0;              // both tensor regions
+    double ns = 0;
+};
+
+struct Limits {
+    int budget;                 // SRAM bytes
+    int max_total;              // fast + slow tensor regions
+};
+
+static bool fits(const Plan &p, const Limits &lim) {
+    return p.footprint <= lim.budget && p.total <= lim.max_total;
+}
+
+static Plan evaluate(const EonModel &model, const std::vector<Item> &items, const std::vector<bool> &fast) {
+    Plan p;
+    p.fast = fast;
+    std::vector<bool> slow(items.size());
+    for (size_t i = 0; i < items.size(); i++) slow[i] = !fast[i];
+    p.fast_pack = pack(model, items, fast);
+    p.slow_pack = pack(model, items, slow);
+    p.footprint = align_up(p.fast_pack.region);
+    p.total = align_up(p.fast_pack.region) + align_up(p.slow_pack.region);
+    for (size_t i = 0; i < items.size(); i++) {
+        if (fast[i] && items[i].kind != ACTIVATION) p.footprint += align_up(items[i].bytes);
+        p.ns += items[i].cost[fast[i] ? 1 : 0];
+    }
+    return p;
+}
+
+static Plan optimize(const EonModel &model, const std::vector<Item> &items, const Limits &lim) {
+    std::vector<int> order(items.size());
+    for (size_t i = 0; i < items.size(); i++) order[i] = (int)i;
+    auto gain = [&](int i) { return items[i].cost[0] - items[i].cost[1]; };
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return gain(a) / items[a].bytes > gain(b) / items[b].bytes;
+    });
+
+    Plan best = evaluate(model, items, std::vector<bool>(items.size(), false));
+    auto try_fill = [&](Plan &plan) {
+        for (int i : order) {
+            if (plan.fast[i] || gain(i) <= 0) continue;
+            std::vector<bool> f = plan.fast;
+            f[i] = true;
+            Plan p = evaluate(model, items, f);
+            if (fits(p, lim)) plan = p;
+        }
+    };
+    try_fill(best);
+
+    // Moving one tensor at a time rarely fits the total: a fast tensor only
+    // pays for itself once the slow peak it sat in drops too. Cutting the
+    // single-arena layout at an offset and making everything wholly above (or
+    // below) the cut fast costs no bytes when nothing straddles it, so each
+    // such cut seeds the search as well.
+    std::vector<bool> all(items.size(), true);
+    Planner single = tier_planner(model, items, all);
+    Search layout(single);
+    layout.greedy();
+    std::set<int> cuts;
+    for (size_t b = 0; b < single.bufs.size(); b++) cuts.insert(layout.best_offset[b]);
+    for (int cut : cuts) {
+        for (int above = 0; above < 2; above++) {
+            std::vector<bool> f(items.size(), false);
+            for (size_t i = 0; i < items.size(); i++) {
+                if (items[i].kind != ACTIVATION) continue;
+                int at = layout.best_offset[single.buf_of[items[i].tensor]];
+                f[i] = above ? at >= cut : at + items[i].bytes <= cut;
+            }
+            Plan p = evaluate(model, items, f);
+            if (!fits(p, lim)) continue;
+            try_fill(p);
+            if (p.ns < best.ns - 1e-6) best = p;
+        }
+    }
+
+    for (bool improved = true; improved;) {
+        improved = false;
+        for (size_t out = 0; out < items.size() && !improved; out++) {
+            if (!best.fast[out]) continue;
+            for (size_t in = 0; in < items.size() && !improved; in++) {
+                if (best.fast[in] || gain((int)in) <= 0) continue;
+                std::vector<bool> f = best.fast;
+                f[out] = false;
+                f[in] = true;
+                Plan p = evaluate(model, items, f);
+                if (!fits(p, lim)) continue;
+                try_fill(p);
+                if (p.ns < best.ns - 1e-6) {
+                    best = p;
+                    improved = true;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+// the simulator's checks on a finished plan; prints what fails
+static bool validate(const EonModel &model, const std::vector<Item> &items, const Plan &plan, const Limits &lim) {
+    bool ok = true;
+    if (plan.footprint > lim.budget) {
+        fprintf(stderr, "plan: %d SRAM bytes over the %d budget\n", plan.footprint, lim.budget);
+        ok = false;
+    }
+    if (plan.total > lim.max_total) {
+        fprintf(stderr, "plan: arenas take %d bytes, over the %d total\n", plan.total, lim.max_total);
+        ok = false;
+    }
+    for (int tier = 0; tier < 2; tier++) {
+        const Packing &pk = tier ? plan.fast_pack : plan.slow_pack;
+        std::vector<bool> in(items.size());
+        for (size_t a = 0; a < items.size(); a++) {
+            in[a] = plan.fast[a] == (tier == 1);
+            if (items[a].kind == ACTIVATION && (pk.offset[a] >= 0) != in[a]) {
+                fprintf(stderr, "t%d: not placed in its tier\n", items[a].tensor);
+                ok = false;
+            }
+        }
+        Planner planner = tier_planner(model, items, in);
+        std::vector<int> offset(planner.bufs.size(), -1);
+        for (size_t a = 0; a < items.size(); a++) {
+            if (items[a].kind == ACTIVATION && planner.buf_of[items[a].tensor] >= 0) {
+                offset[planner.buf_of[items[a].tensor]] = pk.offset[a];
+            }
+        }
+        ok = arena_offsets_ok(planner, offset) && ok;
+    }
+    // no single move in or out, or swap, that fits and is faster
+    for (size_t a = 0; a < items.size(); a++) {
+        for (size_t b = a; b < items.size(); b++) {
+            std::vector<bool> f = plan.fast;
+            f[a] = !f[a];
+            if (b != a) {
+                if (plan.fast[a] == plan.fast[b]) continue;
+                f[b] = !f[b];
+            }
+            Plan p = evaluate(model, items, f);
+            if (fits(p, lim) && p.ns < plan.ns - 1e-6) {
+                fprintf(stderr, "plan: moving item %zu%s saves %.0f ns\n", a,
+                        b != a ? (" and " + std::to_string(b)).c_str() : "", plan.ns - p.ns);
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+static std::string item_name(const EonModel &model, const Item &it) {
+    if (it.kind == SCRATCH) return "persistent / scratch";
+    const EonTensor &t = model.tensors[it.tensor];
+    std::string dims;
+    for (int d : t.dims) dims += (dims.empty() ? "" : "x") + std::to_string(d);
+    return "t" + std::to_string(it.tensor) + " " + dims + (it.kind == WEIGHT ? " " + t.data : "");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <name>_compiled.cpp [--fast-bytes N] [--sram-ns X] [--psram-ns X] [--flash-ns X] "
+                        "[--cache-bytes N] [--max-total N] [--nodes] [--write]\n", argv[0]);
+        return 1;
+    }
+    CostModel cm;
+    int budget = 64 * 1024, max_total = 0;
+    bool nodes_table = false, write = false;
+    for (int i = 2; i < argc; i++) {
+        bool has_val = i + 1 < argc;
+        if (!strcmp(argv[i], "--fast-bytes") && has_val) budget = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--sram-ns") && has_val) cm.sram_ns = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--psram-ns") && has_val) cm.psram_ns = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--flash-ns") && has_val) cm.flash_ns = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--cache-bytes") && has_val) cm.cache_bytes = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--max-total") && has_val) max_total = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--nodes")) nodes_table = true;
+        else if (!strcmp(argv[i], "--write")) write = true;
+        else { fprintf(stderr, "%s: unknown option %s\n", argv[0], argv[i]); return 1; }
+    }
+
+    EonModel model;
+    if (!eon_read(argv[1], model)) return 1;
+    const int n_nodes = (int)model.nodes.size();
+
+    // arena sizes as they stand, to recover what the persistent / scratch buffers take
+    const std::regex re_size(R"(constexpr int kTensorArenaSize = (\d+);)");
+    const std::regex re_slow_size(R"(constexpr int kTensorArenaSlowSize = (\d+);)");
+    const std::regex re_scratch_slow(R"(constexpr bool kTierScratchSlow = (true|false);)");
+    const std::regex re_planned(R"(constexpr bool kTierPlanned = (true|false);)");
+    int arena_size = 0, slow_size = 0;
+    bool scratch_slow = false, has_tiers = false;
+    for (const std::string &line : model.lines) {
+        std::smatch m;
+        if (std::regex_search(line, m, re_size)) arena_size = atoi(m[1].str().c_str());     // the last one, non-HIMAX
+        else if (std::regex_search(line, m, re_slow_size)) { slow_size = atoi(m[1].str().c_str()); has_tiers = true; }
+        else if (std::regex_search(line, m, re_scratch_slow)) scratch_slow = m[1] == "true";
+    }
+    if (!arena_size || !has_tiers) {
+        fprintf(stderr, "%s: no kTensorArenaSize / kTensorArenaSlowSize, not a two-tier capable model source\n", argv[1]);
+        return 1;
+    }
+
+    // items: arena tensors, the persistent / scratch buffers, weights
+    std::vector<Item> items;
+    std::vector<int> item_of(model.tensors.size(), -1);
+    int fast_end = 0, slow_end = 0;
+    for (size_t t = 0; t < model.tensors.size(); t++) {
+        const EonTensor &et = model.tensors[t];
+        Item it;
+        if (et.arena_offset >= 0 || et.slow_offset >= 0) {
+            it.kind = ACTIVATION;
+            it.first = -1;
+            it.last = -1;
+            if (et.arena_offset >= 0) fast_end = std::max(fast_end, et.arena_offset + et.bytes);
+            else slow_end = std::max(slow_end, et.slow_offset + et.bytes);
+        } else if (et.alloc == "kTfLiteMmapRo" && et.data.rfind("g0::tensor_data", 0) == 0) {
+            it.kind = WEIGHT;
+        } else {
+            continue;
+        }
+        it.tensor = (int)t;
+        it.bytes = et.bytes;
+        item_of[t] = (int)items.size();
+        items.push_back(it);
+    }
+    int reserve = scratch_slow ? slow_size - slow_end : arena_size - fast_end;
+    if (reserve < 0) reserve = 0;
+    {
+        Item s;
+        s.kind = SCRATCH;
+        s.bytes = reserve;
+        items.push_back(s);
+    }
+    const int scratch_item = (int)items.size() - 1;
+
+    // lifetimes, as arena_plan has them
+    for (int t : model.inputs) if (item_of[t] >= 0 && items[item_of[t]].kind == ACTIVATION) items[item_of[t]].first = 0;
+    for (int t : model.outputs) if (item_of[t] >= 0 && items[item_of[t]].kind == ACTIVATION) items[item_of[t]].last = n_nodes - 1;
+    int conv_nodes = 0;
+    for (const EonNode &n : model.nodes) conv_nodes += n.op == "OP_CONV_2D" || n.op == "OP_DEPTHWISE_CONV_2D";
+    for (int i = 0; i < n_nodes; i++) {
+        const EonNode &n = model.nodes[i];
+        for (int t : n.outputs) {
+            if (t < 0 || item_of[t] < 0) continue;
+            Item &it = items[item_of[t]];
+            if (it.kind == ACTIVATION && it.first < 0) it.first = i;
+            it.uses.push_back(Access{ i, 1.0 });
+        }
+        bool conv = n.op == "OP_CONV_2D" || n.op == "OP_DEPTHWISE_CONV_2D";
+        double out_pixels = 1, window = 1;
+        if (conv && n.inputs.size() >= 2 && n.outputs.size() == 1 && n.inputs[1] >= 0) {
+            const std::vector<int> &od = model.tensors[n.outputs[0]].dims;
+            const std::vector<int> &fd = model.tensors[n.inputs[1]].dims;
+            if (od.size() == 4 && fd.size() == 4) {
+                out_pixels = (double)od[1] * od[2];
+                window = (double)fd[1] * fd[2] / (n.stride_h * n.stride_w);
+            }
+        }
+        for (size_t k = 0; k < n.inputs.size(); k++) {
+            int t = n.inputs[k];
+            if (t < 0 || item_of[t] < 0) continue;
+            Item &it = items[item_of[t]];
+            if (it.kind == ACTIVATION) it.last = std::max(it.last, i);
+            double passes = 1.0;
+            if (conv) passes = k == 0 ? window : out_pixels;
+            else if (n.op == "OP_SOFTMAX") passes = 2.0;
+            it.uses.push_back(Access{ i, passes });
+        }
+        if (conv && reserve > 0) items[scratch_item].uses.push_back(Access{ i, 2.0 / conv_nodes });
+    }
+    for (Item &it : items) {
+        if (it.kind == ACTIVATION) {
+            if (it.first < 0) it.first = 0;
+            if (it.last < it.first) it.last = it.first;
+        }
+        for (const Access &a : it.uses) {
+            it.cost[0] += access_ns(it, a, false, cm);
+            it.cost[1] += access_ns(it, a, true, cm);
+        }
+    }
+
+    Plan all_slow = evaluate(model, items, std::vector<bool>(items.size(), false));
+    Plan all_fast = evaluate(model, items, std::vector<bool>(items.size(), true));
+    const Limits lim = { budget, max_total > 0 ? max_total : all_slow.total };
+    Plan plan = optimize(model, items, lim);
+    bool valid = validate(model, items, plan, lim);
+
+    int n_act = 0, n_weights = 0, fast_act = 0, fast_weights = 0, fast_weight_bytes = 0;
+    for (size_t i = 0; i < items.size(); i++) {
+        if (items[i].kind == ACTIVATION) { n_act++; fast_act += plan.fast[i]; }
+        if (items[i].kind == WEIGHT) {
+            n_weights++;
+            if (plan.fast[i]) { fast_weights++; fast_weight_bytes += align_up(items[i].bytes); }
+        }
+    }
+    printf("%d activations, %d weight tensors, %d bytes persistent / scratch, %d nodes\n", n_act, n_weights, reserve,
+           n_nodes);
+    printf("cost model: SRAM %.1f ns/B, PSRAM %.1f ns/B, flash %.1f ns/B, cache %d bytes\n", cm.sram_ns,
+           cm.psram_ns, cm.flash_ns, cm.cache_bytes);
+    printf("SRAM budget %d: %d used (fast arena %d for %d activations, scratch %s, %d weight tensors %d bytes)\n",
+           budget, plan.footprint, align_up(plan.fast_pack.region), fast_act,
+           plan.fast[scratch_item] ? "in SRAM" : "external", fast_weights, fast_weight_bytes);
+    printf("external arena: %d bytes\n", align_up(plan.slow_pack.region) + (plan.fast[scratch_item] ? 0 : reserve));
+    printf("arenas together: %d bytes of tensors (limit %d, single arena %d) + %d persistent / scratch\n",
+           plan.total, lim.max_total, all_slow.total, reserve);
+    printf("memory time per inference: all external %.2f ms, plan %.2f ms (%.2fx), all SRAM %.2f ms (needs %d bytes)\n",
+           all_slow.ns / 1e6, plan.ns / 1e6, plan.ns > 0 ? all_slow.ns / plan.ns : 0.0, all_fast.ns / 1e6,
+           all_fast.footprint);
+    printf("simulator: %s\n", valid ? "plan fits, packs and no single move improves it" : "plan FAILED the checks");
+
+    if (nodes_table) {
+        printf("\n%4s %-22s %12s %12s %12s\n", "node", "op", "external us", "plan us", "SRAM us");
+        for (int i = 0; i < n_nodes; i++) {
+            double c[3] = { 0, 0, 0 };
+            for (size_t k = 0; k < items.size(); k++) {
+                for (const Access &a : items[k].uses) {
+                    if (a.node != i) continue;
+                    c[0] += access_ns(items[k], a, false, cm);
+                    c[1] += access_ns(items[k], a, plan.fast[k], cm);
+                    c[2] += access_ns(items[k], a, true, cm);
+                }
+            }
+            printf("%4d %-22s %12.1f %12.1f %12.1f\n", i, model.nodes[i].op.c_str() + 3, c[0] / 1e3, c[1] / 1e3,
+                   c[2] / 1e3);
+        }
+        printf("\nin SRAM:\n");
+        for (size_t k = 0; k < items.size(); k++) {
+            if (!plan.fast[k]) continue;
+            printf("  %-40s %7d bytes, saves %8.1f us\n", item_name(model, items[k]).c_str(), items[k].bytes,
+                   (items[k].cost[0] - items[k].cost[1]) / 1e3);
+        }
+    }
+
+    if (!write) return valid ? 0 : 1;
+    if (!valid) { fprintf(stderr, "%s: not written\n", argv[1]); return 1; }
+
+    int new_fast = align_up(plan.fast_pack.region) + (plan.fast[scratch_item] ? reserve : 0);
+    int new_slow = plan.fast[scratch_item] ? plan.slow_pack.region : align_up(plan.slow_pack.region) + reserve;
+    if (plan.slow_pack.region == 0 && plan.fast[scratch_item]) new_slow = 0;
+    int delta = new_fast - arena_size;
+    const std::regex re_row(R"(tensor_arena(?:_slow)? \+ \d+)");
+    const std::regex re_weight(R"(^const (?:MODEL_SECTION\(EI_MODEL_SECTION\)|FAST_MODEL_SECTION) (ALIGN\(\d+\) \w+ (tensor_data\d+)\[))");
+    std::map<std::string, bool> weight_fast;
+    for (size_t k = 0; k < items.size(); k++) {
+        if (items[k].kind == WEIGHT) weight_fast[model.tensors[items[k].tensor].data.substr(4)] = plan.fast[k];
+    }
+    for (size_t k = 0; k < items.size(); k++) {
+        if (items[k].kind != ACTIVATION) continue;
+        std::string &line = model.lines[model.tensors[items[k].tensor].line];
+        std::string to = plan.fast[k] ? "tensor_arena + " + std::to_string(plan.fast_pack.offset[k])
+                                      : "tensor_arena_slow + " + std::to_string(plan.slow_pack.offset[k]);
+        line = std::regex_replace(line, re_row, to, std::regex_constants::format_first_only);
+    }
+    for (std::string &line : model.lines) {
+        std::smatch m;
+        if (std::regex_search(line, m, re_size)) {
+            int size = atoi(m[1].str().c_str()) + delta;
+            line = m.prefix().str() + "constexpr int kTensorArenaSize = " + std::to_string(size) + ";" + m.suffix().str();
+        } else if (std::regex_search(line, m, re_slow_size)) {
+            line = m.prefix().str() + "constexpr int kTensorArenaSlowSize = " + std::to_string(new_slow) + ";" + m.suffix().str();
+        } else if (std::regex_search(line, m, re_scratch_slow)) {
+            line = m.prefix().str() + "constexpr bool kTierScratchSlow = " + (plan.fast[scratch_item] ? "false" : "true")
+                 + ";" + m.suffix().str();
+        } else if (std::regex_search(line, m, re_planned)) {
+            line = m.prefix().str() + "constexpr bool kTierPlanned = true;" + m.suffix().str();
+        } else if (std::regex_search(line, m, re_weight) && weight_fast.count(m[2])) {
+            line = std::string("const ") + (weight_fast[m[2]] ? "FAST_MODEL_SECTION " : "MODEL_SECTION(EI_MODEL_SECTION) ")
+                 + m[1].str() + m.suffix().str();
+        }
+    }
+    if (!eon_write(model, argv[1])) return 1;
+    printf("%s: kTensorArenaSize %d, kTensorArenaSlowSize %d written\n",
+           argv[1], new_fast, new_slow);
+    return 0;
+}
@@ -0,0 +1,345 @@
+// Checks the X86-NN int8 kernels against reference_integer_ops on random
+// shapes: CONV_2D (per call and prepacked, a third of the cases on one input
+// channel like the model's stem), DEPTHWISE_CONV_2D and ADD. Every case runs
+// at each level this CPU has and compares byte for byte; the thread pool size
+// cycles through 1..5 from case to case.
+//
+//   ./x86_nn_check [--cases N] [--seed S] [--threads N]
+//
+// Built next to the simulator by build_sim.sh. The memory and race checks
+// rebuild the same objects with a sanitizer:
+//
+//   CFLAGS="-O1 -g -fsanitize=address" ./build_sim.sh /tmp/asan && /tmp/asan/x86_nn_check
+//   CFLAGS="-O1 -g -fsanitize=thread -DEI_CLASSIFIER_PARALLEL_MIN_MACS=1" ./build_sim.sh /tmp/tsan
+//   /tmp/tsan/x86_nn_check --cases 500
+//
+// (MIN_MACS=1 splits every layer over the pool, not just the large ones.)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "edge-impulse-sdk/porting/x86/X86-NN/include/x86_nn.h"
+#include "edge-impulse-sdk/porting/x86/ei_thread_pool.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+
+using tflite::RuntimeShape;
+
+enum { OP_CONV, OP_CONV_PACKED, OP_DEPTHWISE, OP_ADD, OP_COUNT };
+static const char *op_names[OP_COUNT] = { "conv", "conv packed", "depthwise", "add" };
+
+struct Tally {
+    int cases;
+    int mismatches;
+    int fallbacks;      // kernel returned -1, the reference would have run
+};
+
+static std::mt19937 rng;
+static Tally tally[OP_COUNT][X86_NN_LEVEL_AVX512_VNNI + 1];
+
+static RuntimeShape nhwc(int32_t n, int32_t h, int32_t w, int32_t c) {
+    const int32_t dims[4] = { n, h, w, c };
+    return RuntimeShape(4, dims);
+}
+
+static int pick(int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); }
+
+static void fill(std::vector<int8_t> &v) { for (auto &x : v) x = (int8_t)pick(-128, 127); }
+
+// Per output channel requantization from a random effective scale, the way
+// CalculateOpDataConv derives it from input * filter / output scale.
+static void random_quant(int channels, std::vector<int32_t> &mult, std::vector<int32_t> &shift) {
+    mult.resize(channels);
+    shift.resize(channels);
+    for (int c = 0; c < channels; c++) {
+        const double scale = std::exp(std::uniform_real_distribution<double>(std::log(1e-5), std::log(0.9))(rng));
+        int s;
+        tflite::QuantizeMultiplier(scale, &mult[c], &s);
+        shift[c] = s;
+    }
+}
+
+static void random_activation(int32_t output_offset, int32_t *lo, int32_t *hi) {
+    switch (pick(0, 2)) {
+        case 0: *lo = -128; *hi = 127; break;
+        case 1: *lo = output_offset; *hi = 127; break;     // relu
+        default: *lo = pick(-128, 0); *hi = pick(*lo, 127); break;
+    }
+}
+
+// Output size of a VALID conv over the padded input; false when nothing fits.
+static bool out_size(int in, int filter, int stride, int pad, int *out) {
+    *out = (in + 2 * pad - filter) / stride + 1;
+    return in + 2 * pad >= filter;
+}
+
+static bool check(int op, int level, const std::vector<int8_t> &want, const std::vector<int8_t> &got,
+                  int rc, int index, const char *shape) {
+    Tally &t = tally[op][level];
+    t.cases++;
+    if (rc != 0) { t.fallbacks++; return true; }
+    for (size_t i = 0; i < want.size(); i++) {
+        if (want[i] != got[i]) {
+            if (t.mismatches++ == 0) {
+                printf("%s %s case %d (%s): byte %zu is %d, reference %d\n", op_names[op],
+                       x86_nn_level_name((x86_nn_level_t)level), index, shape, i, got[i], want[i]);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+static void conv_case(int index, int top) {
+    // a third on one input channel: the 3x3 stem path of the im2col fill
+    const int in_c = index % 3 == 0 ? 1 : pick(1, 48);
+    const int fh = index % 3 == 0 ? 3 : 2 * pick(0, 2) + 1, fw = pick(0, 3) ? fh : pick(1, 5);
+    const int stride_h = pick(1, 3), stride_w = pick(0, 1) ? stride_h : pick(1, 3);
+    const int pad_h = pick(0, fh / 2), pad_w = pick(0, fw / 2);
+    const int in_h = pick(1, index % 3 == 0 ? 48 : 20), in_w = pick(1, index % 3 == 0 ? 48 : 20);
+    const int out_c = pick(1, 72);
+    int out_h, out_w;
+    if (!out_size(in_h, fh, stride_h, pad_h, &out_h) || !out_size(in_w, fw, stride_w, pad_w, &out_w)) return;
+
+    std::vector<int8_t> input(in_h * in_w * in_c), filter(out_c * fh * fw * in_c);
+    std::vector<int32_t> bias(out_c), mult, shift;
+    fill(input);
+    fill(filter);
+    for (auto &b : bias) b = pick(-20000, 20000);
+    random_quant(out_c, mult, shift);
+    const bool has_bias = pick(0, 7) != 0;
+
+    x86_nn_conv_params_t p = {};
+    p.input_offset = -pick(-128, 127);
+    p.output_offset = pick(-128, 127);
+    random_activation(p.output_offset, &p.activation_min, &p.activation_max);
+    p.stride_width = stride_w;
+    p.stride_height = stride_h;
+    p.pad_width = pad_w;
+    p.pad_height = pad_h;
+    p.depth_multiplier = 1;
+
+    tflite::ConvParams rp = {};
+    rp.input_offset = p.input_offset;
+    rp.output_offset = p.output_offset;
+    rp.quantized_activation_min = p.activation_min;
+    rp.quantized_activation_max = p.activation_max;
+    rp.stride_width = stride_w;
+    rp.stride_height = stride_h;
+    rp.dilation_width_factor = 1;
+    rp.dilation_height_factor = 1;
+    rp.padding_values.width = pad_w;
+    rp.padding_values.height = pad_h;
+
+    std::vector<int8_t> want(out_h * out_w * out_c), got(want.size());
+    tflite::reference_integer_ops::ConvPerChannel(
+        rp, mult.data(), shift.data(), nhwc(1, in_h, in_w, in_c), input.data(),
+        nhwc(out_c, fh, fw, in_c), filter.data(), RuntimeShape(1, &out_c),
+        has_bias ? bias.data() : nullptr, nhwc(1, out_h, out_w, out_c), want.data());
+
+    const x86_nn_quant_t q = { mult.data(), shift.data() };
+    const x86_nn_dims_t in_dims = { in_h, in_w, in_c }, filter_dims = { fh, fw, out_c },
+                        out_dims = { out_h, out_w, out_c };
+    char shape[96];
+    snprintf(shape, sizeof(shape), "%dx%dx%d -> %dx%dx%d, %dx%d s%dx%d p%dx%d", in_h, in_w, in_c,
+             out_h, out_w, out_c, fh, fw, stride_h, stride_w, pad_h, pad_w);
+
+    for (int level = X86_NN_LEVEL_AVX2; level <= top; level++) {
+        x86_nn_set_max_level((x86_nn_level_t)level);
+        memset(got.data(), 0x55, got.size());
+        int rc = x86_nn_conv_s8(&p, &q, &in_dims, input.data(), &filter_dims, filter.data(),
+                                has_bias ? bias.data() : nullptr, &out_dims, got.data());
+        check(OP_CONV, level, want, got, rc, index, shape);
+
+        const int32_t bytes = x86_nn_conv_s8_packed_size(&p, &in_dims, &filter_dims);
+        if (bytes <= 0) continue;
+        void *packed = aligned_alloc(16, (bytes + 15) & ~15);
+        rc = x86_nn_conv_s8_pack(&p, &q, &in_dims, &filter_dims, filter.data(),
+                                 has_bias ? bias.data() : nullptr, packed);
+        if (rc == 0) {
+            memset(got.data(), 0x55, got.size());
+            rc = x86_nn_conv_s8_packed(packed, &p, &in_dims, input.data(), &filter_dims, &out_dims, got.data());
+            check(OP_CONV_PACKED, level, want, got, rc, index, shape);
+            // capped below the level it was packed for, the blob is either
+            // refused or still gives the reference bytes
+            if (level > X86_NN_LEVEL_AVX2) {
+                x86_nn_set_max_level((x86_nn_level_t)(level - 1));
+                memset(got.data(), 0x55, got.size());
+                if (x86_nn_conv_s8_packed(packed, &p, &in_dims, input.data(), &filter_dims, &out_dims,
+                                          got.data()) == 0) {
+                    check(OP_CONV_PACKED, level - 1, want, got, 0, index, shape);
+                }
+            }
+        }
+        free(packed);
+    }
+}
+
+static void depthwise_case(int index, int top) {
+    const int in_c = pick(1, 64);
+    const int dm = pick(0, 7) ? 1 : 2;      // X86-NN leaves multiplier 2 to the reference
+    const int out_c = in_c * dm;
+    const int fh = 2 * pick(0, 2) + 1, fw = pick(0, 3) ? fh : pick(1, 5);
+    const int stride_h = pick(1, 2), stride_w = pick(0, 1) ? stride_h : pick(1, 2);
+    const int pad_h = pick(0, fh / 2), pad_w = pick(0, fw / 2);
+    const int in_h = pick(1, 32), in_w = pick(1, 32);
+    int out_h, out_w;
+    if (!out_size(in_h, fh, stride_h, pad_h, &out_h) || !out_size(in_w, fw, stride_w, pad_w, &out_w)) return;
+
+    std::vector<int8_t> input(in_h * in_w * in_c), filter(fh * fw * out_c);
+    std::vector<int32_t> bias(out_c), mult, shift;
+    fill(input);
+    fill(filter);
+    for (auto &b : bias) b = pick(-20000, 20000);
+    random_quant(out_c, mult, shift);
+    const bool has_bias = pick(0, 7) != 0;
+
+    x86_nn_conv_params_t p = {};
+    p.input_offset = -pick(-128, 127);
+    p.output_offset = pick(-128, 127);
+    random_activation(p.output_offset, &p.activation_min, &p.activation_max);
+    p.stride_width = stride_w;
+    p.stride_height = stride_h;
+    p.pad_width = pad_w;
+    p.pad_height = pad_h;
+    p.depth_multiplier = dm;
+
+    tflite::DepthwiseParams rp = {};
+    rp.input_offset = p.input_offset;
+    rp.output_offset = p.output_offset;
+    rp.quantized_activation_min = p.activation_min;
+    rp.quantized_activation_max = p.activation_max;
+    rp.stride_width = stride_w;
+    rp.stride_height = stride_h;
+    rp.dilation_width_factor = 1;
+    rp.dilation_height_factor = 1;
+    rp.padding_values.width = pad_w;
+    rp.padding_values.height = pad_h;
+    rp.depth_multiplier = dm;
+
+    std::vector<int8_t> want(out_h * out_w * out_c), got(want.size());
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        rp, mult.data(), shift.data(), nhwc(1, in_h, in_w, in_c), input.data(),
+        nhwc(1, fh, fw, out_c), filter.data(), RuntimeShape(1, &out_c),
+        has_bias ? bias.data() : nullptr, nhwc(1, out_h, out_w, out_c), want.data());
+
+    const x86_nn_quant_t q = { mult.data(), shift.data() };
+    const x86_nn_dims_t in_dims = { in_h, in_w, in_c }, filter_dims = { fh, fw, out_c },
+                        out_dims = { out_h, out_w, out_c };
+    char shape[96];
+    snprintf(shape, sizeof(shape), "%dx%dx%d x%d, %dx%d s%dx%d p%dx%d", in_h, in_w, in_c, dm,
+             fh, fw, stride_h, stride_w, pad_h, pad_w);
+
+    for (int level = X86_NN_LEVEL_AVX2; level <= top; level++) {
+        x86_nn_set_max_level((x86_nn_level_t)level);
+        memset(got.data(), 0x55, got.size());
+        const int rc = x86_nn_depthwise_conv_s8(&p, &q, &in_dims, input.data(), &filter_dims, filter.data(),
+                                                has_bias ? bias.data() : nullptr, &out_dims, got.data());
+        check(OP_DEPTHWISE, level, want, got, rc, index, shape);
+    }
+}
+
+// Parameters as add_common.cpp derives them from the three tensor scales.
+static void add_case(int index, int top) {
+    const int size = pick(0, 3) ? pick(1, 100) : pick(1, 40000);
+    std::vector<int8_t> a(size), b(size);
+    fill(a);
+    fill(b);
+
+    auto log_scale = [] { return std::exp(std::uniform_real_distribution<double>(std::log(1e-3), std::log(1.0))(rng)); };
+    const double s1 = log_scale(), s2 = log_scale(), so = log_scale();
+    tflite::ArithmeticParams rp = {};
+    rp.left_shift = 20;
+    const double twice_max = 2 * std::max(s1, s2);
+    int32_t m;
+    int s;
+    tflite::QuantizeMultiplierSmallerThanOneExp(s1 / twice_max, &m, &s);
+    rp.input1_multiplier = m; rp.input1_shift = s;
+    tflite::QuantizeMultiplierSmallerThanOneExp(s2 / twice_max, &m, &s);
+    rp.input2_multiplier = m; rp.input2_shift = s;
+    tflite::QuantizeMultiplierSmallerThanOneExp(twice_max / ((1 << 20) * so), &m, &s);
+    rp.output_multiplier = m; rp.output_shift = s;
+    rp.input1_offset = -pick(-128, 127);
+    rp.input2_offset = -pick(-128, 127);
+    rp.output_offset = pick(-128, 127);
+    random_activation(rp.output_offset, &rp.quantized_activation_min, &rp.quantized_activation_max);
+
+    std::vector<int8_t> want(size), got(size);
+    const RuntimeShape shape_1d(1, &size);
+    tflite::reference_integer_ops::Add(rp, shape_1d, a.data(), shape_1d, b.data(), shape_1d, want.data());
+
+    x86_nn_add_params_t p;
+    p.input1_offset = rp.input1_offset;
+    p.input2_offset = rp.input2_offset;
+    p.input1_multiplier = rp.input1_multiplier;
+    p.input2_multiplier = rp.input2_multiplier;
+    p.input1_shift = rp.input1_shift;
+    p.input2_shift = rp.input2_shift;
+    p.left_shift = rp.left_shift;
+    p.output_offset = rp.output_offset;
+    p.output_multiplier = rp.output_multiplier;
+    p.output_shift = rp.output_shift;
+    p.activation_min = rp.quantized_activation_min;
+    p.activation_max = rp.quantized_activation_max;
+    char shape[32];
+    snprintf(shape, sizeof(shape), "%d elements", size);
+
+    for (int level = X86_NN_LEVEL_AVX2; level <= top; level++) {
+        x86_nn_set_max_level((x86_nn_level_t)level);
+        memset(got.data(), 0x55, got.size());
+        const int rc = x86_nn_add_s8(&p, a.data(), b.data(), got.data(), size);
+        check(OP_ADD, level, want, got, rc, index, shape);
+    }
+}
+
+int main(int argc, char **argv) {
+    int cases = 3000, threads = 0;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--cases") && i + 1 < argc) cases = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = (unsigned)strtoul(argv[++i], nullptr, 0);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--cases N] [--seed S] [--threads N]\n", argv[0]);
+            return 2;
+        }
+    }
+    rng.seed(seed);
+
+    x86_nn_set_max_level(X86_NN_LEVEL_AVX512_VNNI);
+    const int top = x86_nn_level();
+    if (top == X86_NN_LEVEL_NONE) {
+        printf("no AVX2 on this CPU, X86-NN leaves everything to the reference kernels\n");
+        return 0;
+    }
+    printf("%d cases per op, seed %u, levels avx2..%s, %s\n", cases, seed,
+           x86_nn_level_name((x86_nn_level_t)top), threads ? "fixed pool" : "pool 1..5");
+
+    for (int i = 0; i < cases; i++) {
+        ei_thread_pool_set_size(threads ? threads : i % 5 + 1);
+        conv_case(i, top);
+        depthwise_case(i, top);
+        add_case(i, top);
+    }
+    x86_nn_set_max_level(X86_NN_LEVEL_AVX512_VNNI);
+    ei_thread_pool_set_size(1);
+    x86_nn_free_thread_scratch();
+
+    int bad = 0;
+    for (int op = 0; op < OP_COUNT; op++) {
+        for (int level = X86_NN_LEVEL_AVX2; level <= top; level++) {
+            const Tally &t = tally[op][level];
+            printf("%-12s %-12s %5d cases %5d to reference %5d mismatches\n", op_names[op],
+                   x86_nn_level_name((x86_nn_level_t)level), t.cases, t.fallbacks, t.mismatches);
+            bad += t.mismatches;
+        }
+    }
+    printf(bad ? "FAIL\n" : "OK\n");
+    return bad ? 1 : 0;
+}
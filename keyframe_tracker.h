@@ -0,0 +1,245 @@
+#ifndef KEYFRAME_TRACKER_H
+#define KEYFRAME_TRACKER_H
+
+// Keyframe mode: FOMO runs only every `interval` frames (or sooner when
+// something moves outside the tracked objects or a track is lost). On the
+// frames in between, each open trace of the SDK Tracker is followed by matching
+// a grayscale template cut at the last keyframe, searched around the position
+// extrapolated from its last two observations. The matched boxes go back into
+// the Tracker, which keeps identities and closes traces that stop matching.
+//
+// Works on the model input (EI_CLASSIFIER_INPUT_WIDTH x _HEIGHT, BGR888 as
+// left in the pool slot). Include after BallBoxBC_inferencing.h.
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "sorter_hal.h"
+
+// The generated model_metadata.h has no tracking block
+// (EI_CLASSIFIER_OBJECT_TRACKING_ENABLED 0); take just the SDK's Tracker.
+#ifndef EI_OBJECT_TRACKER_STANDALONE
+#define EI_OBJECT_TRACKER_STANDALONE 1
+#endif
+#include "edge-impulse-sdk/classifier/postprocessing/ei_object_tracking.h"
+
+#define KEYFRAME_MAX_OBJECTS    10
+#define KEYFRAME_TEMPLATE_MAX   24      // template side, pixels
+#define KEYFRAME_MARGIN         4       // context around a FOMO box in the template
+
+class KeyframeTracker {
+public:
+    struct Config {
+        int search_px = 8;          // search radius around the extrapolated position
+        uint8_t max_sad = 24;       // mean abs difference per pixel accepted as a match
+        uint8_t motion_diff = 24;   // luma change that counts a pixel as moved
+        uint32_t motion_px = 8;     // moved samples (every 2nd pixel) outside the tracks that force a keyframe
+        float match_px = 16;        // centroid distance for box <-> trace association
+        uint32_t keep_grace = 2;    // frames a trace survives without a match
+    };
+
+    bool init(int width, int height, const Config &cfg) {
+        w_ = width;
+        h_ = height;
+        cfg_ = cfg;
+        gray_ = hal_alloc_frame((size_t)w_ * h_);
+        key_ = hal_alloc_frame((size_t)w_ * h_);
+        tracker_ = new Tracker(cfg.keep_grace, 5, cfg.match_px, false);
+        return gray_ && key_ && tracker_;
+    }
+
+    // 1 = full inference on every frame (tracking off).
+    void set_interval(int frames) { interval_.store(frames < 1 ? 1 : frames); }
+    int interval() const { return interval_.load(); }
+
+    // Drop the last keyframe (tracking was off and keyframe() not called):
+    // the next frame runs FOMO.
+    void invalidate() { have_key_ = false; }
+
+    // Luma of the current model input.
+    void set_frame_bgr(const uint8_t *bgr) {
+        for (int i = 0; i < w_ * h_; i++, bgr += 3) {
+            gray_[i] = (uint8_t)((bgr[2] * 77 + bgr[1] * 150 + bgr[0] * 29) >> 8);
+        }
+    }
+
+    bool want_keyframe() {
+        if (interval_.load() <= 1 || !have_key_ || force_key_) return true;
+        if (since_key_ + 1 >= interval_.load()) return true;
+        if (moved_outside_tracks() >= cfg_.motion_px) { motion_keys_.fetch_add(1); return true; }
+        return false;
+    }
+
+    // After run_classifier() on the current frame.
+    void keyframe(const ei_impulse_result_bounding_box_t *boxes, uint32_t count) {
+        std::vector<ei_impulse_result_bounding_box_t> dets;
+        for (uint32_t i = 0; i < count; i++) {
+            if (boxes[i].value > 0) dets.push_back(boxes[i]);
+        }
+        update(dets);
+
+        // fresh templates for every trace that is still open
+        n_tmpl_ = 0;
+        for (Trace *trace : tracker_->open_traces) {
+            const ei_impulse_result_bounding_box_t *obs = trace->last_observation();
+            if (!obs || n_tmpl_ == KEYFRAME_MAX_OBJECTS) continue;
+            cut_template(tmpl_[n_tmpl_++], trace->id, *obs);
+        }
+        memcpy(key_, gray_, (size_t)w_ * h_);
+        have_key_ = true;
+        force_key_ = false;
+        since_key_ = 0;
+        keyframes_.fetch_add(1);
+    }
+
+    // Between keyframes: the tracked boxes for the current frame.
+    uint32_t track(ei_impulse_result_bounding_box_t *out, uint32_t max) {
+        std::vector<ei_impulse_result_bounding_box_t> dets;
+        for (Trace *trace : tracker_->open_traces) {
+            Template *t = find_template(trace->id);
+            const ei_impulse_result_bounding_box_t *obs = trace->last_observation();
+            if (!t || !obs) continue;
+
+            // constant-velocity guess from the last two observations
+            auto seg = trace->last_centroid_segment();
+            int vx = std::get<2>(seg) - std::get<0>(seg);
+            int vy = std::get<3>(seg) - std::get<1>(seg);
+            int px = (int)obs->x + vx - t->box_dx;
+            int py = (int)obs->y + vy - t->box_dy;
+
+            int mx, my;
+            if (!match(*t, px, py, &mx, &my)) {
+                force_key_ = true;         // lost it: let FOMO have a look next frame
+                lost_.fetch_add(1);
+                continue;
+            }
+            ei_impulse_result_bounding_box_t bb = t->box;
+            bb.x = (uint32_t)(mx + t->box_dx);
+            bb.y = (uint32_t)(my + t->box_dy);
+            dets.push_back(bb);
+        }
+        update(dets);
+        since_key_++;
+        tracked_.fetch_add(1);
+
+        uint32_t n = 0;
+        for (const ei_impulse_result_bounding_box_t &bb : dets) {
+            if (n < max) out[n++] = bb;
+        }
+        return n;
+    }
+
+    uint32_t keyframes() const { return keyframes_.load(); }
+    uint32_t tracked() const { return tracked_.load(); }
+    uint32_t motion_keys() const { return motion_keys_.load(); }
+    uint32_t lost() const { return lost_.load(); }
+
+private:
+    struct Template {
+        uint32_t id;
+        ei_impulse_result_bounding_box_t box;   // keyframe detection (label, size, score)
+        int box_dx, box_dy;                     // box origin inside the template
+        int tw, th;
+        uint8_t px[KEYFRAME_TEMPLATE_MAX * KEYFRAME_TEMPLATE_MAX];
+    };
+
+    void cut_template(Template &t, uint32_t id, const ei_impulse_result_bounding_box_t &bb) {
+        int x0 = (int)bb.x - KEYFRAME_MARGIN, y0 = (int)bb.y - KEYFRAME_MARGIN;
+        int x1 = (int)(bb.x + bb.width) + KEYFRAME_MARGIN, y1 = (int)(bb.y + bb.height) + KEYFRAME_MARGIN;
+        // centre crop to the template size, then clip to the image
+        if (x1 - x0 > KEYFRAME_TEMPLATE_MAX) { x0 += (x1 - x0 - KEYFRAME_TEMPLATE_MAX) / 2; x1 = x0 + KEYFRAME_TEMPLATE_MAX; }
+        if (y1 - y0 > KEYFRAME_TEMPLATE_MAX) { y0 += (y1 - y0 - KEYFRAME_TEMPLATE_MAX) / 2; y1 = y0 + KEYFRAME_TEMPLATE_MAX; }
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > w_) x1 = w_;
+        if (y1 > h_) y1 = h_;
+
+        t.id = id;
+        t.box = bb;
+        t.box_dx = (int)bb.x - x0;
+        t.box_dy = (int)bb.y - y0;
+        t.tw = x1 - x0;
+        t.th = y1 - y0;
+        for (int y = 0; y < t.th; y++) memcpy(t.px + y * t.tw, gray_ + (y0 + y) * w_ + x0, t.tw);
+    }
+
+    // Tracker keeps every closed trace (and its filter) until it is destroyed
+    void update(const std::vector<ei_impulse_result_bounding_box_t> &dets) {
+        tracker_->process_new_detections(dets);
+        for (Trace *trace : tracker_->closed_traces) delete trace;
+        tracker_->closed_traces.clear();
+    }
+
+    Template *find_template(uint32_t id) {
+        for (int i = 0; i < n_tmpl_; i++) if (tmpl_[i].id == id) return &tmpl_[i];
+        return nullptr;
+    }
+
+    // Exhaustive SAD search in a window around (px, py), with early exit.
+    bool match(const Template &t, int px, int py, int *mx, int *my) const {
+        if (t.tw <= 0 || t.th <= 0) return false;
+        uint32_t best = UINT32_MAX;
+        for (int dy = -cfg_.search_px; dy <= cfg_.search_px; dy++) {
+            int y0 = py + dy;
+            if (y0 < 0 || y0 + t.th > h_) continue;
+            for (int dx = -cfg_.search_px; dx <= cfg_.search_px; dx++) {
+                int x0 = px + dx;
+                if (x0 < 0 || x0 + t.tw > w_) continue;
+                uint32_t sad = 0;
+                for (int y = 0; y < t.th && sad < best; y++) {
+                    const uint8_t *a = t.px + y * t.tw;
+                    const uint8_t *b = gray_ + (y0 + y) * w_ + x0;
+                    for (int x = 0; x < t.tw; x++) sad += (uint32_t)abs(a[x] - b[x]);
+                }
+                if (sad < best) { best = sad; *mx = x0; *my = y0; }
+            }
+        }
+        return best != UINT32_MAX && best <= (uint32_t)cfg_.max_sad * t.tw * t.th;
+    }
+
+    // Pixels (every 2nd) that changed since the keyframe outside the templates'
+    // search areas, i.e. where nothing known was supposed to move. A new object
+    // of FOMO cell size already trips a handful of them.
+    uint32_t moved_outside_tracks() const {
+        uint32_t moved = 0;
+        for (int y = 0; y < h_; y += 2) {
+            for (int x = 0; x < w_; x += 2) {
+                if (abs(gray_[y * w_ + x] - key_[y * w_ + x]) < cfg_.motion_diff) continue;
+                if (!near_track(x, y)) moved++;
+            }
+        }
+        return moved;
+    }
+
+    bool near_track(int x, int y) const {
+        int r = cfg_.search_px * (since_key_ + 1);
+        for (int i = 0; i < n_tmpl_; i++) {
+            const Template &t = tmpl_[i];
+            int x0 = (int)t.box.x - t.box_dx - r, y0 = (int)t.box.y - t.box_dy - r;
+            if (x >= x0 && y >= y0 && x < x0 + t.tw + 2 * r && y < y0 + t.th + 2 * r) return true;
+        }
+        return false;
+    }
+
+    int w_ = 0, h_ = 0;
+    Config cfg_;
+    std::atomic<int> interval_{1};
+    uint8_t *gray_ = nullptr;
+    uint8_t *key_ = nullptr;
+    Tracker *tracker_ = nullptr;
+
+    Template tmpl_[KEYFRAME_MAX_OBJECTS];
+    int n_tmpl_ = 0;
+    bool have_key_ = false;
+    bool force_key_ = false;
+    int since_key_ = 0;
+
+    std::atomic<uint32_t> keyframes_{0};
+    std::atomic<uint32_t> tracked_{0};
+    std::atomic<uint32_t> motion_keys_{0};
+    std::atomic<uint32_t> lost_{0};
+};
+
+#endif // KEYFRAME_TRACKER_H
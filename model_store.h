@@ -0,0 +1,322 @@
+#ifndef MODEL_STORE_H
+#define MODEL_STORE_H
+
+// Runtime model replacement without reflashing. A model image (ModelImageHeader
+// + TFLite flatbuffer, made by host/model_pack) is streamed into whichever of
+// the two slots is not serving, validated, and handed to the classify task,
+// which switches to it at the next frame boundary. Until then, and if anything
+// about the new image is wrong, the current model keeps running.
+//
+// A loaded model runs through the TFLite Micro interpreter: it replaces the
+// learning block of a copy of the built-in impulse, so DSP, input quantization
+// and the FOMO postprocessing stay exactly those of the compiled-in (EON) model.
+// Each slot keeps its interpreter and arena for as long as it is active; the
+// arena size is planned on the host and stored in the header.
+//
+// Only kernels compiled for the built-in model are available (see
+// tflite-model/trained_model_ops_define.h); a model that needs others fails
+// validation in AllocateTensors().
+//
+// Include after BallBoxBC_inferencing.h.
+
+#include <atomic>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_interpreter.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/packed_weights.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated_full.h"
+#include "sorter_hal.h"
+
+#define MODEL_IMAGE_MAGIC       0x314d4945u     // "EIM1"
+#define MODEL_IMAGE_VERSION     1
+#define MODEL_STORE_MAX_BYTES   (2u * 1024 * 1024)
+#define MODEL_STORE_OPS         16
+
+struct ModelImageHeader {
+    uint32_t magic;
+    uint16_t header_size;       // sizeof(ModelImageHeader) of the writer
+    uint16_t version;
+    uint32_t model_bytes;       // flatbuffer that follows the header
+    uint32_t arena_bytes;       // tensor arena the model needs, planned by model_pack
+    uint32_t crc32;             // of the flatbuffer
+    uint32_t model_id;          // free-form, reported on /model
+    uint32_t reserved[2];
+};
+
+// CRC-32 (IEEE), incremental: crc = model_crc32(crc, chunk, n) starting from 0.
+static inline uint32_t model_crc32(uint32_t crc, const uint8_t *p, size_t n) {
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+typedef tflite::MicroMutableOpResolver<MODEL_STORE_OPS> ModelStoreResolver;
+
+// Operators a loaded model may use; host/model_pack plans with the same set.
+static inline void model_store_add_ops(ModelStoreResolver &r) {
+    r.AddAdd();
+    r.AddAveragePool2D();
+    r.AddConcatenation();
+    r.AddConv2D();
+    r.AddDepthwiseConv2D();
+    r.AddDequantize();
+    r.AddFullyConnected();
+    r.AddLogistic();
+    r.AddMaxPool2D();
+    r.AddMean();
+    r.AddMul();
+    r.AddPad();
+    r.AddQuantize();
+    r.AddRelu6();
+    r.AddReshape();
+    r.AddSoftmax();
+}
+
+class ModelStore {
+public:
+    // `base` is the built-in impulse a loaded model must be compatible with.
+    void init(ei_impulse_handle_t *base) {
+        base_ = base;
+        model_store_add_ops(resolver_);
+    }
+
+    // --- upload side (web task), one upload at a time ---
+
+    // False when no slot is free (the other one still waits to be switched to).
+    bool begin(size_t total) {
+        abort();
+        if (total < sizeof(ModelImageHeader) || total > MODEL_STORE_MAX_BYTES) { error_ = "bad size"; return false; }
+        for (int i = 0; i < 2; i++) {
+            int expected = SLOT_FREE;
+            if (!slots_[i].state.compare_exchange_strong(expected, SLOT_LOADING)) continue;
+            Slot &s = slots_[i];
+            s.image = hal_alloc_frame(total);
+            if (!s.image) { s.state.store(SLOT_FREE); error_ = "out of memory"; return false; }
+            s.total = total;
+            s.received = 0;
+            s.crc = 0;
+            loading_ = i;
+            error_ = nullptr;
+            return true;
+        }
+        error_ = "busy";
+        return false;
+    }
+
+    bool write(const uint8_t *data, size_t len) {
+        if (loading_ < 0) return false;
+        Slot &s = slots_[loading_];
+        if (s.received + len > s.total) { abort(); error_ = "too long"; return false; }
+        memcpy(s.image + s.received, data, len);
+        // the CRC covers the flatbuffer only
+        size_t skip = s.received < sizeof(ModelImageHeader) ? sizeof(ModelImageHeader) - s.received : 0;
+        if (skip < len) s.crc = model_crc32(s.crc, data + skip, len - skip);
+        s.received += len;
+        return true;
+    }
+
+    // Validates the image and queues it for the classify task. On failure the
+    // slot is released and error() says why.
+    bool finish() {
+        if (loading_ < 0) return false;
+        Slot &s = slots_[loading_];
+        const char *err = validate(s);
+        if (err) {
+            error_ = err;
+            abort();
+            return false;
+        }
+        error_ = nullptr;
+        s.state.store(SLOT_READY);
+        loading_ = -1;
+        return true;
+    }
+
+    void abort() {
+        if (loading_ < 0) return;
+        release(slots_[loading_]);
+        loading_ = -1;
+    }
+
+    // Back to the compiled-in model at the next frame.
+    void request_builtin() { want_builtin_.store(true); }
+
+    // --- classify side ---
+
+    // Call once per frame before inference. Returns the impulse to run:
+    // a loaded model, or nullptr for the built-in one.
+    ei_impulse_handle_t *at_frame_boundary() {
+        int next = -2;
+        for (int i = 0; i < 2; i++) {
+            if (slots_[i].state.load() == SLOT_READY) next = i;
+        }
+        if (want_builtin_.exchange(false)) {
+            if (next >= 0) release(slots_[next]);   // drop a queued model as well
+            next = -1;
+        }
+        if (next != -2 && next != active_) {
+            int old = active_;
+            if (next >= 0) slots_[next].state.store(SLOT_ACTIVE);
+            active_ = next;
+            active_id_.store(next >= 0 ? slots_[next].hdr.model_id : 0);
+            if (old >= 0) release(slots_[old]);
+            swaps_.fetch_add(1);
+        }
+        return active_ >= 0 ? slots_[active_].handle : nullptr;
+    }
+
+    uint32_t active_id() const { return active_id_.load(); }     // 0 = built-in
+    uint32_t swaps() const { return swaps_.load(); }
+    const char *error() const { return error_.load(); }
+    bool pending() const {
+        return slots_[0].state.load() == SLOT_READY || slots_[1].state.load() == SLOT_READY;
+    }
+
+private:
+    enum { SLOT_FREE, SLOT_LOADING, SLOT_READY, SLOT_ACTIVE };
+
+    struct Slot {
+        std::atomic<int> state{SLOT_FREE};
+        uint8_t *image = nullptr;
+        size_t total = 0, received = 0;
+        uint32_t crc = 0;
+        ModelImageHeader hdr = {};
+        uint8_t *arena_raw = nullptr;
+        tflite::MicroInterpreter *interpreter = nullptr;
+        ei_learning_block_config_tflite_graph_t block_config = {};
+        ei_learning_block_t *block = nullptr;
+        ei_impulse_t impulse = {};
+        ei_impulse_handle_t *handle = nullptr;
+    };
+
+    const char *validate(Slot &s) {
+        if (s.received != s.total) return "truncated";
+        memcpy(&s.hdr, s.image, sizeof(s.hdr));
+        const ModelImageHeader &h = s.hdr;
+        if (h.magic != MODEL_IMAGE_MAGIC || h.version != MODEL_IMAGE_VERSION) return "not a model image";
+        if (h.header_size != sizeof(ModelImageHeader) || h.header_size + h.model_bytes != s.total) return "bad size";
+        if (h.crc32 != s.crc) return "CRC mismatch";
+
+        const uint8_t *fb = s.image + h.header_size;
+        flatbuffers::Verifier verifier(fb, h.model_bytes);
+        if (!tflite::VerifyModelBuffer(verifier)) return "not a TFLite model";
+        const tflite::Model *model = tflite::GetModel(fb);
+        if (model->version() != TFLITE_SCHEMA_VERSION) return "schema version";
+
+        // the header's plan, 16-byte aligned like ei_aligned_calloc()
+        const size_t arena_bytes = h.arena_bytes;
+        s.arena_raw = hal_alloc_frame(arena_bytes + 16);
+        if (!s.arena_raw) return "out of memory";
+        uint8_t *arena = (uint8_t *)(((uintptr_t)s.arena_raw + 15) & ~(uintptr_t)15);
+        s.interpreter = new tflite::MicroInterpreter(model, resolver_, arena, arena_bytes);
+        if (s.interpreter->AllocateTensors(true) != kTfLiteOk) return "AllocateTensors failed";
+
+        const char *err = check_io(s.interpreter);
+        if (err) return err;
+        build_impulse(s);
+        return nullptr;
+    }
+
+    // Input must take the built-in DSP output, output must be what its
+    // postprocessing reads (same size, int8 with the same quantization).
+    const char *check_io(tflite::MicroInterpreter *in) const {
+        const ei_impulse_t *base = base_->impulse;
+        const ei_learning_block_config_tflite_graph_t *bc =
+            (const ei_learning_block_config_tflite_graph_t *)base->learning_blocks[0].config;
+        if (in->inputs_size() != 1 || in->outputs_size() < bc->output_tensors_size) return "tensor count";
+
+        TfLiteTensor *input = in->input(0);
+        if (input->type != kTfLiteInt8 && input->type != kTfLiteUInt8 && input->type != kTfLiteFloat32) return "input type";
+        size_t elems = input->type == kTfLiteFloat32 ? input->bytes / 4 : input->bytes;
+        if (elems != base->nn_input_frame_size) return "input shape";
+
+        TfLiteTensor *output = in->output(bc->output_tensors_indices[0]);
+        if (output->type != kTfLiteInt8) return "output type";
+        size_t out_elems = 1;
+        for (int d = 0; d < output->dims->size; d++) out_elems *= output->dims->data[d];
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1 && EI_CLASSIFIER_OBJECT_DETECTION_LAST_LAYER == EI_CLASSIFIER_LAST_LAYER_FOMO
+        const ei_fill_result_fomo_i8_config_t *pc =
+            (const ei_fill_result_fomo_i8_config_t *)base->postprocessing_blocks[0].config;
+        if (out_elems != (size_t)pc->out_width * pc->out_height * ((size_t)base->label_count + 1)) return "output shape";
+        if (output->params.zero_point != pc->zero_point || fabsf(output->params.scale - pc->scale) > 1e-6f) {
+            return "output quantization";
+        }
+#endif
+        return nullptr;
+    }
+
+    void build_impulse(Slot &s) {
+        const ei_impulse_t *base = base_->impulse;
+        const ei_learning_block_t &bb = base->learning_blocks[0];
+        s.block_config = *(const ei_learning_block_config_tflite_graph_t *)bb.config;
+        s.block_config.compiled = 0;
+        s.block_config.graph_config = &s;
+        s.block = new ei_learning_block_t{bb.blockId, &ModelStore::infer, &s.block_config, bb.image_scaling,
+                                          bb.input_block_ids, bb.input_block_ids_size};
+        s.impulse = *base;
+        s.impulse.learning_blocks_size = 1;
+        s.impulse.learning_blocks = s.block;
+        s.handle = new ei_impulse_handle_t(&s.impulse);
+    }
+
+    void release(Slot &s) {
+        delete s.handle;
+        s.handle = nullptr;
+        delete s.block;
+        s.block = nullptr;
+        delete s.interpreter;
+        s.interpreter = nullptr;
+        if (s.image) tflite::PackedWeightsForget(s.image, s.total);     // filters of this image
+        hal_free_frame(s.arena_raw);
+        s.arena_raw = nullptr;
+        hal_free_frame(s.image);
+        s.image = nullptr;
+        s.state.store(SLOT_FREE);
+    }
+
+    // ei_learning_block_t::infer_fn for loaded models; mirrors run_nn_inference()
+    // of the TFLite Micro engine, with the interpreter kept across frames.
+    static EI_IMPULSE_ERROR infer(const ei_impulse_t *impulse, ei_feature_t *fmatrix, uint32_t learn_block_index,
+                                  uint32_t *input_block_ids, uint32_t input_block_ids_size,
+                                  ei_impulse_result_t *result, void *config, bool debug) {
+        (void)debug;
+        ei_learning_block_config_tflite_graph_t *bc = (ei_learning_block_config_tflite_graph_t *)config;
+        tflite::MicroInterpreter *in = ((Slot *)bc->graph_config)->interpreter;
+
+        uint64_t start_us = ei_read_timer_us();
+        EI_IMPULSE_ERROR res = fill_input_tensor_from_matrix(fmatrix, result->_raw_outputs, in->input(0),
+                                                             input_block_ids, input_block_ids_size,
+                                                             impulse->dsp_blocks_size, impulse->learning_blocks_size);
+        if (res != EI_IMPULSE_OK) return res;
+        if (in->Invoke() != kTfLiteOk) return EI_IMPULSE_TFLITE_ERROR;
+        result->timing.classification_us = ei_read_timer_us() - start_us;
+        result->timing.classification = (int)(result->timing.classification_us / 1000);
+
+        for (uint32_t ix = 0; ix < bc->output_tensors_size; ix++) {
+            TfLiteTensor *output = in->output(bc->output_tensors_indices[ix]);
+            ei_feature_t &raw = result->_raw_outputs[learn_block_index + ix];
+            raw.matrix_i8 = new matrix_i8_t(1, output->bytes);
+            memcpy(raw.matrix_i8->buffer, output->data.int8, output->bytes);
+            raw.blockId = bc->block_id + ix;
+        }
+        return EI_IMPULSE_OK;
+    }
+
+    ei_impulse_handle_t *base_ = nullptr;
+    ModelStoreResolver resolver_;
+    Slot slots_[2];
+    int loading_ = -1;                      // upload side
+    int active_ = -1;                       // classify side, -1 = built-in
+    std::atomic<bool> want_builtin_{false};
+    std::atomic<uint32_t> active_id_{0};
+    std::atomic<uint32_t> swaps_{0};
+    std::atomic<const char *> error_{nullptr};   // written by the upload task, read by /model
+};
+
+#endif // MODEL_STORE_H
@@ -0,0 +1,13 @@
+#ifndef MOVING_AVERAGE_H
+#define MOVING_AVERAGE_H
+
+#include <stdint.h>
+
+// 1/8 moving average of a duration (us) for the stage statistics; 0 means
+// no sample yet, so the first sample seeds it.
+static inline uint32_t ewma(uint32_t avg, uint32_t sample) {
+    if (!avg) return sample;
+    return avg - avg / 8 + sample / 8;
+}
+
+#endif // MOVING_AVERAGE_H
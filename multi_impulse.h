@@ -0,0 +1,131 @@
+#ifndef MULTI_IMPULSE_H
+#define MULTI_IMPULSE_H
+
+// Runs several impulses on one preprocessed camera frame (BGR888, as left in
+// a pool slot), so a second model - defect check, anomaly score - costs its
+// own inference but no extra capture, JPEG decode or resize from QVGA.
+//
+// Per impulse only what differs is redone: an impulse whose input resolution
+// differs from the frame gets a crop/resize into a scratch buffer, shared by
+// all impulses (consecutive impulses with the same resolution reuse it as is)
+// and allocated by the first run that needs it.
+// Channel mode and scaling stay with the impulse's own image DSP block, which
+// reads the packed pixels through the signal like run_classifier() always does.
+//
+// Impulses run back to back on the calling task. process_impulse() keeps
+// results in static storage and each EON model allocates its arena on init
+// and frees it on reset, so running them one after the other is what lets the
+// arenas share the same heap; results are only valid inside the callback.
+//
+// Include after BallBoxBC_inferencing.h.
+
+#include <stdint.h>
+#include "sorter_hal.h"
+
+#define MULTI_IMPULSE_MAX 4
+
+class MultiImpulseRunner {
+public:
+    // Called after each impulse; `result` is overwritten by the next one.
+    typedef void (*result_fn)(int index, const ei_impulse_result_t &result, void *ctx);
+
+    struct Stats {
+        uint32_t runs;
+        uint32_t errors;
+        uint32_t prep_us;           // resize for this impulse, 0 when it takes the frame as is
+        uint32_t dsp_us;            // moving averages, from result.timing
+        uint32_t classification_us;
+    };
+
+    // Before the first run(). Returns the impulse index, -1 when full.
+    int add(ei_impulse_handle_t *handle, result_fn on_result, void *ctx) {
+        if (n_ == MULTI_IMPULSE_MAX || !handle || !on_result) return -1;
+        Slot &s = slots_[n_];
+        s.handle = handle;
+        s.on_result = on_result;
+        s.ctx = ctx;
+        s.stats = {};
+        return n_++;
+    }
+
+    int count() const { return n_; }
+    const Stats &stats(int index) const { return slots_[index].stats; }
+
+    // Every impulse on `bgr` (w x h). Stops at the first error and returns it.
+    EI_IMPULSE_ERROR run(const uint8_t *bgr, int w, int h, bool debug) {
+        int scratch_w = 0, scratch_h = 0;
+        for (int i = 0; i < n_; i++) {
+            Slot &s = slots_[i];
+            int iw = (int)s.handle->impulse->input_width;
+            int ih = (int)s.handle->impulse->input_height;
+
+            uint32_t t0 = hal_micros();
+            const uint8_t *input = bgr;
+            if (iw != w || ih != h) {
+                // the SDK crops into dst at source scale before interpolating
+                size_t px = (size_t)iw * ih > (size_t)w * h ? (size_t)iw * ih : (size_t)w * h;
+                if (!reserve(px * 3)) return EI_IMPULSE_ALLOC_FAILED;
+                if (iw != scratch_w || ih != scratch_h) {
+                    ei::image::processing::crop_and_interpolate_rgb888(bgr, w, h, scratch_, iw, ih);
+                    scratch_w = iw;
+                    scratch_h = ih;
+                }
+                input = scratch_;
+            }
+            uint32_t prep_us = hal_micros() - t0;
+
+            ei::signal_t signal;
+            signal.total_length = (size_t)iw * ih;
+            signal.get_data = [input](size_t offset, size_t length, float *out) -> int {
+                const uint8_t *px = input + offset * 3;
+                for (size_t j = 0; j < length; j++, px += 3) out[j] = (float)((px[2] << 16) | (px[1] << 8) | px[0]);
+                return 0;
+            };
+
+            ei_impulse_result_t result = {};
+            EI_IMPULSE_ERROR err = run_classifier(s.handle, &signal, &result, debug);
+            if (err != EI_IMPULSE_OK) {
+                s.stats.errors++;
+                return err;
+            }
+            s.stats.runs++;
+            s.stats.prep_us = ewma(s.stats.prep_us, prep_us);
+            s.stats.dsp_us = ewma(s.stats.dsp_us, (uint32_t)result.timing.dsp_us);
+            s.stats.classification_us = ewma(s.stats.classification_us, (uint32_t)result.timing.classification_us);
+            s.on_result(i, result, s.ctx);
+        }
+        return EI_IMPULSE_OK;
+    }
+
+private:
+    struct Slot {
+        ei_impulse_handle_t *handle;
+        result_fn on_result;
+        void *ctx;
+        Stats stats;
+    };
+
+    // sized for the largest resized input seen so far
+    bool reserve(size_t bytes) {
+        if (bytes <= scratch_bytes_) return true;
+        uint8_t *p = hal_alloc_frame(bytes);
+        if (!p) return false;
+        hal_free_frame(scratch_);
+        scratch_ = p;
+        scratch_bytes_ = bytes;
+        return true;
+    }
+
+    // 1/8 moving average; first sample seeds it
+    static uint32_t ewma(uint32_t avg, uint32_t sample) {
+        if (!avg) return sample;
+        return avg - avg / 8 + sample / 8;
+    }
+
+    Slot slots_[MULTI_IMPULSE_MAX];
+    int n_ = 0;
+    uint8_t *scratch_ = nullptr;
+    size_t scratch_bytes_ = 0;
+};
+
+#endif // MULTI_IMPULSE_H
@@ -0,0 +1,178 @@
+#ifndef PRESENCE_CASCADE_H
+#define PRESENCE_CASCADE_H
+
+// Two-stage cascade in front of run_classifier(). Stage 1 is a handcrafted
+// presence test on the model input: the image is split into 8x8 blocks
+// (FOMO's 12x12 output grid at 96x96) and each block's luma mean and standard
+// deviation are compared with a background model of the empty belt. Only when
+// some block differs by `threshold` or more does stage 2, the full FOMO
+// impulse, run; otherwise the result is "no objects" at a few tens of µs.
+//
+// The background is learnt from frames FOMO found empty (fast) and from gated
+// frames (slowly, to follow lighting drift); frames with objects never touch
+// it. Every `recheck_every`-th gated frame runs FOMO anyway; a detection there
+// is counted as a gate miss, so the gate's false negatives stay visible.
+//
+// This is the classifier layer of the firmware: the classify task calls
+// cascade.run() where it called run_classifier() (plus the impulse to run and
+// a "gated" flag out).
+// It stays out of the exported Edge Impulse library because the background
+// model is specific to this belt and it shares the firmware's timing
+// (sorter_hal.h, moving_average.h). Include after BallBoxBC_inferencing.h.
+
+#include <atomic>
+#include <math.h>
+#include <stdint.h>
+#include "moving_average.h"
+#include "sorter_hal.h"
+
+#define CASCADE_BLOCK       8       // block side, pixels
+#define CASCADE_MAX_BLOCKS  256
+
+class PresenceCascade {
+public:
+    struct Config {
+        uint32_t recheck_every = 10;    // gated frames between forced full runs, 0 = never
+        uint8_t learn_shift = 2;        // background update 1/4 on frames FOMO found empty
+        uint8_t drift_shift = 5;        // and 1/32 on gated frames
+    };
+
+    bool init(int width, int height, const Config &cfg) {
+        w_ = width;
+        h_ = height;
+        cfg_ = cfg;
+        bw_ = w_ / CASCADE_BLOCK;
+        bh_ = h_ / CASCADE_BLOCK;
+        return bw_ > 0 && bh_ > 0 && bw_ * bh_ <= CASCADE_MAX_BLOCKS;
+    }
+
+    // Block change (luma levels) that counts as "something there"; 0 = gate off.
+    void set_threshold(int levels) { threshold_.store(levels < 0 ? 0 : levels > 255 ? 255 : levels); }
+    int threshold() const { return threshold_.load(); }
+
+    // Drop-in for run_classifier() on `impulse` (nullptr = ei_default_impulse).
+    // A gated frame returns EI_IMPULSE_OK with no boxes and
+    // timing.classification_us = time spent in the gate; *gated is set accordingly.
+    EI_IMPULSE_ERROR run(ei_impulse_handle_t *impulse, signal_t *signal, ei_impulse_result_t *result,
+                         bool debug, bool *gated) {
+        *gated = false;
+        frames_.fetch_add(1);
+        int thr = threshold_.load();
+
+        uint32_t t0 = hal_micros();
+        bool measured = thr > 0 && measure(signal);
+        bool present = !measured || !have_bg_ || score() >= thr;
+        bool recheck = false;
+        if (!present && cfg_.recheck_every && ++since_full_ >= cfg_.recheck_every) {
+            present = true;
+            recheck = true;
+        }
+        uint32_t gate_us = hal_micros() - t0;
+        if (measured) gate_us_.store(ewma(gate_us_.load(), gate_us));
+
+        if (!present) {
+            update_background(cfg_.drift_shift);
+            result->bounding_boxes = nullptr;
+            result->bounding_boxes_count = 0;
+            result->timing.dsp_us = 0;
+            result->timing.classification_us = gate_us;
+            gated_.fetch_add(1);
+            *gated = true;
+            return EI_IMPULSE_OK;
+        }
+
+        since_full_ = 0;
+        EI_IMPULSE_ERROR err = run_classifier(impulse ? impulse : &ei_default_impulse, signal, result, debug);
+        if (err != EI_IMPULSE_OK) return err;
+        full_us_.store(ewma(full_us_.load(), (uint32_t)(result->timing.dsp_us + result->timing.classification_us)));
+        if (recheck) rechecks_.fetch_add(1);
+
+        bool objects = false;
+        for (uint32_t i = 0; i < result->bounding_boxes_count; i++) {
+            if (result->bounding_boxes[i].value > 0) objects = true;
+        }
+        if (recheck && objects) misses_.fetch_add(1);
+        if (measured && !objects) update_background(cfg_.learn_shift);
+        return EI_IMPULSE_OK;
+    }
+
+    uint32_t frames() const { return frames_.load(); }
+    uint32_t gated() const { return gated_.load(); }          // frames answered by stage 1 alone
+    uint32_t rechecks() const { return rechecks_.load(); }    // forced full runs on gated frames
+    uint32_t misses() const { return misses_.load(); }        // ... that found an object anyway
+    uint32_t gate_us() const { return gate_us_.load(); }      // moving averages per stage
+    uint32_t full_us() const { return full_us_.load(); }
+
+private:
+    // Block means and standard deviations of the current frame, read through
+    // the signal one row at a time (packed 0xRRGGBB floats, as the camera gives).
+    bool measure(signal_t *signal) {
+        if (signal->total_length != (size_t)w_ * h_) return false;
+        uint32_t sum[CASCADE_MAX_BLOCKS] = {0};
+        uint32_t sq[CASCADE_MAX_BLOCKS] = {0};
+        float row[EI_CLASSIFIER_INPUT_WIDTH];
+        if (w_ > EI_CLASSIFIER_INPUT_WIDTH) return false;
+
+        for (int y = 0; y < bh_ * CASCADE_BLOCK; y++) {
+            if (signal->get_data((size_t)y * w_, w_, row) != 0) return false;
+            uint32_t *bs = sum + (y / CASCADE_BLOCK) * bw_;
+            uint32_t *bq = sq + (y / CASCADE_BLOCK) * bw_;
+            for (int x = 0; x < bw_ * CASCADE_BLOCK; x++) {
+                uint32_t px = (uint32_t)row[x];
+                uint32_t l = (((px >> 16) & 0xff) * 77 + ((px >> 8) & 0xff) * 150 + (px & 0xff) * 29) >> 8;
+                bs[x / CASCADE_BLOCK] += l;
+                bq[x / CASCADE_BLOCK] += l * l;
+            }
+        }
+
+        const float n = CASCADE_BLOCK * CASCADE_BLOCK;
+        for (int b = 0; b < bw_ * bh_; b++) {
+            float m = sum[b] / n;
+            float v = sq[b] / n - m * m;
+            mean_[b] = m;
+            std_[b] = v > 0 ? sqrtf(v) : 0;
+        }
+        return true;
+    }
+
+    float score() const {
+        float worst = 0;
+        for (int b = 0; b < bw_ * bh_; b++) {
+            float dm = fabsf(mean_[b] - bg_mean_[b]);
+            float ds = fabsf(std_[b] - bg_std_[b]);
+            if (dm > worst) worst = dm;
+            if (ds > worst) worst = ds;
+        }
+        return worst;
+    }
+
+    void update_background(uint8_t shift) {
+        float k = have_bg_ ? 1.0f / (1u << shift) : 1.0f;
+        for (int b = 0; b < bw_ * bh_; b++) {
+            bg_mean_[b] += (mean_[b] - bg_mean_[b]) * k;
+            bg_std_[b] += (std_[b] - bg_std_[b]) * k;
+        }
+        have_bg_ = true;
+    }
+
+    int w_ = 0, h_ = 0, bw_ = 0, bh_ = 0;
+    Config cfg_;
+    std::atomic<int> threshold_{0};
+
+    // classify task only
+    float mean_[CASCADE_MAX_BLOCKS];
+    float std_[CASCADE_MAX_BLOCKS];
+    float bg_mean_[CASCADE_MAX_BLOCKS];
+    float bg_std_[CASCADE_MAX_BLOCKS];
+    bool have_bg_ = false;
+    uint32_t since_full_ = 0;
+
+    std::atomic<uint32_t> frames_{0};
+    std::atomic<uint32_t> gated_{0};
+    std::atomic<uint32_t> rechecks_{0};
+    std::atomic<uint32_t> misses_{0};
+    std::atomic<uint32_t> gate_us_{0};
+    std::atomic<uint32_t> full_us_{0};
+};
+
+#endif // PRESENCE_CASCADE_H
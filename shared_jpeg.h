@@ -0,0 +1,122 @@
+#ifndef SHARED_JPEG_H
+#define SHARED_JPEG_H
+
+// Reference-counted view of the JPEG buffers handed out by the camera driver,
+// so the classifier and the /stream clients can use the same
+// esp_camera_fb_get() frame. The driver buffer is returned only when the
+// last user releases it. Nothing is copied or re-encoded.
+//
+//   capture:  s = wrap(fb)  -> publish(s) -> decode -> release(s)
+//   stream:   add_viewer() -> { s = acquire_newer(seq) -> send data(s) -> release(s) } -> remove_viewer()
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHARED_JPEG_SLOTS 6
+
+class SharedJpeg {
+public:
+    typedef void (*return_fn)(void *handle);
+
+    explicit SharedJpeg(return_fn ret) : ret_(ret) {}
+
+    // Capture side: take ownership of a driver buffer (refcount 1). -1 if full.
+    int wrap(void *handle, const uint8_t *data, size_t len) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        for (int i = 0; i < SHARED_JPEG_SLOTS; i++) {
+            if (slots_[i].refs == 0) {
+                slots_[i] = {handle, data, len, ++seq_, 1};
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Make `ix` the frame streamed next; holds one extra reference until
+    // replaced. No-op without viewers, checked under the same lock that
+    // remove_viewer() drops the published frame under.
+    void publish(int ix) {
+        void *drop = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (viewers_ == 0) return;
+            slots_[ix].refs++;
+            if (latest_ >= 0) drop = unref(latest_);
+            latest_ = ix;
+        }
+        if (drop) ret_(drop);
+    }
+
+    // Stream side: newest published frame if newer than `after_seq`, else -1.
+    int acquire_newer(uint32_t after_seq) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (latest_ < 0 || slots_[latest_].seq == after_seq) return -1;
+        slots_[latest_].refs++;
+        return latest_;
+    }
+
+    void release(int ix) {
+        void *drop;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            drop = unref(ix);
+        }
+        if (drop) ret_(drop);
+    }
+
+    // Stream clients. false when `max` are already connected.
+    bool add_viewer(int max) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (viewers_ >= max) return false;
+        viewers_++;
+        return true;
+    }
+
+    // The last viewer leaving drops the published frame.
+    void remove_viewer() {
+        void *drop = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (--viewers_ > 0) return;
+            if (latest_ >= 0) drop = unref(latest_);
+            latest_ = -1;
+        }
+        if (drop) ret_(drop);
+    }
+
+    int viewers() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return viewers_;
+    }
+
+    const uint8_t *data(int ix) const { return slots_[ix].data; }
+    size_t len(int ix) const { return slots_[ix].len; }
+    uint32_t seq(int ix) const { return slots_[ix].seq; }
+
+private:
+    struct Slot {
+        void *handle;
+        const uint8_t *data;
+        size_t len;
+        uint32_t seq;
+        int refs;
+    };
+
+    // returns the driver handle to give back once the count hits zero
+    void *unref(int ix) {
+        if (--slots_[ix].refs > 0) return nullptr;
+        void *h = slots_[ix].handle;
+        slots_[ix].handle = nullptr;
+        return h;
+    }
+
+    return_fn ret_;
+    std::mutex mtx_;
+    Slot slots_[SHARED_JPEG_SLOTS] = {};
+    int latest_ = -1;
+    int viewers_ = 0;
+    uint32_t seq_ = 0;
+};
+
+#endif // SHARED_JPEG_H
@@ -0,0 +1,114 @@
+#ifndef SORTER_HAL_H
+#define SORTER_HAL_H
+
+// Thin platform layer for the sorter firmware. On the ESP32 (Arduino core) it
+// maps to ESP-IDF / Arduino calls; anywhere else it falls back to libc so the
+// frame-handling logic can be built and exercised on a Linux host.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef void (*hal_task_fn)(void *arg);
+
+#if defined(ARDUINO) && defined(ESP32)
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// Large frame buffers go to PSRAM; internal RAM is kept for stacks, WiFi and
+// what has to be fast (hal_alloc_internal).
+static inline uint8_t *hal_alloc_frame(size_t bytes) {
+    void *p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!p) p = malloc(bytes);
+    return (uint8_t *)p;
+}
+// Internal SRAM only; nullptr when it does not fit.
+static inline uint8_t *hal_alloc_internal(size_t bytes) {
+    return (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+static inline void hal_free_frame(uint8_t *p) { free(p); }
+// 16-byte aligned, internal SRAM or PSRAM; nullptr when it does not fit.
+// Free with hal_free_aligned().
+static inline uint8_t *hal_alloc_aligned(size_t bytes, bool internal) {
+    uint32_t caps = (internal ? MALLOC_CAP_INTERNAL : MALLOC_CAP_SPIRAM) | MALLOC_CAP_8BIT;
+    return (uint8_t *)heap_caps_aligned_alloc(16, bytes, caps);
+}
+static inline void hal_free_aligned(uint8_t *p) { heap_caps_aligned_free(p); }
+static inline uint32_t hal_micros(void) { return (uint32_t)micros(); }
+static inline void hal_delay_ms(uint32_t ms) { delay(ms); }
+static inline uint32_t hal_free_heap(void) { return (uint32_t)esp_get_free_heap_size(); }
+
+// Starts a task pinned to `core` (0 = PRO_CPU, 1 = APP_CPU).
+static inline bool hal_task_start(hal_task_fn fn, void *arg, const char *name,
+                                  uint32_t stack_bytes, int prio, int core) {
+    return xTaskCreatePinnedToCore(fn, name, stack_bytes, arg, prio, NULL, core) == pdPASS;
+}
+
+// Binary wake-up signal between two tasks.
+class HalSignal {
+public:
+    HalSignal() { sem_ = xSemaphoreCreateBinaryStatic(&buf_); }
+    void give() { xSemaphoreGive(sem_); }
+    bool take(uint32_t timeout_ms) { return xSemaphoreTake(sem_, pdMS_TO_TICKS(timeout_ms)) == pdTRUE; }
+
+private:
+    StaticSemaphore_t buf_;
+    SemaphoreHandle_t sem_;
+};
+
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+static inline uint8_t *hal_alloc_frame(size_t bytes) { return (uint8_t *)malloc(bytes); }
+static inline uint8_t *hal_alloc_internal(size_t bytes) { return (uint8_t *)malloc(bytes); }
+static inline void hal_free_frame(uint8_t *p) { free(p); }
+static inline uint8_t *hal_alloc_aligned(size_t bytes, bool internal) {
+    (void)internal;
+    return (uint8_t *)aligned_alloc(16, (bytes + 15) & ~(size_t)15);
+}
+static inline void hal_free_aligned(uint8_t *p) { free(p); }
+static inline uint32_t hal_micros(void) {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static inline void hal_delay_ms(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+static inline uint32_t hal_free_heap(void) { return 0; }
+
+// Host: plain detached threads, core/priority are ignored.
+static inline bool hal_task_start(hal_task_fn fn, void *arg, const char *name,
+                                  uint32_t stack_bytes, int prio, int core) {
+    (void)name; (void)stack_bytes; (void)prio; (void)core;
+    std::thread(fn, arg).detach();
+    return true;
+}
+
+class HalSignal {
+public:
+    void give() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        set_ = true;
+        cv_.notify_one();
+    }
+    bool take(uint32_t timeout_ms) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        bool ok = cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this] { return set_; });
+        set_ = false;
+        return ok;
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool set_ = false;
+};
+#endif
+
+#endif // SORTER_HAL_H
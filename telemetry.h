@@ -0,0 +1,101 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Fixed-size in-RAM log of per-frame stage timings, kept on in production.
+// One writer (the classify task) appends with a struct copy and a release
+// store, no locks or allocation. Readers (/telemetry) take a snapshot of the
+// index range and stream the records straight out of the ring, stopping at
+// the first one the writer has overwritten since.
+//
+// Download format (little endian, decoded by host/telemetry_decode.cpp):
+//   TelemetryHeader, then `count` TelemetryRecords, oldest first.
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "sorter_hal.h"
+
+#define TELEMETRY_MAGIC     0x314d4c54u     // "TLM1"
+#define TELEMETRY_RECORDS   512             // power of two
+
+enum TelemetryFlags : uint8_t {
+    TELEMETRY_FLAG_TRACKED = 1,     // boxes came from the keyframe tracker, not FOMO
+    TELEMETRY_FLAG_GATED   = 2,     // presence gate saw an empty belt, FOMO skipped
+};
+
+enum TelemetryDecision : uint8_t {
+    TELEMETRY_NONE = 0,
+    TELEMETRY_BALL = 1,
+    TELEMETRY_BOX  = 2,
+};
+
+struct TelemetryRecord {
+    uint32_t frame_id;
+    uint32_t t_ms;                  // millis() when recorded
+    uint32_t grab_us;               // esp_camera_fb_get
+    uint32_t decode_us;             // JPEG -> RGB888 + resize
+    uint32_t dsp_us;                // result.timing.dsp_us
+    uint32_t classification_us;     // result.timing.classification_us
+    uint32_t post_us;               // rest of run_classifier
+    uint32_t actuate_us;            // posting servo/LCD commands
+    uint32_t latency_us;            // capture done -> actuation queued
+    uint32_t heap_free;
+    uint8_t decision;               // TelemetryDecision
+    uint8_t servo_angle;
+    uint8_t confidence_pct;
+    uint8_t flags;                  // TelemetryFlags
+    uint8_t reserved[4];
+};
+static_assert(sizeof(TelemetryRecord) == 48, "TelemetryRecord layout is part of the download format");
+
+struct TelemetryHeader {
+    uint32_t magic;
+    uint16_t record_size;
+    uint16_t reserved;
+    uint32_t count;
+    uint32_t dropped;               // records lost to wrap-around since boot
+};
+
+class Telemetry {
+    static_assert((TELEMETRY_RECORDS & (TELEMETRY_RECORDS - 1)) == 0, "TELEMETRY_RECORDS must be a power of two");
+
+public:
+    bool init() {
+        ring_ = (TelemetryRecord *)hal_alloc_frame(sizeof(TelemetryRecord) * TELEMETRY_RECORDS);
+        return ring_ != nullptr;
+    }
+
+    // Writer only.
+    void record(const TelemetryRecord &r) {
+        if (!ring_) return;
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        ring_[head & (TELEMETRY_RECORDS - 1)] = r;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    // Records held right now: indices [*first, *first + count), oldest first.
+    // Once the ring has wrapped the oldest slot is the next one written, so
+    // it is left out.
+    uint32_t snapshot(uint32_t *first) const {
+        if (!ring_) { *first = 0; return 0; }
+        uint32_t head = head_.load(std::memory_order_acquire);
+        *first = head >= TELEMETRY_RECORDS ? head - TELEMETRY_RECORDS + 1 : 0;
+        return head - *first;
+    }
+
+    // Copies record `index` (from snapshot()); false once the writer has
+    // reached its slot, the copy may then be torn.
+    bool read(uint32_t index, TelemetryRecord *out) const {
+        if (!ring_) return false;
+        memcpy(out, &ring_[index & (TELEMETRY_RECORDS - 1)], sizeof(TelemetryRecord));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return head_.load(std::memory_order_relaxed) - index < TELEMETRY_RECORDS;
+    }
+
+private:
+    TelemetryRecord *ring_ = nullptr;
+    std::atomic<uint32_t> head_{0};
+};
+
+#endif // TELEMETRY_H